@@ -92,6 +92,7 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <map>
 
 
 ClassImp(AliCFUnfolding)
@@ -123,6 +124,19 @@ AliCFUnfolding::AliCFUnfolding() :
   fCoordinates2N(0x0),
   fCoordinatesN_M(0x0),
   fCoordinatesN_T(0x0),
+  fCellsM(),
+  fCellsT(),
+  fCondValues(),
+  fCondCellM(),
+  fCondCellT(),
+  fCondInvBin(),
+  fInvCellM(),
+  fInvCellT(),
+  fPriorTimesEffT(),
+  fCellValuesM(),
+  fCellValuesT(),
+  fEstMeasuredBin(),
+  fUnfoldedBin(),
   fRandomResponse(0x0),
   fRandomEfficiency(0x0),
   fRandomMeasured(0x0),
@@ -167,6 +181,19 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fCoordinates2N(0x0),
   fCoordinatesN_M(0x0),
   fCoordinatesN_T(0x0),
+  fCellsM(),
+  fCellsT(),
+  fCondValues(),
+  fCondCellM(),
+  fCondCellT(),
+  fCondInvBin(),
+  fInvCellM(),
+  fInvCellT(),
+  fPriorTimesEffT(),
+  fCellValuesM(),
+  fCellValuesT(),
+  fEstMeasuredBin(),
+  fUnfoldedBin(),
   fRandomResponse((THnSparse*)response->Clone()),
   fRandomEfficiency((THnSparse*)efficiency->Clone()),
   fRandomMeasured((THnSparse*)measured->Clone()),
@@ -260,6 +287,9 @@ void AliCFUnfolding::Init() {
   
   // create the frame of the inverse response matrix
   fInverseResponse  = (THnSparse*) fResponse->Clone();
+
+  // flatten the conditional and inverse response matrices for the iterations
+  CreateSparseResponse();
   // create the frame of the unfolded spectrum
   fUnfolded = (THnSparse*) fPrior->Clone();
   fUnfolded->SetTitle("Unfolded");
@@ -297,20 +327,23 @@ void AliCFUnfolding::CreateEstMeasured() {
 
   THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
   priorTimesEff->Multiply(fEfficiency);
+  for (UInt_t iCell=0; iCell<fPriorTimesEffT.size(); iCell++)
+    fPriorTimesEffT[iCell] = priorTimesEff->GetBinContent(&fCellsT[iCell*fNVariables]);
+  delete priorTimesEff ;
 
   // fill it
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t priorTimesEffValue = priorTimesEff->GetBinContent(fCoordinatesN_T);
-    Double_t fill = conditionalValue * priorTimesEffValue ;
+  // the bins of fMeasuredEstimate are created in the same order as when filling by coordinates
+  fEstMeasuredBin.assign(fEstMeasuredBin.size(),-1);
+  for (UInt_t iBin=0; iBin<fCondValues.size(); iBin++) {
+    Double_t fill = fCondValues[iBin] * fPriorTimesEffT[fCondCellT[iBin]] ;
     
     if (fill>0.) {
-      fMeasuredEstimate->AddBinContent(fCoordinatesN_M,fill);
-      fMeasuredEstimate->SetBinError(fCoordinatesN_M,0.);
+      Long64_t& bin = fEstMeasuredBin[fCondCellM[iBin]];
+      if (bin<0) bin = fMeasuredEstimate->GetBin(&fCellsM[fCondCellM[iBin]*fNVariables]);
+      fMeasuredEstimate->AddBinContent(bin,fill);
+      fMeasuredEstimate->SetBinError(bin,0.);
     }
   }
-  delete priorTimesEff ;
 }
 
 //______________________________________________________________
@@ -323,22 +356,22 @@ void AliCFUnfolding::CreateInvResponse() {
   // --> P(T|M)   = P(M|T)    * P(T) * eff(T) / SUM   { P(M|T)    * P(T) }
   // --> INV(i,j) = COND(i,j) * T(j) * E(j)   / SUM_k { COND(i,k) * T(k) }
   //
+  // Uses the prior times efficiency computed in CreateEstMeasured()
+  //
 
-  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
-  priorTimesEff->Multiply(fEfficiency);
+  for (UInt_t iCell=0; iCell<fCellValuesM.size(); iCell++)
+    fCellValuesM[iCell] = (fEstMeasuredBin[iCell]<0 ? 0. : fMeasuredEstimate->GetBinContent(fEstMeasuredBin[iCell]));
 
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t estMeasuredValue   = fMeasuredEstimate->GetBinContent(fCoordinatesN_M);
-    Double_t priorTimesEffValue = priorTimesEff    ->GetBinContent(fCoordinatesN_T);
-    Double_t fill = (estMeasuredValue>0. ? conditionalValue * priorTimesEffValue / estMeasuredValue : 0. ) ;
-    if (fill>0. || fInverseResponse->GetBinContent(fCoordinates2N)>0.) {
-      fInverseResponse->SetBinContent(fCoordinates2N,fill);
-      fInverseResponse->SetBinError  (fCoordinates2N,0.);
+  for (UInt_t iBin=0; iBin<fCondValues.size(); iBin++) {
+    Double_t estMeasuredValue   = fCellValuesM[fCondCellM[iBin]];
+    Double_t priorTimesEffValue = fPriorTimesEffT[fCondCellT[iBin]];
+    Double_t fill = (estMeasuredValue>0. ? fCondValues[iBin] * priorTimesEffValue / estMeasuredValue : 0. ) ;
+    Long64_t invBin = fCondInvBin[iBin];
+    if (fill>0. || fInverseResponse->GetBinContent(invBin)>0.) {
+      fInverseResponse->SetBinContent(invBin,fill);
+      fInverseResponse->SetBinError  (invBin,0.);
     }
   } 
-  delete priorTimesEff ;
 }
 
 //______________________________________________________________
@@ -423,20 +456,28 @@ void AliCFUnfolding::CreateUnfolded() {
   // otherwise the normal unfolded spectrum is created
 
   fUnfolded->Reset();
-  
-  for (Long_t iBin=0; iBin<fInverseResponse->GetNbins(); iBin++) {
-    Double_t invResponseValue = fInverseResponse->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t effValue      = fEfficiency->GetBinContent(fCoordinatesN_T);
-    Double_t measuredValue = fMeasured  ->GetBinContent(fCoordinatesN_M);
+
+  for (UInt_t iCell=0; iCell<fCellValuesT.size(); iCell++)
+    fCellValuesT[iCell] = fEfficiency->GetBinContent(&fCellsT[iCell*fNVariables]);
+  for (UInt_t iCell=0; iCell<fCellValuesM.size(); iCell++)
+    fCellValuesM[iCell] = fMeasured  ->GetBinContent(&fCellsM[iCell*fNVariables]);
+
+  // the bins of fUnfolded are created in the same order as when filling by coordinates
+  fUnfoldedBin.assign(fUnfoldedBin.size(),-1);
+  for (UInt_t iBin=0; iBin<fInvCellT.size(); iBin++) {
+    Double_t invResponseValue = fInverseResponse->GetBinContent((Long64_t)iBin);
+    Double_t effValue      = fCellValuesT[fInvCellT[iBin]];
+    Double_t measuredValue = fCellValuesM[fInvCellM[iBin]];
     Double_t fill = (effValue>0. ? invResponseValue * measuredValue / effValue : 0.) ;
 
     if (fill>0.) {
       // set errors to zero
       // true errors will be filled afterwards
       Double_t err = 0.;
-      fUnfolded->SetBinError  (fCoordinatesN_T,err);
-      fUnfolded->AddBinContent(fCoordinatesN_T,fill);
+      Long64_t& bin = fUnfoldedBin[fInvCellT[iBin]];
+      if (bin<0) bin = fUnfolded->GetBin(&fCellsT[fInvCellT[iBin]*fNVariables]);
+      fUnfolded->SetBinError  (bin,err);
+      fUnfolded->AddBinContent(bin,fill);
     }
   }
 }
@@ -620,6 +661,65 @@ void AliCFUnfolding::CreateConditional() {
 }
 //______________________________________________________________
 
+void AliCFUnfolding::CreateSparseResponse() {
+  //
+  // Flattens the conditional and inverse response matrices, which keep the same bins during the unfolding :
+  // each bin is stored with the indices of its cells in the measured and true spaces,
+  // such that the iterations do not need to look up the N-dim spectra bin by bin
+  //
+
+  std::map<std::vector<Int_t>,Int_t> cellsM, cellsT;
+  std::vector<Int_t> coordM(fNVariables), coordT(fNVariables);
+
+  Long_t nCond = fConditional->GetNbins();
+  fCondValues.resize(nCond);
+  fCondCellM .resize(nCond);
+  fCondCellT .resize(nCond);
+  fCondInvBin.resize(nCond);
+  Long_t nInv = fInverseResponse->GetNbins();
+  fInvCellM.resize(nInv);
+  fInvCellT.resize(nInv);
+
+  for (Long_t iBin=0; iBin<nCond+nInv; iBin++) {
+    if (iBin<nCond) fCondValues[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    else fInverseResponse->GetBinContent(iBin-nCond,fCoordinates2N);
+    GetCoordinates();
+    coordM.assign(fCoordinatesN_M,fCoordinatesN_M+fNVariables);
+    coordT.assign(fCoordinatesN_T,fCoordinatesN_T+fNVariables);
+
+    std::map<std::vector<Int_t>,Int_t>::iterator itM = cellsM.find(coordM);
+    if (itM==cellsM.end()) {
+      itM = cellsM.insert(std::make_pair(coordM,(Int_t)cellsM.size())).first;
+      fCellsM.insert(fCellsM.end(),coordM.begin(),coordM.end());
+    }
+    std::map<std::vector<Int_t>,Int_t>::iterator itT = cellsT.find(coordT);
+    if (itT==cellsT.end()) {
+      itT = cellsT.insert(std::make_pair(coordT,(Int_t)cellsT.size())).first;
+      fCellsT.insert(fCellsT.end(),coordT.begin(),coordT.end());
+    }
+
+    if (iBin<nCond) {
+      fCondCellM[iBin]  = itM->second;
+      fCondCellT[iBin]  = itT->second;
+      fCondInvBin[iBin] = fInverseResponse->GetBin(fCoordinates2N);
+    }
+    else {
+      fInvCellM[iBin-nCond] = itM->second;
+      fInvCellT[iBin-nCond] = itT->second;
+    }
+  }
+
+  fPriorTimesEffT.assign(cellsT.size(),0.);
+  fCellValuesT   .assign(cellsT.size(),0.);
+  fUnfoldedBin   .assign(cellsT.size(),-1);
+  fCellValuesM   .assign(cellsM.size(),0.);
+  fEstMeasuredBin.assign(cellsM.size(),-1);
+
+  AliDebug(0,Form("Flattened response : %ld bins, %d measured cells, %d true cells",nCond,(Int_t)cellsM.size(),(Int_t)cellsT.size()));
+}
+
+//______________________________________________________________
+
 Int_t AliCFUnfolding::GetDOF() {
   //
   // number of dof = number of bins
@@ -13,6 +13,7 @@
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
+#include <vector>
 
 class TF1;
 class TRandom3;
@@ -101,6 +102,21 @@ class AliCFUnfolding : public TNamed {
 	Int_t         *fCoordinatesN_M;    // Coordinates in measured space
 	Int_t         *fCoordinatesN_T;    // Coordinates in true space
 
+  /* flattened response : each bin of the 2N-dim matrices as a (measured cell, true cell) pair */
+  std::vector<Int_t>    fCellsM;           //! coordinates of the measured cells, fNVariables per cell
+  std::vector<Int_t>    fCellsT;           //! coordinates of the true cells, fNVariables per cell
+  std::vector<Double_t> fCondValues;       //! content of each bin of fConditional
+  std::vector<Int_t>    fCondCellM;        //! measured cell of each bin of fConditional
+  std::vector<Int_t>    fCondCellT;        //! true cell of each bin of fConditional
+  std::vector<Long64_t> fCondInvBin;       //! bin of fInverseResponse with the coordinates of each bin of fConditional
+  std::vector<Int_t>    fInvCellM;         //! measured cell of each bin of fInverseResponse
+  std::vector<Int_t>    fInvCellT;         //! true cell of each bin of fInverseResponse
+  std::vector<Double_t> fPriorTimesEffT;   //! prior times efficiency in each true cell
+  std::vector<Double_t> fCellValuesM;      //! work array over the measured cells
+  std::vector<Double_t> fCellValuesT;      //! work array over the true cells
+  std::vector<Long64_t> fEstMeasuredBin;   //! bin of fMeasuredEstimate of each measured cell, -1 if not filled
+  std::vector<Long64_t> fUnfoldedBin;      //! bin of fUnfolded of each true cell, -1 if not filled
+
 
   /* correlated error calculation */
   THnSparse     *fRandomResponse;    // Randomized distribution for each bin of the response matrix     to calculate correlated errors
@@ -117,6 +133,7 @@ class AliCFUnfolding : public TNamed {
   void     Init();                  // initialisation of the internal settings
   void     GetCoordinates();        // gets a cell coordinates in Measured and True space
   void     CreateConditional();     // creates the conditional matrix from the response matrix
+  void     CreateSparseResponse();  // flattens the conditional and inverse response matrices
   void     CreateEstMeasured();     // creates the measured spectrum estimation from the conditional matrix and the prior distribution
   void     CreateInvResponse();     // creates the inverse response function (Bayes Theorem) from the conditional matrix and the prior distribution
   void     CreateUnfolded();        // creates the unfolded spectrum from the inverse response matrix and the measured distribution
@@ -132,7 +149,7 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
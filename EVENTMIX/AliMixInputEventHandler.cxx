@@ -11,6 +11,8 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TClass.h>
+#include <TBaseClass.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
@@ -43,7 +45,13 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fMixedEventCacheSize(0),
+   fMixedEventCache(),
+   fMixedEventCacheOrder(),
+   fMixedEventCacheUsers(),
+   fMixedEventCacheMain(-1, -1),
+   fMixedEventCacheAllUsers(-1)
 {
    //
    // Default constructor.
@@ -59,6 +67,7 @@ AliMixInputEventHandler::~AliMixInputEventHandler() {
    // Destructor
    //
    fMixTrees.Clear();
+   ClearMixedEventCache();
 }
 
 //_____________________________________________________________________________
@@ -226,8 +235,10 @@ Bool_t AliMixInputEventHandler::MixStd()
    else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
    if (!inEvHMain) return kFALSE;
 
+   SetMixedEventCacheMain(-1, -1);
    // check for PhysSelection
    if (!IsEventCurrentSelected()) return kFALSE;
+   SetMixedEventCacheMain(1, fEntryCounter);
 
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
@@ -258,7 +269,7 @@ Bool_t AliMixInputEventHandler::MixStd()
       if (!te) {
          AliError("te is null. this is error. tell to developer (#1)");
       } else {
-         if (fDoMixEventGetEntryAuto) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(0), fAnalysisType);
+         if (fDoMixEventGetEntryAuto && !IsMixedEventCached(entryMix)) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(0), fAnalysisType);
          // runs UserExecMix for all tasks
          fNumberMixed++;
          UserExecMixAllTasks(fEntryCounter, 1, fEntryCounter, entryMixReal, fNumberMixed);
@@ -288,6 +299,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
    if (!inEvHMain) return kFALSE;
 
+   SetMixedEventCacheMain(-1, -1);
    // check for PhysSelection
    if (!IsEventCurrentSelected()) return kFALSE;
 
@@ -307,6 +319,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    TEntryList *el = 0;
    Int_t idEntryList = -1;
    if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   if (el) SetMixedEventCacheMain(idEntryList, currentMainEntry);
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       AliDebug(AliLog::kDebug + 3, Form("-> fEntryCounter == 0"));
@@ -355,7 +368,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
       } else {
          fCurrentMixEntry.Enter(entryMixReal);
          AliDebug(AliLog::kDebug + 3, Form("Preparing InputEventHandler(%d)", counter));
-         if (fDoMixEventGetEntryAuto) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(counter), fAnalysisType);
+         if (fDoMixEventGetEntryAuto && !IsMixedEventCached(entryMix)) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(counter), fAnalysisType);
          fNumberMixed++;
       }
       counter++;
@@ -389,6 +402,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
    if (!inEvHMain) return kFALSE;
 
+   SetMixedEventCacheMain(-1, -1);
    // check for PhysSelection
    if (!IsEventCurrentSelected()) return kFALSE;
 
@@ -407,6 +421,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Int_t idEntryList = -1;
    TEntryList *el = 0;
    if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   if (el) SetMixedEventCacheMain(idEntryList, currentMainEntry);
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       // runs UserExecMix for all tasks, if needed
@@ -471,7 +486,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
          AliError("te is null. this is error. tell to developer (#2)");
       } else {
          fCurrentMixEntry.Enter(entryMixReal);
-         if (fDoMixEventGetEntryAuto) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(0), fAnalysisType);
+         if (fDoMixEventGetEntryAuto && !IsMixedEventCached(entryMix)) mihi->PrepareEntry(te, entryMix, (AliInputEventHandler *)InputEventHandler(0), fAnalysisType);
          // runs UserExecMix for all tasks
          fNumberMixed++;
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, entryMixReal, fNumberMixed);
@@ -625,3 +640,185 @@ Bool_t AliMixInputEventHandler::GetEntryMixedEvent(Int_t id) {
 
    return kTRUE;
 }
+
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::CacheMixedEvent(const TObject *user, TObject *reducedEvent)
+{
+   //
+   // Stores the reduced copy of the current main event made by user (e.g. the task)
+   // in the cache of mixed events, so that it can be served with GetCachedMixedEvent()
+   // when the event is mixed later on, without reading it again from the chain.
+   // Should be called in UserExec() only. The handler takes ownership of reducedEvent,
+   // which is deleted if the cache is disabled or the main event is not in the pool.
+   //
+   // The mixed events are still read from the chain (with DoMixEventGetEntryAuto())
+   // unless all the tasks running UserExecMix() are users of the cache, see
+   // RegisterMixedEventCacheUser().
+   //
+
+   if (fMixedEventCacheSize <= 0 || fMixedEventCacheMain.second < 0 || !user) {
+      delete reducedEvent;
+      return kFALSE;
+   }
+
+   Int_t idUser = RegisterMixedEventCacheUser(user);
+
+   TObjArray *slots = 0;
+   std::map<MixedEventCacheKey, TObjArray *>::iterator it = fMixedEventCache.find(fMixedEventCacheMain);
+   if (it != fMixedEventCache.end()) {
+      slots = it->second;
+   } else {
+      slots = new TObjArray(fMixedEventCacheUsers.size());
+      slots->SetOwner(kTRUE);
+      fMixedEventCache[fMixedEventCacheMain] = slots;
+      fMixedEventCacheOrder.push_back(fMixedEventCacheMain);
+      // drops the oldest events
+      while ((Int_t)fMixedEventCacheOrder.size() > fMixedEventCacheSize) {
+         it = fMixedEventCache.find(fMixedEventCacheOrder.front());
+         delete it->second;
+         fMixedEventCache.erase(it);
+         fMixedEventCacheOrder.pop_front();
+      }
+   }
+   if (idUser < slots->GetSize() && slots->At(idUser) != reducedEvent) delete slots->At(idUser);
+   slots->AddAtAndExpand(reducedEvent, idUser);
+
+   return kTRUE;
+}
+
+//_____________________________________________________________________________
+Int_t AliMixInputEventHandler::RegisterMixedEventCacheUser(const TObject *user)
+{
+   //
+   // Declares user (a task) as user of the cache of mixed events and returns its index.
+   // A registered task promises to get the mixed events in UserExecMix() only via
+   // GetCachedMixedEvent(), falling back to GetEntryMixedEvent() when they are not cached.
+   // The automatic reading of a mixed event is skipped only when the event is cached
+   // for all the users and all the tasks overriding UserExecMix() are registered users.
+   // Should be called before the event loop (e.g. in UserCreateOutputObjects()).
+   //
+   for (Int_t idUser = 0; idUser < (Int_t)fMixedEventCacheUsers.size(); idUser++) {
+      if (fMixedEventCacheUsers[idUser] == user) return idUser;
+   }
+   fMixedEventCacheUsers.push_back(user);
+   fMixedEventCacheAllUsers = -1;
+   return fMixedEventCacheUsers.size() - 1;
+}
+
+//_____________________________________________________________________________
+TObject *AliMixInputEventHandler::GetCachedMixedEvent(const TObject *user, Int_t id) const
+{
+   //
+   // Returns the reduced copy, stored by user with CacheMixedEvent(), of the mixed
+   // event of input handler id, or 0 if it is not cached (then the event
+   // is read from the chain as without cache). Should be used in UserExecMix() only.
+   //
+
+   Long64_t entryMix = MixedEntry(id);
+   if (entryMix < 0) return 0;
+   std::map<MixedEventCacheKey, TObjArray *>::const_iterator it = fMixedEventCache.find(MixedEventCacheKey(fMixedEventCacheMain.first, entryMix));
+   if (it == fMixedEventCache.end()) return 0;
+
+   for (Int_t idUser = 0; idUser < (Int_t)fMixedEventCacheUsers.size(); idUser++) {
+      if (fMixedEventCacheUsers[idUser] != user) continue;
+      return (idUser < it->second->GetSize()) ? it->second->At(idUser) : 0;
+   }
+   return 0;
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::SetMixedEventCacheMain(Int_t binIndex, Long64_t entry)
+{
+   //
+   // Sets cache key of current main event
+   //
+   fMixedEventCacheMain.first = binIndex;
+   fMixedEventCacheMain.second = entry;
+}
+
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::IsMixedEventCached(Long64_t entryMix) const
+{
+   //
+   // Checks if mixed event is in cache for all its users, so it does not need to be read
+   //
+   if (fMixedEventCache.empty()) return kFALSE;
+   if (!AllMixingTasksUseCache()) return kFALSE;
+   std::map<MixedEventCacheKey, TObjArray *>::const_iterator it = fMixedEventCache.find(MixedEventCacheKey(fMixedEventCacheMain.first, entryMix));
+   if (it == fMixedEventCache.end()) return kFALSE;
+   if (it->second->GetSize() < (Int_t)fMixedEventCacheUsers.size()) return kFALSE;
+   for (Int_t idUser = 0; idUser < (Int_t)fMixedEventCacheUsers.size(); idUser++) {
+      if (!it->second->At(idUser)) return kFALSE;
+   }
+   return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::AllMixingTasksUseCache() const
+{
+   //
+   // Checks if all the tasks overriding UserExecMix() are users of the cache, so that
+   // no task needs the mixed event read from the chain when it is cached for all the users.
+   // Tasks whose class cannot be inspected are considered to need it.
+   // The result is kept until a new user is registered.
+   //
+   if (fMixedEventCacheAllUsers >= 0) return (fMixedEventCacheAllUsers > 0);
+
+   fMixedEventCacheAllUsers = 1;
+   AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+   if (!mgr) {
+      fMixedEventCacheAllUsers = 0;
+      return kFALSE;
+   }
+   AliAnalysisTaskSE *mixTask = 0;
+   TObjArrayIter next(mgr->GetTasks());
+   while ((mixTask = dynamic_cast<AliAnalysisTaskSE *>(next()))) {
+      Bool_t isUser = kFALSE;
+      for (Int_t idUser = 0; idUser < (Int_t)fMixedEventCacheUsers.size(); idUser++) {
+         if (fMixedEventCacheUsers[idUser] == mixTask) isUser = kTRUE;
+      }
+      if (isUser) continue;
+      // looks for UserExecMix() in the classes between the task class and AliAnalysisTaskSE
+      Bool_t overrides = kTRUE;
+      TClass *cl = mixTask->IsA();
+      while (cl && cl != AliAnalysisTaskSE::Class()) {
+         if (cl->GetMethodAny("UserExecMix")) break;
+         TBaseClass *base = cl->GetListOfBases() ? dynamic_cast<TBaseClass *>(cl->GetListOfBases()->First()) : 0;
+         cl = base ? base->GetClassPointer() : 0;
+      }
+      if (cl == AliAnalysisTaskSE::Class()) overrides = kFALSE;
+      if (overrides) {
+         AliDebug(AliLog::kDebug, Form("Task %s runs UserExecMix() without the cache, mixed events are read from the chain", mixTask->GetName()));
+         fMixedEventCacheAllUsers = 0;
+         break;
+      }
+   }
+   return (fMixedEventCacheAllUsers > 0);
+}
+
+//_____________________________________________________________________________
+Long64_t AliMixInputEventHandler::MixedEntry(Int_t id) const
+{
+   //
+   // Entry in chain of mixed event of input handler id
+   //
+   if (fEventPool && fBufferSize > 1) {
+      if (id < 0 || id >= fCurrentMixEntry.GetN()) return -1;
+      return const_cast<TEntryList &>(fCurrentMixEntry).GetEntry(fCurrentMixEntry.GetN() - id - 1);
+   }
+   return (id == 0) ? fCurrentEntryMix : -1;
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::ClearMixedEventCache()
+{
+   //
+   // Deletes all cached events
+   //
+   std::map<MixedEventCacheKey, TObjArray *>::iterator it;
+   for (it = fMixedEventCache.begin(); it != fMixedEventCache.end(); ++it) delete it->second;
+   fMixedEventCache.clear();
+   fMixedEventCacheOrder.clear();
+   fMixedEventCacheUsers.clear();
+   fMixedEventCacheAllUsers = -1;
+}
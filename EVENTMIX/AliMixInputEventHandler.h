@@ -2,6 +2,9 @@
 // Class AliMixEventInputHandler
 //
 // Mixing input handler prepare N events before UserExec
+// Reduced copies of the events made by the tasks can be cached
+// (SetMixedEventCacheSize(), CacheMixedEvent(), GetCachedMixedEvent())
+// so that mixed events are not read again from the chain for each mixing
 // TODO example
 // author:
 //        Martin Vala (martin.vala@cern.ch)
@@ -10,6 +13,11 @@
 #ifndef ALIMIXINPUTEVENTHANDLER_H
 #define ALIMIXINPUTEVENTHANDLER_H
 
+#include <map>
+#include <deque>
+#include <vector>
+#include <utility>
+
 #include <TObjArray.h>
 #include <TEntryList.h>
 #include <TArrayI.h>
@@ -73,6 +81,13 @@ public:
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
+
+   // cache of reduced mixed events (filled in UserExec(), read in UserExecMix())
+   void                    SetMixedEventCacheSize(Int_t size) { fMixedEventCacheSize = size; }
+   Int_t                   MixedEventCacheSize() const { return fMixedEventCacheSize; }
+   Int_t                   RegisterMixedEventCacheUser(const TObject *user);
+   Bool_t                  CacheMixedEvent(const TObject *user, TObject *reducedEvent);
+   TObject                *GetCachedMixedEvent(const TObject *user, Int_t idHandler=0) const;
 protected:
 
    TObjArray               fMixTrees;              // buffer of input handlers
@@ -100,6 +115,20 @@ private:
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
 
+   typedef std::pair<Int_t, Long64_t> MixedEventCacheKey; // (bin index, entry in chain)
+   Int_t    fMixedEventCacheSize;  //  maximum number of events in cache of reduced mixed events (0 = no cache)
+   std::map<MixedEventCacheKey, TObjArray *> fMixedEventCache; //! reduced events, one slot per cache user
+   std::deque<MixedEventCacheKey> fMixedEventCacheOrder;      //! cached events, oldest first
+   std::vector<const TObject *> fMixedEventCacheUsers;        //! users of the cache (not owned)
+   MixedEventCacheKey fMixedEventCacheMain;                    //! key of the current main event (entry -1 if it is not in the pool)
+   mutable Int_t fMixedEventCacheAllUsers;                     //! 1 if all the tasks running UserExecMix() use the cache, 0 if not, -1 if not checked yet
+
+   void                    SetMixedEventCacheMain(Int_t binIndex, Long64_t entry);
+   Bool_t                  IsMixedEventCached(Long64_t entryMix) const;
+   Bool_t                  AllMixingTasksUseCache() const;
+   Long64_t                MixedEntry(Int_t idHandler) const;
+   void                    ClearMixedEventCache();
+
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
@@ -110,7 +139,7 @@ private:
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -0,0 +1,167 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of the EMCal OADB containers
+//-------------------------------------------------------------------------
+
+#include <TFile.h>
+#include <TH1.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include "AliOADBContainer.h"
+#include "AliEMCALOADBCache.h"
+#include "AliLog.h"
+
+ClassImp(AliEMCALOADBCache);
+
+AliEMCALOADBCache *AliEMCALOADBCache::fgInstance = 0;
+Int_t              AliEMCALOADBCache::fgNUsers   = 0;
+
+//______________________________________________________________________________
+AliEMCALOADBCache::AliEMCALOADBCache() :
+  TObject(),
+  fContainers(),
+  fTempCorr(),
+  fTempCorrNBins()
+{
+  // Default constructor, use Acquire() to get the process-wide cache
+}
+
+//______________________________________________________________________________
+AliEMCALOADBCache::~AliEMCALOADBCache()
+{
+  // Destructor
+  std::map<TString, AliOADBContainer*>::iterator it;
+  for (it = fContainers.begin(); it != fContainers.end(); ++it) delete it->second;
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliEMCALOADBCache* AliEMCALOADBCache::Acquire()
+{
+  // Get the process-wide cache, creating it for the first user.
+  // Each call must be matched by a call to Release().
+  if (!fgInstance) fgInstance = new AliEMCALOADBCache();
+  fgNUsers++;
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+void AliEMCALOADBCache::Release()
+{
+  // Give back the cache, which is deleted with its last user
+  if (fgNUsers <= 0) {
+    AliErrorClass("Cache released more times than acquired");
+    return;
+  }
+  if (--fgNUsers == 0) {
+    delete fgInstance;
+    fgInstance = 0;
+  }
+}
+
+//______________________________________________________________________________
+AliOADBContainer* AliEMCALOADBCache::GetContainer(const char *fileName, const char *containerName)
+{
+  // Container containerName of the file fileName, read at the first request.
+  // Returns 0 if the file cannot be opened.
+  TString key = Form("%s#%s", fileName, containerName);
+  std::map<TString, AliOADBContainer*>::iterator it = fContainers.find(key);
+  if (it != fContainers.end()) return it->second;
+
+  TFile *file = TFile::Open(fileName, "read");
+  if (!file || file->IsZombie()) {
+    delete file;
+    return 0;
+  }
+  delete file;
+
+  AliInfo(Form("Loading %s from %s", containerName, fileName));
+  AliOADBContainer *cont = new AliOADBContainer("");
+  cont->InitFromFile(fileName, containerName);
+  fContainers[key] = cont;
+  return cont;
+}
+
+//______________________________________________________________________________
+TObject* AliEMCALOADBCache::GetObject(const char *fileName, const char *containerName, Int_t run, const char *pass)
+{
+  // Object of the run, or its entry named pass if pass is given
+  AliOADBContainer *cont = GetContainer(fileName, containerName);
+  if (!cont) return 0;
+
+  TObject *obj = cont->GetObject(run);
+  if (!obj || !pass) return obj;
+
+  TObjArray *arr = dynamic_cast<TObjArray*>(obj);
+  return arr ? arr->FindObject(pass) : 0;
+}
+
+//______________________________________________________________________________
+const Double_t* AliEMCALOADBCache::GetTemperatureCorrections(const char *fileName, Int_t run, Int_t &nCells)
+{
+  // Temperature correction factors of the run, as a flat array with the
+  // content of bin i of the OADB histogram divided by 10000 at index i,
+  // to be indexed with the absolute cell ID. nCells is set to the number of
+  // bins of the histogram. If the run is not in the container the closest
+  // entry is used. Returns 0 if not available.
+  nCells = 0;
+  AliOADBContainer *cont = GetContainer(fileName, "AliEMCALRunDepTempCalibCorrections");
+  if (!cont) return 0;
+
+  Int_t entry = cont->GetIndexForRun(run);
+  if (entry < 0) {
+    AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",run));
+    // let's get the closest run number instead then..
+    Int_t lower = 0;
+    Int_t ic = 0;
+    Int_t maxEntry = cont->GetNumberOfEntries();
+
+    while ((ic < maxEntry) && (cont->UpperLimit(ic) < run)) {
+      lower = ic;
+      ic++;
+    }
+
+    entry = lower;
+    if ((ic<maxEntry) &&
+        (cont->LowerLimit(ic)-run) < (run - cont->UpperLimit(lower))) {
+      entry = ic;
+    }
+
+    AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", entry, cont->LowerLimit(entry)));
+  }
+
+  TString key = Form("%s#%d", fileName, entry);
+  std::map<TString, std::vector<Double_t> >::iterator it = fTempCorr.find(key);
+  if (it == fTempCorr.end()) {
+    TH1 *h = dynamic_cast<TH1*>(cont->GetObjectByIndex(entry));
+    if (!h) return 0;
+
+    // cover all the EMCal and DCal cells, beyond the histogram the overflow
+    // bin is used as in TH1::GetBinContent
+    Int_t nbins = h->GetNbinsX();
+    std::vector<Double_t> &corr = fTempCorr[key];
+    corr.resize(TMath::Max(nbins+2, fgkNCells));
+    for (Int_t i = 0; i < (Int_t)corr.size(); i++) corr[i] = h->GetBinContent(TMath::Min(i, nbins+1)) / 10000.;
+    it = fTempCorr.find(key);
+    fTempCorrNBins[key] = nbins;
+  }
+
+  nCells = fTempCorrNBins[key];
+  return &(it->second[0]);
+}
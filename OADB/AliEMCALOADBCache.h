@@ -0,0 +1,58 @@
+#ifndef ALIEMCALOADBCACHE_H
+#define ALIEMCALOADBCACHE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of the EMCal OADB containers
+//
+//     The tender, the EMCal correction framework, AliCalorimeterUtils and
+//     the EMCal PWGPP tasks read the same bad channel, energy, temperature
+//     and time calibration containers at each run change. The cache loads
+//     each (file, container) pair once per process and serves the run and
+//     pass objects from it. The users get the cache with Acquire() and give
+//     it back with Release(); it is deleted with the last user.
+//
+//     The objects of the containers are shared: users that hand them over
+//     to an owner (e.g. AliEMCALRecoUtils) must clone them first.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+#include <TString.h>
+
+class AliOADBContainer;
+
+class AliEMCALOADBCache : public TObject
+{
+ public :
+  AliEMCALOADBCache();
+  virtual ~AliEMCALOADBCache();
+  //
+  static AliEMCALOADBCache* Acquire();
+  static void               Release();
+  //
+  AliOADBContainer* GetContainer(const char *fileName, const char *containerName);
+  TObject*          GetObject(const char *fileName, const char *containerName, Int_t run, const char *pass = 0);
+  const Double_t*   GetTemperatureCorrections(const char *fileName, Int_t run, Int_t &nCells);
+  //
+ private:
+  AliEMCALOADBCache(const AliEMCALOADBCache& cache);
+  AliEMCALOADBCache& operator=(const AliEMCALOADBCache& cache);
+
+ protected:
+  std::map<TString, AliOADBContainer*>     fContainers;   //!<! loaded containers, by "file#container"
+  std::map<TString, std::vector<Double_t> > fTempCorr;    //!<! temperature correction factors, by "file#entry"
+  std::map<TString, Int_t>                 fTempCorrNBins; //!<! bins of the temperature correction histograms
+  //
+  static const Int_t        fgkNCells = 17664;            // number of EMCal and DCal cells
+  //
+  static AliEMCALOADBCache *fgInstance;                   //!<! the process-wide cache
+  static Int_t              fgNUsers;                     //!<! number of users holding the cache
+  //
+  ClassDef(AliEMCALOADBCache, 1);
+};
+
+#endif
@@ -66,6 +66,9 @@
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
 #include <vector>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
 #include <Riostream.h>
 #include <TH1F.h>
@@ -111,6 +114,177 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+// Trigger classes and trigger logic of the current run, translated at the
+// initialization into the programs evaluated per event. The regexp matches
+// and the AliTriggerAnalysis decisions are shared by all the classes.
+namespace {
+  enum { kOpTrigger, kOpConst, kOpNot, kOpNeg, kOpAnd, kOpOr, kOpEq, kOpNe, kOpGt, kOpGe, kOpLt, kOpLe };
+
+  struct TriggerLogicOp {
+    Int_t    fOp;    // operation
+    Int_t    fArg;   // trigger slot for kOpTrigger
+    Double_t fValue; // value for kOpConst
+  };
+
+  struct TriggerLogicProgram {
+    std::string fLogic;                 // trigger logic, e.g. "V0A && V0C && !TPCHVdip"
+    Bool_t fOffline;                    // offline or online decisions
+    Bool_t fCompiled;                   // otherwise the TFormula is used
+    std::vector<TriggerLogicOp> fCode;  // postfix program
+  };
+
+  struct TriggerClassProgram {
+    std::vector<std::pair<Int_t, Bool_t> > fClasses; // (regexp, required) of the +/- fired class requirements
+    std::vector<Int_t> fBCs;                         // accepted bunch crossings, none if empty
+    UInt_t fReturnCode;                              // offline trigger bits if selected
+    Int_t fOnline;                                   // online logic program
+    Int_t fOffline;                                  // offline logic program
+  };
+
+  /// Parses a trigger logic with trigger names, numbers, (), !, -, comparisons, && and ||
+  /// with the C precedence into a postfix program. Anything else is left to TFormula.
+  class TriggerLogicParser {
+  public:
+    TriggerLogicParser(const char* logic, std::vector<TriggerLogicOp>& code, std::vector<std::string>& names) :
+      fPos(logic), fOK(kTRUE), fCode(code), fNames(names) {}
+    Bool_t Parse() { Or(); Skip(); return fOK && !*fPos && !fCode.empty(); }
+  private:
+    void Skip() { while (*fPos == ' ' || *fPos == '\t') fPos++; }
+    Bool_t Accept(const char* op) {
+      Skip();
+      size_t n = strlen(op);
+      if (strncmp(fPos, op, n)) return kFALSE;
+      fPos += n;
+      return kTRUE;
+    }
+    void Emit(Int_t op, Int_t arg = 0, Double_t value = 0) {
+      TriggerLogicOp o = { op, arg, value };
+      fCode.push_back(o);
+    }
+    void Or()  { And(); while (fOK && Accept("||")) { And(); Emit(kOpOr); } }
+    void And() { Equality(); while (fOK && Accept("&&")) { Equality(); Emit(kOpAnd); } }
+    void Equality() {
+      Relational();
+      while (fOK) {
+        if      (Accept("==")) { Relational(); Emit(kOpEq); }
+        else if (Accept("!=")) { Relational(); Emit(kOpNe); }
+        else break;
+      }
+    }
+    void Relational() {
+      Unary();
+      while (fOK) {
+        if      (Accept(">=")) { Unary(); Emit(kOpGe); }
+        else if (Accept(">"))  { Unary(); Emit(kOpGt); }
+        else if (Accept("<=")) { Unary(); Emit(kOpLe); }
+        else if (Accept("<"))  { Unary(); Emit(kOpLt); }
+        else break;
+      }
+    }
+    void Unary() {
+      Skip();
+      if (fPos[0] == '!' && fPos[1] != '=') { fPos++; Unary(); Emit(kOpNot); }
+      else if (fPos[0] == '-')              { fPos++; Unary(); Emit(kOpNeg); }
+      else Primary();
+    }
+    void Primary() {
+      Skip();
+      if (Accept("(")) {
+        Or();
+        if (!Accept(")")) fOK = kFALSE;
+      } else if (isdigit(*fPos) || *fPos == '.') {
+        char* end = 0;
+        Double_t value = strtod(fPos, &end);
+        fPos = end;
+        Emit(kOpConst, 0, value);
+      } else if (isalpha(*fPos)) {
+        const char* begin = fPos;
+        while (isalnum(*fPos)) fPos++;
+        fNames.push_back(std::string(begin, fPos));
+        Emit(kOpTrigger, fNames.size() - 1);
+      } else {
+        fOK = kFALSE;
+      }
+    }
+
+    const char* fPos;
+    Bool_t fOK;
+    std::vector<TriggerLogicOp>& fCode;
+    std::vector<std::string>& fNames;
+  };
+}
+
+class CompiledTriggerClasses {
+public:
+  void Clear() {
+    fClasses.clear(); fLogic.clear(); fLogicIndex.clear();
+    fRegexps.clear(); fRegexpIndex.clear();
+    fTriggers.clear(); fTriggerIndex.clear();
+    fFiredClasses = ""; fRegexpMatched.clear();
+  }
+
+  /// Starts a new event: forgets the trigger decisions, and the regexp matches
+  /// if the fired trigger classes changed
+  void NewEvent(const AliVEvent* event) {
+    fTriggerDone.assign(fTriggers.size(), 0);
+    if (fRegexpMatched.size() != fRegexps.size() || fFiredClasses != event->GetFiredTriggerClasses()) {
+      fFiredClasses = event->GetFiredTriggerClasses();
+      fRegexpMatched.assign(fRegexps.size(), -1);
+    }
+  }
+
+  UInt_t CheckTriggerClass(const AliVEvent* event, const TriggerClassProgram& cls) {
+    for (size_t i = 0; i < cls.fClasses.size(); i++) {
+      Char_t& matched = fRegexpMatched[cls.fClasses[i].first];
+      if (matched < 0) matched = fRegexps[cls.fClasses[i].first]->Match(fFiredClasses, "", 0, 1);
+      if (matched != cls.fClasses[i].second) return 0; // required not found or rejected found
+    }
+    if (cls.fBCs.empty()) return cls.fReturnCode;
+    UInt_t bc = event->GetBunchCrossNumber();
+    for (size_t i = 0; i < cls.fBCs.size(); i++)
+      if ((Int_t) bc == cls.fBCs[i]) return cls.fReturnCode;
+    return 0;
+  }
+
+  Int_t TriggerValue(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t slot) {
+    if (!fTriggerDone[slot]) {
+      fTriggerValue[slot] = triggerAnalysis->EvaluateTrigger(event, static_cast<AliTriggerAnalysis::Trigger>(fTriggers[slot]));
+      fTriggerDone[slot] = 1;
+    }
+    return fTriggerValue[slot];
+  }
+
+  Int_t RegexpIndex(const std::string& triggers, TPRegexp* re) {
+    std::map<std::string, Int_t>::iterator it = fRegexpIndex.find(triggers);
+    if (it != fRegexpIndex.end()) return it->second;
+    fRegexps.push_back(re);
+    return fRegexpIndex[triggers] = fRegexps.size() - 1;
+  }
+
+  Int_t TriggerSlot(Int_t trigger) {
+    std::map<Int_t, Int_t>::iterator it = fTriggerIndex.find(trigger);
+    if (it != fTriggerIndex.end()) return it->second;
+    fTriggers.push_back(trigger);
+    fTriggerValue.resize(fTriggers.size());
+    return fTriggerIndex[trigger] = fTriggers.size() - 1;
+  }
+
+  std::vector<TriggerClassProgram> fClasses;           // same order as fCollTrigClasses and fBGTrigClasses
+  std::vector<TriggerLogicProgram> fLogic;
+  std::map<std::pair<std::string, Bool_t>, Int_t> fLogicIndex;
+  std::vector<TPRegexp*> fRegexps;                     // distinct fired class requirements
+  std::map<std::string, Int_t> fRegexpIndex;
+  std::vector<Int_t> fTriggers;                        // distinct AliTriggerAnalysis triggers, with the offline flag
+  std::map<Int_t, Int_t> fTriggerIndex;
+  std::vector<Double_t> fStack;                        // evaluation stack of the logic programs
+
+  // current event
+  TString fFiredClasses;
+  std::vector<Char_t> fRegexpMatched;                  // -1 if not evaluated yet
+  std::vector<Int_t> fTriggerValue;
+  std::vector<Char_t> fTriggerDone;
+};
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,7 +306,8 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fCompiledClasses(new CompiledTriggerClasses())
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -162,7 +337,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fCompiledClasses(new CompiledTriggerClasses())
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -179,6 +355,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
+  delete fCompiledClasses;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -302,9 +479,23 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
-  UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
+  
+  // the compiled classes are transient: a streamed object can come with fCurrentRun set but nothing compiled
+  if (!fCompiledClasses) fCompiledClasses = new CompiledTriggerClasses();
+  if (fCompiledClasses->fClasses.size() != (UInt_t) (nColl+nBG)) {
+    AliInfo(Form("Compiling the trigger classes for run %d", event->GetRunNumber()));
+    if (!fPSOADB) {
+      if (!Initialize(event)) AliFatal(Form("Could not initialize for run %d", event->GetRunNumber()));
+    } else {
+      CompileTriggerClasses();
+    }
+  }
+  
+  fCompiledClasses->NewEvent(event);
+  
+  UInt_t accept = 0;
   for (Int_t i=0; i<nColl+nBG; i++) {
     const char* triggerClass = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
     AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", triggerClass));
@@ -312,11 +503,11 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     AliTriggerAnalysis* triggerAnalysis = static_cast<AliTriggerAnalysis*> (fTriggerAnalysis.At(i));
     triggerAnalysis->FillTriggerClasses(event);
     
-    Int_t triggerLogic = 0;
-    UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
+    const TriggerClassProgram& cls = fCompiledClasses->fClasses[i];
+    UInt_t singleTriggerResult = fCompiledClasses->CheckTriggerClass(event, cls);
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    Bool_t onlineDecision  = EvaluateTriggerProgram(event, triggerAnalysis, cls.fOnline);
+    Bool_t offlineDecision = EvaluateTriggerProgram(event, triggerAnalysis, cls.fOffline);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
@@ -486,6 +677,8 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
     }
   }
   
+  CompileTriggerClasses();
+  
   fCurrentRun = runNumber;
 
   TH1::AddDirectory(oldStatus);
@@ -852,10 +1045,8 @@ FormulaAndBits& AliPhysicsSelection::FindForumla(const char* triggerLogic) {
       e = pos[1];
       std::string matched(trigger.Data() + b, trigger.Data() + e);
 
-      TInterpreter::EErrorCode error;
-      Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", matched.c_str()), &error);
-
-      if (error > 0)
+      Int_t bit = FindTriggerBit(matched);
+      if (bit < 0)
 	AliFatal(Form("Trigger token %s unknown", matched.c_str()));
 
       bits.push_back(static_cast<AliTriggerAnalysis::Trigger>(bit));
@@ -907,3 +1098,136 @@ TPRegexp& AliPhysicsSelection::FindRegexp(const std::string& triggers) const {
 
   return fTriggerToRegexp->emplace(triggers, std::move(re)).first->second;
 }
+
+Int_t AliPhysicsSelection::FindTriggerBit(const std::string& name) const {
+  // AliTriggerAnalysis::Trigger value of a trigger token, -1 if unknown
+  TInterpreter::EErrorCode error;
+  Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", name.c_str()), &error);
+  return error > 0 ? -1 : bit;
+}
+
+void AliPhysicsSelection::CompileTriggerClasses() {
+  // Translates the trigger classes, in the format described in CheckTriggerClass,
+  // and their online and offline trigger logic for the current run into the
+  // programs evaluated in IsCollisionCandidate
+  fCompiledClasses->Clear();
+
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  struct Util {
+    static Int_t atoi(const char*& str) {
+      Int_t ret = 0;
+      while (*str && *str != ' ')
+        ret = 10 * ret + (*str++ - '0');
+      return ret;
+    }
+  };
+
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+
+    TriggerClassProgram cls;
+    cls.fReturnCode = AliVEvent::kUserDefined;
+    Int_t triggerLogic = 0;
+    std::string str;
+    while (*trigger) {
+      // required or rejected triggers
+      if (*trigger == '+' || *trigger == '-') {
+        Bool_t flag = (*trigger == '+');
+        trigger++;
+
+        const char* begin = trigger;
+        while (*trigger && *trigger != ' ')
+          trigger++;
+        str.assign(begin, trigger);
+
+        cls.fClasses.push_back(std::make_pair(fCompiledClasses->RegexpIndex(str, &FindRegexp(str)), flag));
+        continue;
+      }
+      // bunch crossing
+      if (*trigger == '#') {
+        cls.fBCs.push_back(Util::atoi(++trigger));
+        continue;
+      }
+      // return value
+      if (*trigger == '&') {
+        cls.fReturnCode = Util::atoi(++trigger);
+        continue;
+      }
+      // triggerLogic value
+      if (*trigger == '*') {
+        triggerLogic = Util::atoi(++trigger);
+        continue;
+      }
+      trigger++;
+    }
+
+    cls.fOnline  = CompileTriggerLogic(fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
+    cls.fOffline = CompileTriggerLogic(fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    fCompiledClasses->fClasses.push_back(cls);
+  }
+}
+
+Int_t AliPhysicsSelection::CompileTriggerLogic(const char* triggerLogic, Bool_t offline) {
+  // Index of the program of the given trigger logic. Trigger logic that the
+  // parser does not support is left to the TFormula of EvaluateTriggerLogic
+  std::pair<std::string, Bool_t> key(triggerLogic, offline);
+  std::map<std::pair<std::string, Bool_t>, Int_t>::iterator it = fCompiledClasses->fLogicIndex.find(key);
+  if (it != fCompiledClasses->fLogicIndex.end()) return it->second;
+
+  TriggerLogicProgram logic;
+  logic.fLogic = triggerLogic;
+  logic.fOffline = offline;
+  std::vector<std::string> names;
+  logic.fCompiled = TriggerLogicParser(triggerLogic, logic.fCode, names).Parse();
+
+  for (size_t i = 0; logic.fCompiled && i < logic.fCode.size(); i++) {
+    TriggerLogicOp& op = logic.fCode[i];
+    if (op.fOp != kOpTrigger) continue;
+    Int_t bit = FindTriggerBit(names[op.fArg]);
+    if (bit < 0) {
+      logic.fCompiled = kFALSE; // reported when the logic is evaluated
+      break;
+    }
+    op.fArg = fCompiledClasses->TriggerSlot(bit | (offline ? AliTriggerAnalysis::kOfflineFlag : 0));
+  }
+  if (!logic.fCompiled) AliInfo(Form("Trigger logic \"%s\" evaluated with TFormula", triggerLogic));
+
+  if (fCompiledClasses->fStack.size() < logic.fCode.size()) fCompiledClasses->fStack.resize(logic.fCode.size());
+  fCompiledClasses->fLogic.push_back(logic);
+  return fCompiledClasses->fLogicIndex[key] = fCompiledClasses->fLogic.size() - 1;
+}
+
+Bool_t AliPhysicsSelection::EvaluateTriggerProgram(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t iLogic) {
+  // Evaluates a program of CompileTriggerLogic. The trigger decisions are
+  // computed once per event and shared by the trigger classes
+  const TriggerLogicProgram& logic = fCompiledClasses->fLogic[iLogic];
+  if (!logic.fCompiled) return EvaluateTriggerLogic(event, triggerAnalysis, logic.fLogic.c_str(), logic.fOffline);
+
+  Double_t* stack = fCompiledClasses->fStack.data();
+  Int_t n = 0;
+  for (size_t i = 0; i < logic.fCode.size(); i++) {
+    const TriggerLogicOp& op = logic.fCode[i];
+    switch (op.fOp) {
+      case kOpTrigger: stack[n++] = fCompiledClasses->TriggerValue(event, triggerAnalysis, op.fArg); break;
+      case kOpConst:   stack[n++] = op.fValue; break;
+      case kOpNot:     stack[n-1] = !stack[n-1]; break;
+      case kOpNeg:     stack[n-1] = -stack[n-1]; break;
+      default: {
+        Double_t b = stack[--n];
+        Double_t& a = stack[n-1];
+        switch (op.fOp) {
+          case kOpAnd: a = a && b; break;
+          case kOpOr:  a = a || b; break;
+          case kOpEq:  a = a == b; break;
+          case kOpNe:  a = a != b; break;
+          case kOpGt:  a = a >  b; break;
+          case kOpGe:  a = a >= b; break;
+          case kOpLt:  a = a <  b; break;
+          case kOpLe:  a = a <= b; break;
+        }
+      }
+    }
+  }
+  return stack[0];
+}
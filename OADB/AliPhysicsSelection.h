@@ -45,6 +45,7 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
+class CompiledTriggerClasses;
 
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
@@ -128,7 +129,13 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  CompiledTriggerClasses* fCompiledClasses; //! Trigger classes and logic of the current run, with the per event decisions
+  Int_t FindTriggerBit(const std::string& name) const;
+  void CompileTriggerClasses();
+  Int_t CompileTriggerLogic(const char* triggerLogic, Bool_t offline);
+  Bool_t EvaluateTriggerProgram(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t iLogic);
+
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
@@ -11,6 +11,7 @@
 #pragma link C++ class AliOADBFillingScheme+;
 #pragma link C++ class AliOADBTriggerAnalysis+;
 #pragma link C++ class AliOADBTrackFix+;
+#pragma link C++ class AliEMCALOADBCache+;
 
 #pragma link C++ class AliAnalysisUtils+;
 #pragma link C++ class AliPPVsMultUtils+;
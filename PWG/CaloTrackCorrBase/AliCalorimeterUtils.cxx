@@ -33,6 +33,7 @@
 #include "AliVCaloCells.h"
 #include "AliAODCaloCluster.h"
 #include "AliOADBContainer.h"
+#include "AliEMCALOADBCache.h"
 #include "AliAnalysisManager.h"
 #include "AliAODMCParticle.h"
 #include "AliVParticle.h"
@@ -72,6 +73,7 @@ fLocMaxCutE(0),                   fLocMaxCutEDiff(0),
 fPlotCluster(0),                  fOADBSet(kFALSE),
 fOADBForEMCAL(kFALSE),            fOADBForPHOS(kFALSE),
 fOADBFilePathEMCAL(""),           fOADBFilePathPHOS(""),
+fOADBCache(0x0),
 fImportGeometryFromFile(0),       fImportGeometryFilePath(""),
 fNSuperModulesUsed(0),            
 fFirstSuperModuleUsed(-1),        fLastSuperModuleUsed(-1),
@@ -105,6 +107,8 @@ AliCalorimeterUtils::~AliCalorimeterUtils()
 	
   if(fEMCALRecoUtils)   delete fEMCALRecoUtils ;
   if(fNMaskCellColumns) delete [] fMaskCellColumns;
+  
+  if(fOADBCache) AliEMCALOADBCache::Release();
 }
 
 //____________________________________________________
@@ -126,16 +130,19 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
     
     Int_t nSM = fEMCALGeo->GetNumberOfSuperModules();
     
+    // Calibration containers shared with the other EMCal tasks
+    if(!fOADBCache) fOADBCache = AliEMCALOADBCache::Acquire();
+    
     // Bad map
     if(fRemoveBadChannels)
     {
-      AliOADBContainer *contBC=new AliOADBContainer("");
+      TString fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data();
       if(fOADBFilePathEMCAL!="")
-        contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fOADBFilePathEMCAL.Data()),"AliEMCALBadChannels"); 
-      else
-        contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"AliEMCALBadChannels"); 
+        fileBC = Form("%s/EMCALBadChannels.root",fOADBFilePathEMCAL.Data());
+      
+      AliOADBContainer *contBC = fOADBCache->GetContainer(fileBC,"AliEMCALBadChannels");
       
-      TObjArray *arrayBC=(TObjArray*)contBC->GetObject(fRunNumber);
+      TObjArray *arrayBC = contBC ? (TObjArray*)contBC->GetObject(fRunNumber) : 0;
       
       if(arrayBC)
       {
@@ -157,26 +164,24 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
             continue;
           }
           
+          hbm=(TH2I*)hbm->Clone();
           hbm->SetDirectory(0);
           SetEMCALChannelStatusMap(i,hbm);
           
         } // loop
       } else AliInfo("Do NOT remove EMCAL bad channels\n"); // run array
-      
-      delete contBC;
     }  // Remove bad
     
     // Energy Recalibration
     if(fRecalibration)
     {
-      AliOADBContainer *contRF=new AliOADBContainer("");
-      
+      TString fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data();
       if(fOADBFilePathEMCAL!="")
-        contRF->InitFromFile(Form("%s/EMCALRecalib.root",fOADBFilePathEMCAL.Data()),"AliEMCALRecalib");
-      else
-        contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"AliEMCALRecalib");
+        fileRF = Form("%s/EMCALRecalib.root",fOADBFilePathEMCAL.Data());
+      
+      AliOADBContainer *contRF = fOADBCache->GetContainer(fileRF,"AliEMCALRecalib");
         
-      TObjArray *recal=(TObjArray*)contRF->GetObject(fRunNumber);
+      TObjArray *recal = contRF ? (TObjArray*)contRF->GetObject(fRunNumber) : 0;
       
       if(recal)
       {
@@ -204,6 +209,7 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
                 continue;
               }
               
+              h=(TH2F*)h->Clone();
               h->SetDirectory(0);
               
               SetEMCALChannelRecalibrationFactors(i,h);
@@ -212,7 +218,6 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
         } else AliInfo("Do NOT recalibrate EMCAL, no params for pass"); // array pass ok
       } else AliInfo("Do NOT recalibrate EMCAL, no params for run");  // run number array ok
       
-      delete contRF;
       // once set, apply run dependent corrections if requested
       //fEMCALRecoUtils->SetRunDependentCorrections(fRunNumber);
             
@@ -221,40 +226,13 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
     // Energy Recalibration, apply on top of previous calibration factors
     if(fRunDependentCorrection)
     {
-      AliOADBContainer *contRFTD=new AliOADBContainer("");
-      
+      TString fileRFTD = AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data();
       if(fOADBFilePathEMCAL!="")
-        contRFTD->InitFromFile(Form("%s/EMCALTemperatureCorrCalib.root",fOADBFilePathEMCAL.Data()),"AliEMCALRunDepTempCalibCorrections");
-      else
-        contRFTD->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"AliEMCALRunDepTempCalibCorrections");
-
-      TH1S *htd=(TH1S*)contRFTD->GetObject(fRunNumber); 
+        fileRFTD = Form("%s/EMCALTemperatureCorrCalib.root",fOADBFilePathEMCAL.Data());
       
-      //If it did not exist for this run, get closes one
-      if (!htd)
-      {
-        AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",fRunNumber));
-        // let's get the closest fRunNumber instead then..
-        Int_t lower = 0;
-        Int_t ic = 0;
-        Int_t maxEntry = contRFTD->GetNumberOfEntries();
-        
-        while ( (ic < maxEntry) && (contRFTD->UpperLimit(ic) < fRunNumber) ) 
-        {
-          lower = ic;
-          ic++;
-        }
-        
-        Int_t closest = lower;
-        if ( (ic<maxEntry) &&
-            (contRFTD->LowerLimit(ic)-fRunNumber) < (fRunNumber - contRFTD->UpperLimit(lower)) ) 
-        {
-          closest = ic;
-        }
-        
-        AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", closest, contRFTD->LowerLimit(closest)));
-        htd = (TH1S*) contRFTD->GetObjectByIndex(closest);
-      } 
+      // Correction factors per cell, from the run or the closest one
+      Int_t nbins = 0;
+      const Double_t *htd = fOADBCache->GetTemperatureCorrections(fileRFTD,fRunNumber,nbins);
       
       if(htd)
       {
@@ -269,31 +247,28 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
               Float_t factor = GetEMCALChannelRecalibrationFactor(ism,icol,irow);
               
               Int_t absID = fEMCALGeo->GetAbsCellIdFromCellIndexes(ism, irow, icol); // original calibration factor
-              factor *= htd->GetBinContent(absID) / 10000. ; // correction dependent on T
+              factor *= htd[absID] ; // correction dependent on T
         
               //printf("\t ism %d, icol %d, irow %d,absID %d, corrA %2.3f, corrB %2.3f, corrAB %2.3f\n",ism, icol, irow, absID, 
-              //      GetEMCALChannelRecalibrationFactor(ism,icol,irow) , htd->GetBinContent(absID) / 10000., factor);
+              //      GetEMCALChannelRecalibrationFactor(ism,icol,irow) , htd[absID], factor);
         
               SetEMCALChannelRecalibrationFactor(ism,icol,irow,factor);
             } // columns
           } // rows 
         } // SM loop
       } else AliInfo("Do NOT recalibrate EMCAL with T variations, no params TH1");
-      
-      delete contRFTD;
     } // Run by Run T calibration    
     
     // Time Recalibration
     if(fEMCALRecoUtils->IsTimeRecalibrationOn())
     {
-      AliOADBContainer *contTRF=new AliOADBContainer("");
-      
+      TString fileTRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data();
       if(fOADBFilePathEMCAL!="")
-        contTRF->InitFromFile(Form("%s/EMCALTimeCalib.root",fOADBFilePathEMCAL.Data()),"AliEMCALTimeCalib");
-      else
-        contTRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"AliEMCALTimeCalib");
+        fileTRF = Form("%s/EMCALTimeCalib.root",fOADBFilePathEMCAL.Data());
+      
+      AliOADBContainer *contTRF = fOADBCache->GetContainer(fileTRF,"AliEMCALTimeCalib");
 
-      TObjArray *trecal=(TObjArray*)contTRF->GetObject(fRunNumber); 
+      TObjArray *trecal = contTRF ? (TObjArray*)contTRF->GetObject(fRunNumber) : 0;
       
       if(trecal)
       {
@@ -324,27 +299,26 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
               continue;
             }
             
+            h=(TH1F*)h->Clone();
             h->SetDirectory(0);
             
             SetEMCALChannelTimeRecalibrationFactors(ibc,h);
           } // bunch crossing loop
         } else AliInfo("Do NOT recalibrate time EMCAL, no params for pass"); // array pass ok
       } else AliInfo("Do NOT recalibrate time EMCAL, no params for run");  // run number array ok
-      
-      delete contTRF;
     } // Time Recalibration on    
     
     // Time L1 phase racalibration    
     if(fEMCALRecoUtils->IsL1PhaseInTimeRecalibrationOn()) 
     {
-      AliOADBContainer *contTRF=new AliOADBContainer("");
+      TString fileTRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data();
       if(fOADBFilePathEMCAL!="")
-        contTRF->InitFromFile(Form("%s/EMCALTimeL1PhaseCalib.root",fOADBFilePathEMCAL.Data()),"AliEMCALTimeL1PhaseCalib");
-      else
-        contTRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"AliEMCALTimeL1PhaseCalib");
+        fileTRF = Form("%s/EMCALTimeL1PhaseCalib.root",fOADBFilePathEMCAL.Data());
+      
+      AliOADBContainer *contTRF = fOADBCache->GetContainer(fileTRF,"AliEMCALTimeL1PhaseCalib");
 
-      TObjArray *trecal=(TObjArray*)contTRF->GetObject(fRunNumber); 
-      if(!trecal) 
+      TObjArray *trecal = contTRF ? (TObjArray*)contTRF->GetObject(fRunNumber) : 0;
+      if(!trecal && contTRF) 
       {
         AliError(Form("L1 phase time recal: No params for run %d. Default used.",fRunNumber));  // run number array ok
         trecal=(TObjArray*)contTRF->GetObject(0); // Try default object
@@ -363,8 +337,6 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
         {
           AliInfo(Form("L1 phase time recal: No params for run %d and pass %s, try default", fRunNumber, passM.Data())); 
           
-          trecal->Delete();
-          
           trecal=(TObjArray*)contTRF->GetObject(0);
           
           if(trecal)          
@@ -383,6 +355,7 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
           
           if (!h) AliError(Form("Could not load h%d",fRunNumber));
           
+          h=(TH1C*)h->Clone();
           h->SetDirectory(0);
           
           SetEMCALL1PhaseInTimeRecalibrationForAllSM(h);
@@ -398,8 +371,6 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
         AliError("Do not calibrate L1 phase time");
         fEMCALRecoUtils->SwitchOffL1PhaseInTimeRecalibration();
       }
-      
-      delete contTRF;
     }//End of Time L1 phase racalibration 
     
   }// EMCAL
@@ -38,6 +38,7 @@ class AliEMCALGeometry;
 class AliAODMCParticle;
 class TParticle;
 class AliVParticle;
+class AliEMCALOADBCache;
 
 #include "AliEMCALRecoUtils.h"
 
@@ -467,6 +468,8 @@ class AliCalorimeterUtils : public TObject {
   
   TString            fOADBFilePathPHOS ;        ///<  Default path $ALICE_PHYSICS/OADB/PHOS, if needed change.
   
+  AliEMCALOADBCache* fOADBCache ;               //!<! EMCal OADB containers shared with the other tasks.
+  
   Bool_t             fImportGeometryFromFile;   ///<  Import geometry settings in geometry.root file.
   
   TString            fImportGeometryFilePath;   ///<  Path fo geometry.root file.
@@ -488,7 +491,7 @@ class AliCalorimeterUtils : public TObject {
   AliCalorimeterUtils & operator = (const AliCalorimeterUtils & cu) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCalorimeterUtils,20) ;
+  ClassDef(AliCalorimeterUtils,21) ;
   /// \endcond
 
 } ;
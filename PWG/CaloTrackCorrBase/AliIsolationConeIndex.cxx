@@ -0,0 +1,313 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TObjArray.h>
+#include <TMath.h>
+
+#include <algorithm>
+
+// --- CaloTrackCorrelations ---
+#include "AliIsolationConeIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliIsolationConeIndex) ;
+/// \endcond
+
+namespace
+{
+  /// Order particle indices by the value of one of their coordinates.
+  class CompareCoordinate
+  {
+  public:
+    CompareCoordinate(const std::vector<Float_t> & v) : fV(v) { ; }
+    Bool_t operator()(Int_t i, Int_t j) const { return fV[i] < fV[j] ; }
+  private:
+    const std::vector<Float_t> & fV;
+  } ;
+}
+
+//____________________________________
+/// Default constructor.
+//____________________________________
+AliIsolationConeIndex::AliIsolationConeIndex() :
+TObject(),
+fBinWidth(0.1),
+fList(0x0),
+fListHash(0),
+fNEntries(-1),
+fEventNumber(-1),
+fOption(-1),
+fNRequests(0),
+fBuilt(kFALSE),
+fObjects(), fPt(), fEta(), fPhi(), fIDs(),
+fEtaSorted(), fEtaCumPt(), fPhiSorted(), fPhiCumPt(),
+fEtaMin(0.),
+fNEtaBins(0),
+fNPhiBins(TMath::CeilNint(TMath::TwoPi()/fBinWidth)),
+fCellStart(),
+fCellParticles()
+{
+}
+
+//____________________________________
+/// Remove the particles, keep the allocated memory for the next list.
+//____________________________________
+void AliIsolationConeIndex::Clear(Option_t *)
+{
+  fBuilt = kFALSE;
+
+  fObjects.clear();
+  fPt     .clear();
+  fEta    .clear();
+  fPhi    .clear();
+  fIDs    .clear();
+
+  fEtaSorted.clear();
+  fEtaCumPt .clear();
+  fPhiSorted.clear();
+  fPhiCumPt .clear();
+
+  fCellStart    .clear();
+  fCellParticles.clear();
+}
+
+//________________________________________________________________________________
+/// Register a request for the index of a list in a given event.
+///
+/// \param list: list of tracks or clusters.
+/// \param eventNumber: current event number.
+/// \param option: settings used when filling the index from the list, a request with different settings resets the index.
+/// \return kTRUE if the same list was already requested in this event, in which case the index should be used,
+///         (and filled and built if not done yet). If kFALSE, the index is empty and the list should be looped directly.
+//________________________________________________________________________________
+Bool_t AliIsolationConeIndex::Request(const TObjArray * list, Int_t eventNumber, Int_t option)
+{
+  // The pointers of the list objects are hashed, as the same list address can be
+  // reused for different contents in the same event
+  Int_t   nEntries = list->GetEntriesFast();
+  ULong_t hash     = 5381;
+  for(Int_t i = 0; i < nEntries; i++)
+    hash = hash * 33 + (ULong_t) list->UncheckedAt(i);
+
+  if ( list == fList && hash == fListHash && nEntries == fNEntries &&
+       eventNumber == fEventNumber && option == fOption )
+  {
+    fNRequests++;
+    return kTRUE;
+  }
+
+  Clear();
+
+  fList        = list;
+  fListHash    = hash;
+  fNEntries    = nEntries;
+  fEventNumber = eventNumber;
+  fOption      = option;
+  fNRequests   = 1;
+
+  return kFALSE;
+}
+
+//________________________________________________________________________________
+/// Add a particle to the index, to be called in the order of the input list before Build().
+///
+/// \param obj: input object.
+/// \param pt: transverse momentum.
+/// \param eta: pseudorapidity.
+/// \param phi: azimuthal angle in [0,2pi].
+/// \param id: identifier to be matched with the candidate daughter labels.
+/// \param hasID: if kFALSE, the particle is never matched with the candidate daughters.
+//________________________________________________________________________________
+void AliIsolationConeIndex::Add(TObject * obj, Float_t pt, Float_t eta, Float_t phi, Int_t id, Bool_t hasID)
+{
+  if ( hasID ) fIDs.push_back(std::make_pair(id, (Int_t) fPt.size()));
+
+  fObjects.push_back(obj);
+  fPt     .push_back(pt );
+  fEta    .push_back(eta);
+  fPhi    .push_back(phi);
+}
+
+//____________________________________
+/// Sort the particles in eta and phi and fill the grid.
+//____________________________________
+void AliIsolationConeIndex::Build()
+{
+  fBuilt = kTRUE;
+
+  Int_t nParticles = fPt.size();
+
+  std::sort(fIDs.begin(), fIDs.end());
+
+  // Cumulative pT sums of the particles ordered in eta and in phi
+
+  std::vector<Int_t> order(nParticles);
+
+  for(Int_t i = 0; i < nParticles; i++) order[i] = i;
+  std::sort(order.begin(), order.end(), CompareCoordinate(fEta));
+
+  fEtaSorted.resize(nParticles);
+  fEtaCumPt .resize(nParticles+1);
+  fEtaCumPt[0] = 0.;
+  for(Int_t i = 0; i < nParticles; i++)
+  {
+    fEtaSorted[i]  = fEta[order[i]];
+    fEtaCumPt[i+1] = fEtaCumPt[i] + fPt[order[i]];
+  }
+
+  for(Int_t i = 0; i < nParticles; i++) order[i] = i;
+  std::sort(order.begin(), order.end(), CompareCoordinate(fPhi));
+
+  fPhiSorted.resize(nParticles);
+  fPhiCumPt .resize(nParticles+1);
+  fPhiCumPt[0] = 0.;
+  for(Int_t i = 0; i < nParticles; i++)
+  {
+    fPhiSorted[i]  = fPhi[order[i]];
+    fPhiCumPt[i+1] = fPhiCumPt[i] + fPt[order[i]];
+  }
+
+  // Eta-phi grid, particles stored consecutively per cell
+
+  fEtaMin   = nParticles > 0 ? fEtaSorted[0] : 0.;
+  fNEtaBins = nParticles > 0 ? Int_t((fEtaSorted[nParticles-1]-fEtaMin)/fBinWidth) + 1 : 1;
+
+  Int_t nCells = fNEtaBins*fNPhiBins;
+
+  fCellStart.assign(nCells+1, 0);
+  fCellParticles.resize(nParticles);
+
+  std::vector<Int_t> cell(nParticles);
+  for(Int_t i = 0; i < nParticles; i++)
+  {
+    cell[i] = EtaBin(fEta[i])*fNPhiBins + PhiBin(fPhi[i]);
+    fCellStart[cell[i]+1]++;
+  }
+
+  for(Int_t ic = 0; ic < nCells; ic++) fCellStart[ic+1] += fCellStart[ic];
+
+  std::vector<Int_t> fill(fCellStart.begin(), fCellStart.end()-1);
+  for(Int_t i = 0; i < nParticles; i++) fCellParticles[fill[cell[i]]++] = i;
+}
+
+//____________________________________
+/// \return eta cell of the grid, clamped to the grid range.
+//____________________________________
+Int_t AliIsolationConeIndex::EtaBin(Float_t eta) const
+{
+  Int_t bin = TMath::FloorNint((eta-fEtaMin)/fBinWidth);
+
+  if ( bin < 0          ) return 0;
+  if ( bin >= fNEtaBins ) return fNEtaBins-1;
+
+  return bin;
+}
+
+//____________________________________
+/// \return phi cell of the grid, for phi in [0,2pi].
+//____________________________________
+Int_t AliIsolationConeIndex::PhiBin(Float_t phi) const
+{
+  Int_t bin = TMath::FloorNint(phi*fNPhiBins/TMath::TwoPi());
+
+  if ( bin < 0          ) return 0;
+  if ( bin >= fNPhiBins ) return fNPhiBins-1;
+
+  return bin;
+}
+
+//________________________________________________________________________________
+/// \return sum of pT of the particles with etaMin < eta < etaMax.
+//________________________________________________________________________________
+Double_t AliIsolationConeIndex::SumPtInEtaBand(Float_t etaMin, Float_t etaMax) const
+{
+  Int_t first = std::upper_bound(fEtaSorted.begin(), fEtaSorted.end(), etaMin) - fEtaSorted.begin();
+  Int_t last  = std::lower_bound(fEtaSorted.begin(), fEtaSorted.end(), etaMax) - fEtaSorted.begin();
+
+  if ( last <= first ) return 0.;
+
+  return fEtaCumPt[last] - fEtaCumPt[first];
+}
+
+//________________________________________________________________________________
+/// \return sum of pT of the particles with phiMin < phi < phiMax, no wrapping of the interval is done.
+//________________________________________________________________________________
+Double_t AliIsolationConeIndex::SumPtInPhiBand(Float_t phiMin, Float_t phiMax) const
+{
+  Int_t first = std::upper_bound(fPhiSorted.begin(), fPhiSorted.end(), phiMin) - fPhiSorted.begin();
+  Int_t last  = std::lower_bound(fPhiSorted.begin(), fPhiSorted.end(), phiMax) - fPhiSorted.begin();
+
+  if ( last <= first ) return 0.;
+
+  return fPhiCumPt[last] - fPhiCumPt[first];
+}
+
+//________________________________________________________________________________
+/// Get the particles of the grid cells around a given position.
+///
+/// \param eta: pseudorapidity of the center.
+/// \param phi: azimuthal angle of the center, in [0,2pi].
+/// \param r: radius, all the particles at a distance smaller or equal to r
+///           (phi difference taken modulo 2pi) are returned, together with some others further away.
+/// \param indices: output list of the particle indices, in no particular order.
+//________________________________________________________________________________
+void AliIsolationConeIndex::FindAround(Float_t eta, Float_t phi, Float_t r, std::vector<Int_t> & indices) const
+{
+  indices.clear();
+
+  if ( fPt.empty() ) return;
+
+  // one extra cell on each side against rounding at the cell edges
+  Int_t etaFirst = TMath::Max(EtaBin(eta-r)-1, 0);
+  Int_t etaLast  = TMath::Min(EtaBin(eta+r)+1, fNEtaBins-1);
+
+  Int_t phiFirst = TMath::FloorNint((phi-r)*fNPhiBins/TMath::TwoPi())-1;
+  Int_t phiLast  = TMath::FloorNint((phi+r)*fNPhiBins/TMath::TwoPi())+1;
+
+  if ( phiLast-phiFirst+1 >= fNPhiBins )
+  {
+    phiFirst = 0;
+    phiLast  = fNPhiBins-1;
+  }
+
+  for(Int_t ieta = etaFirst; ieta <= etaLast; ieta++)
+  {
+    for(Int_t iphi = phiFirst; iphi <= phiLast; iphi++)
+    {
+      Int_t icell = ieta*fNPhiBins + ((iphi % fNPhiBins) + fNPhiBins) % fNPhiBins;
+
+      for(Int_t k = fCellStart[icell]; k < fCellStart[icell+1]; k++)
+        indices.push_back(fCellParticles[k]);
+    }
+  }
+}
+
+//________________________________________________________________________________
+/// Get the particles with a given identifier.
+///
+/// \param id: identifier, see Add().
+/// \param indices: output list of the particle indices.
+//________________________________________________________________________________
+void AliIsolationConeIndex::FindByID(Int_t id, std::vector<Int_t> & indices) const
+{
+  indices.clear();
+
+  std::vector<std::pair<Int_t,Int_t> >::const_iterator it =
+  std::lower_bound(fIDs.begin(), fIDs.end(), std::make_pair(id, -1));
+
+  for( ; it != fIDs.end() && it->first == id; ++it)
+    indices.push_back(it->second);
+}
@@ -0,0 +1,137 @@
+#ifndef ALIISOLATIONCONEINDEX_H
+#define ALIISOLATIONCONEINDEX_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliIsolationConeIndex
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Eta-phi index of the tracks or clusters of one event, used by AliIsolationCut.
+///
+/// Keeps the kinematics of the particles of one input list together with
+/// a coarse eta-phi grid of the particle positions and cumulative
+/// pT sums of the particles sorted in eta and in phi. With it, the particles
+/// near an isolation candidate are found visiting only the neighbouring grid
+/// cells, and the pT sums in the eta and phi bands are obtained with two
+/// binary searches, instead of looping over the full list for each candidate.
+///
+/// The index is only built when the same list is used a second time in the same
+/// event, so that lists used for a single candidate are not penalised.
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+class TObjArray ;
+
+#include <vector>
+#include <utility>
+
+class AliIsolationConeIndex : public TObject {
+
+ public:
+
+  AliIsolationConeIndex() ;
+
+  /// Virtual destructor.
+  virtual ~AliIsolationConeIndex() { ; }
+
+  virtual void Clear(Option_t * opt = "") ;
+
+  Bool_t     Request(const TObjArray * list, Int_t eventNumber, Int_t option) ;
+
+  /// \return kTRUE if Build() was called for the current list.
+  Bool_t     IsBuilt()                 const { return fBuilt               ; }
+
+  void       Add(TObject * obj, Float_t pt, Float_t eta, Float_t phi, Int_t id, Bool_t hasID) ;
+
+  void       Build() ;
+
+  // Access to the stored particles, in the order of the input list
+
+  Int_t      GetNParticles()           const { return fPt.size()           ; }
+  TObject  * GetObject(Int_t i)        const { return fObjects[i]          ; }
+  Float_t    GetPt (Int_t i)           const { return fPt[i]               ; }
+  Float_t    GetEta(Int_t i)           const { return fEta[i]              ; }
+  Float_t    GetPhi(Int_t i)           const { return fPhi[i]              ; }
+
+  // Queries
+
+  Double_t   SumPtInEtaBand(Float_t etaMin, Float_t etaMax) const ;
+
+  Double_t   SumPtInPhiBand(Float_t phiMin, Float_t phiMax) const ;
+
+  void       FindAround(Float_t eta, Float_t phi, Float_t r, std::vector<Int_t> & indices) const ;
+
+  void       FindByID(Int_t id, std::vector<Int_t> & indices) const ;
+
+ private:
+
+  Int_t      EtaBin(Float_t eta) const ;
+
+  Int_t      PhiBin(Float_t phi) const ;
+
+  Float_t    fBinWidth ;                 ///< Eta width of the grid cells, the phi width is the closest dividing 2pi.
+
+  // Identification of the list of the current index
+
+  const TObjArray * fList ;              //!<! List of the current index.
+
+  ULong_t    fListHash ;                 //!<! Hash of the object pointers of the list.
+
+  Int_t      fNEntries ;                 //!<! Number of entries of the list.
+
+  Int_t      fEventNumber ;              //!<! Event number of the list.
+
+  Int_t      fOption ;                   //!<! Option with which the list was filled, see Request().
+
+  Int_t      fNRequests ;                //!<! Number of requests for the current list.
+
+  Bool_t     fBuilt ;                    //!<! Index built for the current list.
+
+  // Particles, in the order of the input list
+
+  std::vector<TObject*> fObjects ;       //!<! Input objects.
+
+  std::vector<Float_t>  fPt ;            //!<! pT of the particles.
+
+  std::vector<Float_t>  fEta ;           //!<! Pseudorapidity of the particles.
+
+  std::vector<Float_t>  fPhi ;           //!<! Azimuthal angle of the particles, in [0,2pi].
+
+  std::vector<std::pair<Int_t,Int_t> > fIDs ; //!<! (id, particle index), sorted by id.
+
+  // Band sums
+
+  std::vector<Float_t>  fEtaSorted ;     //!<! Particle eta in increasing order.
+
+  std::vector<Double_t> fEtaCumPt ;      //!<! Cumulative pT of the particles sorted in eta.
+
+  std::vector<Float_t>  fPhiSorted ;     //!<! Particle phi in increasing order.
+
+  std::vector<Double_t> fPhiCumPt ;      //!<! Cumulative pT of the particles sorted in phi.
+
+  // Grid
+
+  Float_t    fEtaMin ;                   //!<! Lower eta edge of the grid.
+
+  Int_t      fNEtaBins ;                 //!<! Number of eta cells.
+
+  Int_t      fNPhiBins ;                 //!<! Number of phi cells.
+
+  std::vector<Int_t>    fCellStart ;     //!<! First entry of each cell in fCellParticles.
+
+  std::vector<Int_t>    fCellParticles ; //!<! Particle indices, grouped by cell.
+
+  /// Copy constructor not implemented.
+  AliIsolationConeIndex(              const AliIsolationConeIndex & idx) ;
+
+  /// Assignment operator not implemented.
+  AliIsolationConeIndex & operator = (const AliIsolationConeIndex & idx) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliIsolationConeIndex,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALIISOLATIONCONEINDEX_H
@@ -16,6 +16,8 @@
 // --- ROOT system ---
 #include <TObjArray.h>
 
+#include <algorithm>
+
 // --- AliRoot system ---
 #include "AliCaloTrackParticleCorrelation.h"
 #include "AliEMCALGeometry.h"
@@ -30,6 +32,7 @@
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
+#include "AliIsolationConeIndex.h"
 #include "AliIsolationCut.h"
 
 /// \cond CLASSIMP
@@ -54,11 +57,25 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fTrackConeIndex(0x0),
+fClusterConeIndex(0x0),
+fConeExcluded(),
+fConeFound(),
+fConeSelected()
 {
   InitParameters();
 }
 
+//____________________________________
+/// Destructor.
+//____________________________________
+AliIsolationCut::~AliIsolationCut()
+{
+  delete fTrackConeIndex ;
+  delete fClusterConeIndex ;
+}
+
 //_________________________________________________________________________________________________________________________________
 /// Get normalization of cluster background band.
 //_________________________________________________________________________________________________________________________________
@@ -166,6 +183,189 @@ Float_t AliIsolationCut::CalculateExcessAreaFraction(Float_t excess) const
   }
 }
 
+//________________________________________________________________________________
+/// Add to the list of excluded index entries the particles with a given identifier,
+/// used to remove the candidate daughters from the cone and bands.
+//________________________________________________________________________________
+void AliIsolationCut::ExcludeFromConeIndex(const AliIsolationConeIndex * index, Int_t id)
+{
+  index->FindByID(id, fConeFound);
+
+  fConeExcluded.insert(fConeExcluded.end(), fConeFound.begin(), fConeFound.end());
+}
+
+//________________________________________________________________________________
+/// Fill the index with the clusters of the list, with the same selection
+/// and kinematics as the cluster loop of MakeIsolationCut().
+//________________________________________________________________________________
+void AliIsolationCut::FillClusterConeIndex(AliIsolationConeIndex * index, TObjArray * plNe,
+                                           AliCaloTrackReader * reader, AliCaloPID * pid)
+{
+  Float_t pt  = -100. ;
+  Float_t eta = -100. ;
+  Float_t phi = -100. ;
+
+  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  {
+    AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
+
+    if(calo)
+    {
+      // Get the index where the cluster comes, to retrieve the corresponding vertex
+      Int_t evtIndex = 0 ;
+      if (reader->GetMixedEvent())
+        evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+
+      // Skip matched clusters with tracks in case of neutral+charged analysis
+      if(fIsTMClusterInConeRejected)
+      {
+        if( fPartInCone == kNeutralAndCharged &&
+           pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
+      }
+
+      // Assume that come from vertex in straight line
+      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+
+      pt  = fMomentum.Pt()  ;
+      eta = fMomentum.Eta() ;
+      phi = fMomentum.Phi() ;
+    }
+    else
+    {// Mixed event stored in AliCaloTrackParticles
+      AliCaloTrackParticle * calomix = dynamic_cast<AliCaloTrackParticle*>(plNe->At(ipr)) ;
+      if(!calomix)
+      {
+        AliWarning("Wrong calo data type, continue");
+        continue;
+      }
+
+      pt  = calomix->Pt();
+      eta = calomix->Eta();
+      phi = calomix->Phi() ;
+    }
+
+    if( phi < 0 ) phi+=TMath::TwoPi();
+
+    index->Add(calo, pt, eta, phi, calo ? calo->GetID() : -1, calo != 0x0);
+  }
+}
+
+//________________________________________________________________________________
+/// Fill the index with the tracks of the list, with the same kinematics
+/// as the track loop of MakeIsolationCut().
+//________________________________________________________________________________
+void AliIsolationCut::FillTrackConeIndex(AliIsolationConeIndex * index, TObjArray * plCTS,
+                                         AliCaloTrackReader * reader)
+{
+  Float_t pt  = -100. ;
+  Float_t eta = -100. ;
+  Float_t phi = -100. ;
+
+  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  {
+    AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
+
+    if(track)
+    {
+      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      pt  = fTrackVector.Pt();
+      eta = fTrackVector.Eta();
+      phi = fTrackVector.Phi() ;
+    }
+    else
+    {// Mixed event stored in AliCaloTrackParticles
+      AliCaloTrackParticle * trackmix = dynamic_cast<AliCaloTrackParticle*>(plCTS->At(ipr)) ;
+      if(!trackmix)
+      {
+        AliWarning("Wrong track data type, continue");
+        continue;
+      }
+
+      pt  = trackmix->Pt();
+      eta = trackmix->Eta();
+      phi = trackmix->Phi() ;
+    }
+
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+
+    // needed instead of track->GetID() since AOD needs some manipulations
+    index->Add(track, pt, eta, phi, track ? reader->GetTrackID(track) : -1, track != 0x0);
+  }
+}
+
+//________________________________________________________________________________
+/// Select with the index the particles in the cone of the candidate and get the
+/// pT sum in the eta and phi bands, as done in the loops of MakeIsolationCut().
+/// The candidate daughters must be in fConeExcluded, the index entries in the
+/// cone are returned in fConeSelected in the order of the input list.
+///
+/// \param index: filled and built index of the list.
+/// \param etaC: candidate pseudorapidity.
+/// \param phiC: candidate azimuthal angle, in [0,2pi].
+/// \param etaBandPtSum: sum of pT in the eta band, incremented.
+/// \param phiBandPtSum: sum of pT in the phi band, incremented.
+//________________________________________________________________________________
+void AliIsolationCut::FindInConeWithIndex(const AliIsolationConeIndex * index, Float_t etaC, Float_t phiC,
+                                          Float_t & etaBandPtSum, Float_t & phiBandPtSum)
+{
+  std::sort(fConeExcluded.begin(), fConeExcluded.end());
+  fConeExcluded.erase(std::unique(fConeExcluded.begin(), fConeExcluded.end()), fConeExcluded.end());
+
+  Float_t etaMin = etaC-fConeSize;
+  Float_t etaMax = etaC+fConeSize;
+  Float_t phiMin = phiC-fConeSize;
+  Float_t phiMax = phiC+fConeSize;
+
+  // The bands get all the particles in the eta or phi range, the daughters of the candidate
+  // and the particles not out of the cone (or too close to the candidate) are removed below
+  Double_t phiBand = index->SumPtInEtaBand(etaMin, etaMax);
+  Double_t etaBand = index->SumPtInPhiBand(phiMin, phiMax);
+
+  for(UInt_t k = 0; k < fConeExcluded.size(); k++)
+  {
+    Float_t eta = index->GetEta(fConeExcluded[k]);
+    Float_t phi = index->GetPhi(fConeExcluded[k]);
+
+    if(eta > etaMin && eta < etaMax) phiBand -= index->GetPt(fConeExcluded[k]);
+    if(phi > phiMin && phi < phiMax) etaBand -= index->GetPt(fConeExcluded[k]);
+  }
+
+  fConeSelected.clear();
+
+  index->FindAround(etaC, phiC, TMath::Max(fConeSize, fDistMinToTrigger), fConeFound);
+
+  for(UInt_t k = 0; k < fConeFound.size(); k++)
+  {
+    Int_t ipr = fConeFound[k];
+
+    if(std::binary_search(fConeExcluded.begin(), fConeExcluded.end(), ipr)) continue ;
+
+    Float_t pt  = index->GetPt (ipr);
+    Float_t eta = index->GetEta(ipr);
+    Float_t phi = index->GetPhi(ipr);
+
+    Float_t rad = Radius(etaC, phiC, eta, phi);
+
+    if(rad < fDistMinToTrigger || !(rad > fConeSize))
+    {
+      if(eta > etaMin && eta < etaMax) phiBand -= pt;
+      if(phi > phiMin && phi < phiMax) etaBand -= pt;
+    }
+
+    if(rad < fDistMinToTrigger) continue ;
+
+    // Only the particles at the same side of candidate
+    if(TMath::Abs(phi-phiC) > TMath::PiOver2()) continue ;
+
+    if(rad < fConeSize) fConeSelected.push_back(ipr);
+  }
+
+  std::sort(fConeSelected.begin(), fConeSelected.end());
+
+  etaBandPtSum += etaBand;
+  phiBandPtSum += phiBand;
+}
+
 //_________________________________________________________________________________
 /// Get good cell density (number of active cells over all cells in cone).
 //_________________________________________________________________________________
@@ -345,6 +545,42 @@ void AliIsolationCut::GetCoeffNormBadCell(AliCaloTrackParticleCorrelation * pCan
   }
 }
 
+//________________________________________________________________________________
+/// Get the eta-phi index of a track or cluster list.
+///
+/// \param list: list of tracks or clusters.
+/// \param reader: pointer to AliCaloTrackReader.
+/// \param pid: pointer to AliCaloPID, for the track matching rejection of clusters.
+/// \param isTrack: kTRUE for the track list, kFALSE for the cluster list.
+/// \return the index, filled and built, if the list was already used for another
+///         candidate of the event, null otherwise and the list has to be looped.
+//________________________________________________________________________________
+AliIsolationConeIndex * AliIsolationCut::GetConeIndex(TObjArray * list, AliCaloTrackReader * reader,
+                                                      AliCaloPID * pid, Bool_t isTrack)
+{
+  AliIsolationConeIndex *& index = isTrack ? fTrackConeIndex : fClusterConeIndex ;
+
+  if ( !index ) index = new AliIsolationConeIndex() ;
+
+  // The track matching rejection changes the clusters stored in the index
+  Int_t option = 0 ;
+  if ( !isTrack && fIsTMClusterInConeRejected && fPartInCone == kNeutralAndCharged ) option = 1 ;
+
+  if ( !index->Request(list, reader->GetEventNumber(), option) ) return 0x0 ;
+
+  if ( !index->IsBuilt() )
+  {
+    if ( isTrack ) FillTrackConeIndex  (index, list, reader) ;
+    else           FillClusterConeIndex(index, list, reader, pid) ;
+
+    index->Build() ;
+
+    AliDebug(1,Form("Built %s index with %d entries", isTrack ? "track" : "cluster", index->GetNParticles()));
+  }
+
+  return index ;
+}
+
 //____________________________________________
 // Put data member values in string to keep
 // in output container.
@@ -459,8 +695,47 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   // Check charged tracks in cone.
   // --------------------------------
   
+  // When the list was already used for another candidate, use its eta-phi index
+  AliIsolationConeIndex * trackIndex = 0x0;
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
+    trackIndex = GetConeIndex(plCTS, reader, pid, kTRUE);
+  
+  if(trackIndex)
+  {
+    fConeExcluded.clear();
+    if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS ) // make sure conversions are tagged as kCTS!!!
+    {
+      for(Int_t i = 0; i < 4; i++) ExcludeFromConeIndex(trackIndex, pCandidate->GetTrackLabel(i));
+    }
+    
+    FindInConeWithIndex(trackIndex, etaC, phiC, etaBandPtSumTrack, phiBandPtSumTrack);
+    
+    for(UInt_t k = 0; k < fConeSelected.size(); k++)
+    {
+      pt = trackIndex->GetPt(fConeSelected[k]);
+      
+      if(bFillAOD)
+      {
+        ntrackrefs++;
+        if(ntrackrefs == 1)
+        {
+          reftracks = new TObjArray(0);
+          TString tempo(aodArrayRefName)  ;
+          tempo += "Tracks" ;
+          reftracks->SetName(tempo);
+          reftracks->SetOwner(kFALSE);
+        }
+        reftracks->Add(trackIndex->GetObject(fConeSelected[k]));
+      }
+      
+      coneptsumTrack+=pt;
+      
+      if( ptLead < pt ) ptLead = pt;
+    }
+  }
+  else if(plCTS &&
+     (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
     for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
     {
@@ -604,8 +879,44 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   // Check calorimeter clusters in cone.
   // --------------------------------
   
+  AliIsolationConeIndex * clusterIndex = 0x0;
   if(plNe &&
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
+    clusterIndex = GetConeIndex(plNe, reader, pid, kFALSE);
+  
+  if(clusterIndex)
+  {
+    fConeExcluded.clear();
+    ExcludeFromConeIndex(clusterIndex, pCandidate->GetCaloLabel(0));
+    ExcludeFromConeIndex(clusterIndex, pCandidate->GetCaloLabel(1));
+    
+    FindInConeWithIndex(clusterIndex, etaC, phiC, etaBandPtSumCluster, phiBandPtSumCluster);
+    
+    for(UInt_t k = 0; k < fConeSelected.size(); k++)
+    {
+      pt = clusterIndex->GetPt(fConeSelected[k]);
+      
+      if(bFillAOD)
+      {
+        nclusterrefs++;
+        if(nclusterrefs==1)
+        {
+          refclusters = new TObjArray(0);
+          TString tempo(aodArrayRefName)  ;
+          tempo += "Clusters" ;
+          refclusters->SetName(tempo);
+          refclusters->SetOwner(kFALSE);
+        }
+        refclusters->Add(clusterIndex->GetObject(fConeSelected[k]));
+      }
+      
+      coneptsumCluster+=pt;
+      
+      if( ptLead < pt ) ptLead = pt;
+    }
+  }
+  else if(plNe &&
+     (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
     for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
@@ -23,10 +23,13 @@
 class TObjArray ;
 #include <TLorentzVector.h>
 
+#include <vector>
+
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID;
+class AliIsolationConeIndex ;
 
 class AliIsolationCut : public TObject {
 
@@ -34,8 +37,7 @@ class AliIsolationCut : public TObject {
 
   AliIsolationCut() ;  // default ctor
 
-  /// Virtual destructor.
-  virtual ~AliIsolationCut() { ; }
+  virtual ~AliIsolationCut() ;
 
   // Enums
 
@@ -112,6 +114,22 @@ class AliIsolationCut : public TObject {
     
  private:
 
+  // Eta-phi index of the input lists, used when the same list is isolated against several candidates
+
+  AliIsolationConeIndex * GetConeIndex(TObjArray * list, AliCaloTrackReader * reader,
+                                       AliCaloPID * pid, Bool_t isTrack) ;
+
+  void       FillTrackConeIndex  (AliIsolationConeIndex * index, TObjArray * plCTS,
+                                  AliCaloTrackReader * reader) ;
+
+  void       FillClusterConeIndex(AliIsolationConeIndex * index, TObjArray * plNe,
+                                  AliCaloTrackReader * reader, AliCaloPID * pid) ;
+
+  void       ExcludeFromConeIndex(const AliIsolationConeIndex * index, Int_t id) ;
+
+  void       FindInConeWithIndex (const AliIsolationConeIndex * index, Float_t etaC, Float_t phiC,
+                                  Float_t & etaBandPtSum, Float_t & phiBandPtSum) ;
+
   Float_t    fConeSize ;         ///< Size of the isolation cone
 
   Float_t    fPtThreshold ;      ///< Minimum pt of the particles in the cone or sum in cone (UE pt mean in the forward region cone)
@@ -140,6 +158,16 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  AliIsolationConeIndex * fTrackConeIndex ;   //!<! Eta-phi index of the track list.
+
+  AliIsolationConeIndex * fClusterConeIndex ; //!<! Eta-phi index of the cluster list.
+
+  std::vector<Int_t> fConeExcluded ;  //!<! Index entries of the candidate daughters, temporal object.
+
+  std::vector<Int_t> fConeFound ;     //!<! Index entries around the candidate, temporal object.
+
+  std::vector<Int_t> fConeSelected ;  //!<! Index entries inside the cone, temporal object.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -147,7 +175,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
@@ -9,6 +9,7 @@
 #pragma link C++ class AliFiducialCut+;
 #pragma link C++ class AliCaloPID+;
 #pragma link C++ class AliMCAnalysisUtils+;
+#pragma link C++ class AliIsolationConeIndex+;
 #pragma link C++ class AliIsolationCut+;
 #pragma link C++ class AliCaloTrackParticle+;
 #pragma link C++ class AliCaloTrackParticleCorrelation+;
@@ -111,6 +111,22 @@ AliVCluster* AliClusterContainer::GetLeadingCluster(const char* opt)
     momentum = &AliTLorentzVector::Et;
   }
 
+  if (fUseKinematicsCache) {
+    // E_t = E / cosh(eta), as for the momentum vector of the cluster
+    Bool_t useE = option.Contains("e");
+    const std::vector<Int_t> &acc = GetAcceptedIndices();
+    Int_t iMax = -1;
+    Double_t max = 0;
+    for (std::vector<Int_t>::const_iterator it = acc.begin(); it != acc.end(); ++it) {
+      Double_t val = useE ? GetCachedE(*it) : GetCachedE(*it) / TMath::CosH(GetCachedEta(*it));
+      if (iMax < 0 || max < val) {
+        iMax = *it;
+        max = val;
+      }
+    }
+    return iMax < 0 ? 0 : GetCluster(iMax);
+  }
+
   AliClusterIterableMomentumContainer::momentum_object_pair clusterMax;
 
   for (auto cluster : accepted_momentum()) {
@@ -145,6 +161,8 @@ AliVCluster* AliClusterContainer::GetAcceptCluster(Int_t i) const
   AliVCluster *vc = GetCluster(i);
   if (!vc) return 0;
 
+  if (fUseKinematicsCache) return IsCachedAccepted(i) ? vc : 0;
+
   UInt_t rejectionReason = 0;
   if (AcceptCluster(vc, rejectionReason))
     return vc;
@@ -458,6 +476,7 @@ void AliClusterContainer::SetClusUserDefEnergyCut(Int_t t, Double_t cut)
   else {
     fMinE = cut;
   }
+  ResetKinematicsCache();
 }
 
 /**
@@ -51,10 +51,21 @@ AliEmcalContainer::AliEmcalContainer():
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseKinematicsCache(kFALSE),
+  fKinematicCutSets(),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fKinematicsCacheValid(kFALSE),
+  fCachePt(),
+  fCacheEta(),
+  fCachePhi(),
+  fCacheE(),
+  fCacheM(),
+  fCacheRejection(),
+  fCacheCutMask(),
+  fCacheAcceptedIndices(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -88,10 +99,21 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseKinematicsCache(kFALSE),
+  fKinematicCutSets(),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fKinematicsCacheValid(kFALSE),
+  fCachePt(),
+  fCacheEta(),
+  fCachePhi(),
+  fCacheE(),
+  fCacheM(),
+  fCacheRejection(),
+  fCacheCutMask(),
+  fCacheAcceptedIndices(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -147,6 +169,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
     fClArrayName = GetDefaultArrayName(event);
   }
 
+  ResetKinematicsCache();
+
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
@@ -184,6 +208,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
  */
 void AliEmcalContainer::NextEvent(const AliVEvent * event)
 {
+  ResetKinematicsCache();
+
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
@@ -197,6 +223,7 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
  * @return Number of accepted events in the container
  */
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if (fUseKinematicsCache) return GetAcceptedIndices().size();
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -205,6 +232,99 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   return result;
 }
 
+/**
+ * Register an additional kinematic cut configuration for the kinematics cache.
+ * The configuration replaces the \f$ p_{t} \f$, E, \f$ \eta \f$ and \f$ \phi \f$
+ * limits of the container, all the other cuts of the container are applied as well.
+ * As for the container limits, the \f$ \eta \f$ (\f$ \phi \f$) cut is applied only if min < max.
+ * @param minPt Min. \f$ p_{t} \f$
+ * @param maxPt Max. \f$ p_{t} \f$
+ * @param minEta Min. \f$ \eta \f$
+ * @param maxEta Max. \f$ \eta \f$
+ * @param minPhi Min. \f$ \phi \f$ (in [0, 2pi])
+ * @param maxPhi Max. \f$ \phi \f$ (in [0, 2pi])
+ * @return Index of the configuration, to be used in GetAcceptedIndices and IsCachedAccepted, -1 in case of failure
+ */
+Int_t AliEmcalContainer::AddKinematicCutSet(Double_t minPt, Double_t maxPt, Double_t minEta, Double_t maxEta, Double_t minPhi, Double_t maxPhi)
+{
+  Int_t cutSet = GetNKinematicCutSets();
+  if (cutSet >= 32) {
+    AliError(Form("%s: Cannot register more than 31 additional kinematic cut configurations", GetName()));
+    return -1;
+  }
+
+  Int_t offset = fKinematicCutSets.GetSize();
+  fKinematicCutSets.Set(offset + 6);
+  fKinematicCutSets[offset]     = minPt;
+  fKinematicCutSets[offset + 1] = maxPt;
+  fKinematicCutSets[offset + 2] = minEta;
+  fKinematicCutSets[offset + 3] = maxEta;
+  fKinematicCutSets[offset + 4] = minPhi;
+  fKinematicCutSets[offset + 5] = maxPhi;
+  ResetKinematicsCache();
+
+  return cutSet;
+}
+
+/**
+ * Evaluate the selection and the momentum of all objects in the container
+ * and store them in the kinematics cache. Called automatically at the first
+ * access to the cache in an event. The cache is invalidated at the next event
+ * and whenever a cut of the container is changed.
+ *
+ * An object rejected by the container only because of its \f$ p_{t} \f$, E,
+ * \f$ \eta \f$ or \f$ \phi \f$ passed all the other cuts, since the kinematic
+ * cuts are applied last. It is then tested against the additional cut configurations.
+ */
+void AliEmcalContainer::BuildKinematicsCache() const
+{
+  Int_t nentries = GetNEntries();
+  Int_t nsets = GetNKinematicCutSets();
+  fCachePt.resize(nentries);
+  fCacheEta.resize(nentries);
+  fCachePhi.resize(nentries);
+  fCacheE.resize(nentries);
+  fCacheM.resize(nentries);
+  fCacheRejection.resize(nentries);
+  fCacheCutMask.resize(nentries);
+  fCacheAcceptedIndices.resize(nsets);
+  for (Int_t iset = 0; iset < nsets; iset++) fCacheAcceptedIndices[iset].clear();
+
+  const UInt_t kinematicCuts = kPtCut | kAcceptanceCut;
+
+  AliTLorentzVector mom;
+  for(int index = 0; index < nentries; index++){
+    UInt_t rejectionReason = 0;
+    UInt_t mask = AcceptObject(index, rejectionReason) ? 1u : 0u;
+    fCacheRejection[index] = rejectionReason;
+
+    Bool_t hasMomentum = GetMomentum(mom, index);
+    if (!hasMomentum) mom.SetPxPyPzE(0, 0, 0, 0);
+    fCachePt[index] = mom.Pt();
+    fCacheEta[index] = fCachePt[index] > 0 ? mom.Eta() : 0;
+    fCachePhi[index] = mom.Phi_0_2pi();
+    fCacheE[index] = mom.E();
+    fCacheM[index] = mom.M();
+
+    if (hasMomentum && (rejectionReason & ~kinematicCuts) == 0) {
+      for (Int_t iset = 1; iset < nsets; iset++) {
+        const Double_t *lim = fKinematicCutSets.GetArray() + 6 * (iset - 1);
+        if (fCachePt[index] < lim[0] || fCachePt[index] > lim[1]) continue;
+        if (lim[2] < lim[3] && (fCacheEta[index] < lim[2] || fCacheEta[index] > lim[3])) continue;
+        if (lim[4] < lim[5] && (fCachePhi[index] < lim[4] || fCachePhi[index] > lim[5])) continue;
+        mask |= 1u << iset;
+      }
+    }
+
+    fCacheCutMask[index] = mask;
+    for (Int_t iset = 0; iset < nsets; iset++) {
+      if (mask & (1u << iset)) fCacheAcceptedIndices[iset].push_back(index);
+    }
+  }
+
+  fKinematicsCacheValid = kTRUE;
+}
+
 /**
  * Get the index in the container from a given label
  * @param lab Label to check
@@ -11,8 +11,11 @@ class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TClonesArray.h>
+#include <TArrayD.h>
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterableContainer::operator_star_object<TObject> > AliEmcalIterableContainer;
@@ -70,6 +73,31 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * }
  * ~~~
  *
+ * Tasks iterating several times over the same container in an event can enable
+ * the kinematics cache (SetUseKinematicsCache). The selection and the momentum
+ * of all objects are then evaluated only once per event and stored in contiguous arrays
+ * of \f$ p_{t} \f$, \f$ \eta \f$, \f$ \phi \f$, E and mass, together with the rejection reason of each
+ * object and the list of accepted indices, which can be looped over without virtual calls:
+ *
+ * ~~~{.cxx}
+ * cont->SetUseKinematicsCache();
+ * const std::vector<Int_t> &acc = cont->GetAcceptedIndices();
+ * for(std::vector<Int_t>::const_iterator it = acc.begin(); it != acc.end(); ++it){
+ *   Double_t pt = cont->GetCachedPt(*it), eta = cont->GetCachedEta(*it);
+ * }
+ * ~~~
+ *
+ * Additional kinematic cut configurations can be registered with AddKinematicCutSet. Each of
+ * them replaces the \f$ p_{t} \f$, E, \f$ \eta \f$ and \f$ \phi \f$ limits of the container,
+ * while all the other cuts of the container stay in place. The cache stores for every object a
+ * bitmask with one bit per cut configuration (bit 0 being the selection of the container itself)
+ * and the list of accepted indices of each configuration, so that analyses needing several
+ * kinematic selections of the same objects can use a single container.
+ *
+ * The cache belongs to the container instance: it is reused by all the loops of the task
+ * owning the container within an event, but it is not shared with other tasks, which have
+ * their own containers. The cache is invalidated in NextEvent/SetArray and by the cut setters.
+ *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
  */
 class AliEmcalContainer : public TObject {
@@ -151,28 +179,42 @@ class AliEmcalContainer : public TObject {
   virtual Bool_t              AcceptObject(Int_t i, UInt_t &rejectionReason) const = 0;
   virtual Bool_t              AcceptObject(const TObject* obj, UInt_t &rejectionReason) const = 0;
   Int_t                       GetNAcceptEntries() const;
+  void                        SetUseKinematicsCache(Bool_t b = kTRUE)   { fUseKinematicsCache = b; ResetKinematicsCache(); }
+  Bool_t                      GetUseKinematicsCache()         const { return fUseKinematicsCache        ; }
+  void                        ResetKinematicsCache()                { fKinematicsCacheValid = kFALSE    ; }
+  Int_t                       AddKinematicCutSet(Double_t minPt, Double_t maxPt, Double_t minEta = 0., Double_t maxEta = 0., Double_t minPhi = 0., Double_t maxPhi = 0.);
+  Int_t                       GetNKinematicCutSets()          const { return 1 + fKinematicCutSets.GetSize() / 6; }
+  const std::vector<Int_t>&   GetAcceptedIndices(Int_t cutSet = 0) const { CheckKinematicsCache(); return fCacheAcceptedIndices[cutSet]; }
+  Double_t                    GetCachedPt(Int_t i)            const { CheckKinematicsCache(); return fCachePt[i]         ; }
+  Double_t                    GetCachedEta(Int_t i)           const { CheckKinematicsCache(); return fCacheEta[i]        ; }
+  Double_t                    GetCachedPhi(Int_t i)           const { CheckKinematicsCache(); return fCachePhi[i]        ; }
+  Double_t                    GetCachedE(Int_t i)             const { CheckKinematicsCache(); return fCacheE[i]          ; }
+  Double_t                    GetCachedM(Int_t i)             const { CheckKinematicsCache(); return fCacheM[i]          ; }
+  UInt_t                      GetCachedRejectionReason(Int_t i) const { CheckKinematicsCache(); return fCacheRejection[i]; }
+  UInt_t                      GetCachedCutMask(Int_t i)       const { CheckKinematicsCache(); return fCacheCutMask[i]    ; }
+  Bool_t                      IsCachedAccepted(Int_t i, Int_t cutSet = 0) const { return (GetCachedCutMask(i) & (1u << cutSet)) != 0; }
   void                        ResetCurrentID(Int_t i=-1)            { fCurrentID = i                    ; }
   virtual void                SetArray(const AliVEvent *event);
   void                        SetArrayName(const char *n)           { fClArrayName = n                  ; }
-  void                        SetVertex(Double_t *vtx)              { memcpy(fVertex, vtx, sizeof(Double_t) * 3); }
-  void                        SetBitMap(UInt_t m)                   { fBitMap = m                       ; }
+  void                        SetVertex(Double_t *vtx)              { memcpy(fVertex, vtx, sizeof(Double_t) * 3); ResetKinematicsCache(); }
+  void                        SetBitMap(UInt_t m)                   { fBitMap = m                       ; ResetKinematicsCache(); }
   void                        SetIsParticleLevel(Bool_t b)          { fIsParticleLevel = b              ; }
   void                        SortArray()                           { fClArray->Sort()                  ; }
 
   TClass*                     GetLoadedClass()                      { return fLoadedClass               ; }
   virtual void                NextEvent(const AliVEvent *event);
-  void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; }
-  void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; }
+  void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; ResetKinematicsCache(); }
+  void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; ResetKinematicsCache(); }
   void                        SetMCLabelRange(Int_t min, Int_t max)             { SetMinMCLabel(min)     ; SetMaxMCLabel(max)    ; }
-  void                        SetELimits(Double_t min, Double_t max)    { fMinE   = min ; fMaxE   = max ; }
-  void                        SetMinE(Double_t min)                     { fMinE   = min ; }
-  void                        SetMaxE(Double_t max)                     { fMaxE   = max ; }
-  void                        SetPtLimits(Double_t min, Double_t max)   { fMinPt  = min ; fMaxPt  = max ; }
-  void                        SetMinPt(Double_t min)                    { fMinPt  = min ; }
-  void                        SetMaxPt(Double_t max)                    { fMaxPt  = max ; }
-  void                        SetEtaLimits(Double_t min, Double_t max)  { fMaxEta = max ; fMinEta = min ; }
-  void                        SetPhiLimits(Double_t min, Double_t max)  { fMaxPhi = max ; fMinPhi = min ; }
-  void                        SetMassHypothesis(Double_t m)             { fMassHypothesis         = m   ; }
+  void                        SetELimits(Double_t min, Double_t max)    { fMinE   = min ; fMaxE   = max ; ResetKinematicsCache(); }
+  void                        SetMinE(Double_t min)                     { fMinE   = min ; ResetKinematicsCache(); }
+  void                        SetMaxE(Double_t max)                     { fMaxE   = max ; ResetKinematicsCache(); }
+  void                        SetPtLimits(Double_t min, Double_t max)   { fMinPt  = min ; fMaxPt  = max ; ResetKinematicsCache(); }
+  void                        SetMinPt(Double_t min)                    { fMinPt  = min ; ResetKinematicsCache(); }
+  void                        SetMaxPt(Double_t max)                    { fMaxPt  = max ; ResetKinematicsCache(); }
+  void                        SetEtaLimits(Double_t min, Double_t max)  { fMaxEta = max ; fMinEta = min ; ResetKinematicsCache(); }
+  void                        SetPhiLimits(Double_t min, Double_t max)  { fMaxPhi = max ; fMinPhi = min ; ResetKinematicsCache(); }
+  void                        SetMassHypothesis(Double_t m)             { fMassHypothesis         = m   ; ResetKinematicsCache(); }
   void                        SetClassName(const char *clname);
   void                        SetIsEmbedding(Bool_t b)                  { fIsEmbedding = b ; }
   Bool_t                      GetIsEmbedding() const                    { return fIsEmbedding; }
@@ -203,6 +245,8 @@ class AliEmcalContainer : public TObject {
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return ""; }
   void                        GetVertexFromEvent(const AliVEvent * event);
+  void                        CheckKinematicsCache() const { if (!fKinematicsCacheValid) BuildKinematicsCache(); }
+  void                        BuildKinematicsCache() const;
 
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
@@ -221,11 +265,22 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
   Bool_t                      fIsEmbedding;             ///< if true, this container will connect to an external event
+  Bool_t                      fUseKinematicsCache;      ///< if true, the selection and kinematics are cached once per event
+  TArrayD                     fKinematicCutSets;        ///< \f$ p_{t} \f$, \f$ \eta \f$ and \f$ \phi \f$ limits of the additional cut configurations, 6 values per configuration
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  mutable Bool_t              fKinematicsCacheValid;    //!<! the kinematics cache corresponds to the current event
+  mutable std::vector<Double_t> fCachePt;               //!<! cached \f$ p_{t} \f$ of all objects
+  mutable std::vector<Double_t> fCacheEta;              //!<! cached \f$ \eta \f$ of all objects
+  mutable std::vector<Double_t> fCachePhi;              //!<! cached \f$ \phi \f$ (in [0, 2pi]) of all objects
+  mutable std::vector<Double_t> fCacheE;                //!<! cached energy of all objects
+  mutable std::vector<Double_t> fCacheM;                //!<! cached mass of all objects
+  mutable std::vector<UInt_t>   fCacheRejection;        //!<! cached rejection reason of all objects
+  mutable std::vector<UInt_t>   fCacheCutMask;          //!<! cached selection decision of all objects, one bit per cut configuration
+  mutable std::vector<std::vector<Int_t> > fCacheAcceptedIndices; //!<! indices of the accepted objects for each cut configuration
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -234,7 +289,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
   /// \endcond
 };
 #endif
@@ -332,6 +332,12 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
+  if (fkContainer->GetUseKinematicsCache()) {
+    const std::vector<Int_t> &acceptIndices = fkContainer->GetAcceptedIndices();
+    fAcceptIndices.Set(acceptIndices.size());
+    for(unsigned int index = 0; index < acceptIndices.size(); index++) fAcceptIndices[index] = acceptIndices[index];
+    return;
+  }
   fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
@@ -68,6 +68,19 @@ AliVParticle* AliParticleContainer::GetLeadingParticle(const char* opt)
   TString option(opt);
   option.ToLower();
 
+  if (fUseKinematicsCache) {
+    const std::vector<Int_t> &acc = GetAcceptedIndices();
+    Int_t iMax = -1;
+    for (std::vector<Int_t>::const_iterator it = acc.begin(); it != acc.end(); ++it) {
+      if (iMax < 0) iMax = *it;
+      else if (option.Contains("p")) {
+        if (GetParticle(*it)->P() > GetParticle(iMax)->P()) iMax = *it;
+      }
+      else if (GetCachedPt(*it) > GetCachedPt(iMax)) iMax = *it;
+    }
+    return iMax < 0 ? 0 : GetParticle(iMax);
+  }
+
   Int_t tempID = fCurrentID;
   ResetCurrentID();
 
@@ -114,6 +127,10 @@ AliVParticle* AliParticleContainer::GetAcceptParticle(Int_t i) const
 {
   UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
+  if (fUseKinematicsCache) {
+    if (i >= 0 && i < GetNEntries() && IsCachedAccepted(i)) return GetParticle(i);
+    return 0;
+  }
   if (AcceptParticle(i, rejectionReason)) {
       return GetParticle(i);
   }
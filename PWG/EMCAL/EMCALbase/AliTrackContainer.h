@@ -143,21 +143,21 @@ class AliTrackContainer : public AliParticleContainer {
 
   void                        SetArray(const AliVEvent *event);
 
-  void                        SetTrackFilterType(ETrackFilterType_t f)          { fTrackFilterType = f; }
-  void                        SetFilterHybridTracks(Bool_t f)                   { if (f) fTrackFilterType = AliEmcalTrackSelection::kHybridTracks; else fTrackFilterType = AliEmcalTrackSelection::kNoTrackFilter; }   // legacy method
-  void                        SetITSHybridTrackDistinction(Bool_t doUse)        { fITSHybridTrackDistinction = doUse; }
+  void                        SetTrackFilterType(ETrackFilterType_t f)          { fTrackFilterType = f; ResetKinematicsCache(); }
+  void                        SetFilterHybridTracks(Bool_t f)                   { if (f) fTrackFilterType = AliEmcalTrackSelection::kHybridTracks; else fTrackFilterType = AliEmcalTrackSelection::kNoTrackFilter; ResetKinematicsCache(); }   // legacy method
+  void                        SetITSHybridTrackDistinction(Bool_t doUse)        { fITSHybridTrackDistinction = doUse; ResetKinematicsCache(); }
 
   void                        SetTrackCutsPeriod(const char* period)            { fTrackCutsPeriod = period; }
   void                        AddTrackCuts(AliVCuts *cuts);
   Int_t                       GetNumberOfCutObjects() const;
   AliVCuts                   *GetTrackCuts(Int_t icut);
-  void                        SetAODFilterBits(UInt_t bits)                     { fAODFilterBits   = bits  ; }
+  void                        SetAODFilterBits(UInt_t bits)                     { fAODFilterBits   = bits  ; ResetKinematicsCache(); }
   void                        AddAODFilterBit(UInt_t bit)                       { fAODFilterBits  |= bit   ; }
   UInt_t                      GetAODFilterBits()                          const { return fAODFilterBits    ; }
   Bool_t                      IsHybridTrackSelection() const;
 
-  void SetSelectionModeAny() { fSelectionModeAny = kTRUE ; }
-  void SetSelectionModeAll() { fSelectionModeAny = kFALSE; }
+  void SetSelectionModeAny() { fSelectionModeAny = kTRUE ; ResetKinematicsCache(); }
+  void SetSelectionModeAll() { fSelectionModeAny = kFALSE; ResetKinematicsCache(); }
 
   void                        NextEvent(const AliVEvent* event);
 
@@ -5,6 +5,7 @@
 #include <TFile.h>
 #include "AliEMCALGeometry.h"
 #include "AliOADBContainer.h"
+#include "AliEMCALOADBCache.h"
 #include "AliEMCALRecoUtils.h"
 #include "AliAODEvent.h"
 #include "AliDataFile.h"
@@ -135,43 +136,31 @@ Int_t AliEmcalCorrectionCellEnergy::InitRecalib()
   
   Int_t runRC = fEventManager.InputEvent()->GetRunNumber();
   
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  TString fileRF;
   if (fBasePath!="")
   { //if fBasePath specified
     AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
     
-    TFile *fRecalib= new TFile(Form("%s/EMCALRecalib.root",fBasePath.Data()),"read");
-    if (!fRecalib || fRecalib->IsZombie())
-    {
-      AliFatal(Form("EMCALRecalib.root not found in %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fRecalib) delete fRecalib;
-    
-    contRF->InitFromFile(Form("%s/EMCALRecalib.root",fBasePath.Data()),"AliEMCALRecalib");
+    fileRF = Form("%s/EMCALRecalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     AliInfo("Loading Recalib OADB from OADB/EMCAL");
     
-    TFile *fRecalib= new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"read");
-    if (!fRecalib || fRecalib->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALRecalib.root was not found");
-      return 0;
-    }
-    
-    if (fRecalib) delete fRecalib;
-    
-    contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"AliEMCALRecalib");
+    fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data();
+  }
+  
+  AliOADBContainer *contRF = GetOADBCache()->GetContainer(fileRF,"AliEMCALRecalib");
+  if (!contRF)
+  {
+    AliFatal(Form("%s was not found",fileRF.Data()));
+    return 0;
   }
   
   TObjArray *recal=(TObjArray*)contRF->GetObject(runRC);
   if (!recal)
   {
     AliError(Form("No Objects for run: %d",runRC));
-    delete contRF;
     return 2;
   }
   
@@ -179,7 +168,6 @@ Int_t AliEmcalCorrectionCellEnergy::InitRecalib()
   if (!recalpass)
   {
     AliError(Form("No Objects for run: %d - %s",runRC,fFilepass.Data()));
-    delete contRF;
     return 2;
   }
   
@@ -187,7 +175,6 @@ Int_t AliEmcalCorrectionCellEnergy::InitRecalib()
   if (!recalib)
   {
     AliError(Form("No Recalib histos found for  %d - %s",runRC,fFilepass.Data()));
-    delete contRF;
     return 2;
   }
   
@@ -205,12 +192,11 @@ Int_t AliEmcalCorrectionCellEnergy::InitRecalib()
       AliError(Form("Could not load EMCALRecalFactors_SM%d",i));
       continue;
     }
+    h=(TH2F*)h->Clone();
     h->SetDirectory(0);
     fRecoUtils->SetEMCALChannelRecalibrationFactors(i,h);
   }
   
-  delete contRF;
-  
   return 1;
 }
 
@@ -245,78 +231,45 @@ Int_t AliEmcalCorrectionCellEnergy::InitRunDepRecalib()
   
   Int_t runRC = fEventManager.InputEvent()->GetRunNumber();
   
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  TString fileRF;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
     
-    TFile *fRunDepRecalib= new TFile(Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data()),"read");
-    if (!fRunDepRecalib || fRunDepRecalib->IsZombie())
-    {
-      AliFatal(Form("EMCALTemperatureCorrCalib.root not found in %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fRunDepRecalib) delete fRunDepRecalib;
-    
-    contRF->InitFromFile(Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data()),"AliEMCALRunDepTempCalibCorrections");
+    fileRF = Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     AliInfo("Loading Recalib OADB from OADB/EMCAL");
     
-    TFile *fRunDepRecalib= new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"read");
-    if (!fRunDepRecalib || fRunDepRecalib->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTemperatureCorrCalib.root was not found");
-      return 0;
-    }
-    
-    if (fRunDepRecalib) delete fRunDepRecalib;
-    
-    contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"AliEMCALRunDepTempCalibCorrections");
+    fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data();
   }
   
-  TH1S *rundeprecal=(TH1S*)contRF->GetObject(runRC);
+  if (!GetOADBCache()->GetContainer(fileRF,"AliEMCALRunDepTempCalibCorrections"))
+  {
+    AliFatal(Form("%s was not found",fileRF.Data()));
+    return 0;
+  }
   
+  // Correction factors per cell, from the run or the closest one
+  Int_t nbins = 0;
+  const Double_t *rundeprecal = GetOADBCache()->GetTemperatureCorrections(fileRF,runRC,nbins);
   if (!rundeprecal)
   {
-    AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",runRC));
-    // let's get the closest runnumber instead then..
-    Int_t lower = 0;
-    Int_t ic = 0;
-    Int_t maxEntry = contRF->GetNumberOfEntries();
-    
-    while ((ic < maxEntry) && (contRF->UpperLimit(ic) < runRC)) {
-      lower = ic;
-      ic++;
-    }
-    
-    Int_t closest = lower;
-    if ((ic<maxEntry) &&
-        (contRF->LowerLimit(ic)-runRC) < (runRC - contRF->UpperLimit(lower))) {
-      closest = ic;
-    }
-    
-    AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", closest, contRF->LowerLimit(closest)));
-    rundeprecal = (TH1S*) contRF->GetObjectByIndex(closest);
+    AliError(Form("No TemperatureCorrCalib Objects for run: %d",runRC));
+    return 2;
   }
   
   Int_t nSM = fGeom->GetEMCGeometry()->GetNumberOfSuperModules();
-  Int_t nbins = rundeprecal->GetNbinsX();
   
   // Avoid use of Run1 param for Run2
   if(nSM > 12 && nbins < 12288)
   {
     AliError(Form("Total SM is %d but T corrections available for %d channels, skip Init of T recalibration factors",nSM,nbins));
     
-    delete contRF;
-    
     return 2;
   }
   
-  //AliDebug(1, rundeprecal->Print());
-  
   for (Int_t ism=0; ism<nSM; ++ism)
   {
     for (Int_t icol=0; icol<48; ++icol)
@@ -326,15 +279,13 @@ Int_t AliEmcalCorrectionCellEnergy::InitRunDepRecalib()
         Float_t factor = fRecoUtils->GetEMCALChannelRecalibrationFactor(ism,icol,irow);
         
         Int_t absID = fGeom->GetAbsCellIdFromCellIndexes(ism, irow, icol); // original calibration factor
-        factor *= rundeprecal->GetBinContent(absID) / 10000. ; // correction dependent on T
+        factor *= rundeprecal[absID] ; // correction dependent on T
         
         fRecoUtils->SetEMCALChannelRecalibrationFactor(ism,icol,irow,factor);
       } // columns
     } // rows
   } // SM loop
   
-  delete contRF;
-  
   return 1;
 }
 
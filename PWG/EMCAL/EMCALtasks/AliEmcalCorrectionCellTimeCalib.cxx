@@ -5,6 +5,7 @@
 #include <TFile.h>
 #include "AliEMCALGeometry.h"
 #include "AliOADBContainer.h"
+#include "AliEMCALOADBCache.h"
 #include "AliEMCALRecoUtils.h"
 #include "AliAODEvent.h"
 #include "AliDataFile.h"
@@ -144,43 +145,31 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibration()
   
   Int_t runBC = fEventManager.InputEvent()->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
     
-    TFile *fbad=new TFile(Form("%s/EMCALTimeCalib.root",fBasePath.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("EMCALTimeCalib.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s/EMCALTimeCalib.root",fBasePath.Data()),"AliEMCALTimeCalib");
+    fileBC = Form("%s/EMCALTimeCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     AliInfo("Loading time calibration OADB from $ALICE_PHYSICS/OADB/EMCAL");
     
-    TFile *fbad=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTimeCalib.root was not found");
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"AliEMCALTimeCalib");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALTimeCalib");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
   
@@ -197,7 +186,6 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibration()
   if (!arrayBCpass)
   {
     AliError(Form("No external time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
     return 2;
   }
   
@@ -216,12 +204,11 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibration()
       AliError(Form("Can not get hAllTimeAvBC%d",i));
       continue;
     }
+    h=(TH1F*)h->Clone();
     h->SetDirectory(0);
     fRecoUtils->SetEMCALChannelTimeRecalibrationFactors(i,h);
   }
   
-  delete contBC;
-  
   return 1;
 }
 
@@ -243,43 +230,31 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibrationL1Phase()
   
   Int_t runBC = fEventManager.InputEvent()->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
     
-    TFile *timeFile=new TFile(Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data()),"read");
-    if (!timeFile || timeFile->IsZombie())
-    {
-      AliFatal(Form("EMCALTimeL1PhaseCalib.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (timeFile) delete timeFile;
-    
-    contBC->InitFromFile(Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data()),"AliEMCALTimeL1PhaseCalib");
+    fileBC = Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     AliInfo("Loading L1 phase in time calibration OADB from OADB/EMCAL");
     
-    TFile *timeFile=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"read");
-    if (!timeFile || timeFile->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTimeL1PhaseCalib.root was not found");
-      return 0;
-    }
-    
-    if (timeFile) delete timeFile;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"AliEMCALTimeL1PhaseCalib");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALTimeL1PhaseCalib");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external L1 phase in time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
   
@@ -296,7 +271,6 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibrationL1Phase()
   if (!arrayBCpass)
   {
     AliError(Form("No external L1 phase in time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
     return 2;
   }
   
@@ -311,11 +285,10 @@ Int_t AliEmcalCorrectionCellTimeCalib::InitTimeCalibrationL1Phase()
   if (!h) {
     AliFatal(Form("There is no calibration histogram h%d for this run",runBC));
   }
+  h=(TH1C*)h->Clone();
   h->SetDirectory(0);
   fRecoUtils->SetEMCALL1PhaseInTimeRecalibrationForAllSM(h);
   
-  delete contBC;
-  
   return 1;
 }
 
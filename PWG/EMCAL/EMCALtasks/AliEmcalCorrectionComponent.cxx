@@ -10,6 +10,7 @@
 #include <AliVEvent.h>
 #include <AliEMCALRecoUtils.h>
 #include <AliOADBContainer.h>
+#include <AliEMCALOADBCache.h>
 #include "AliEmcalList.h"
 #include "AliClusterContainer.h"
 #include "AliTrackContainer.h"
@@ -50,8 +51,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fCaloCells(0),
   fRecoUtils(0),
   fOutput(0),
-  fBasePath("")
-
+  fBasePath(""),
+  fOADBCache(0)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -84,7 +85,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fCaloCells(0),
   fRecoUtils(0),
   fOutput(0),
-  fBasePath("")
+  fBasePath(""),
+  fOADBCache(0)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -96,6 +98,7 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
  */
 AliEmcalCorrectionComponent::~AliEmcalCorrectionComponent()
 {
+  if (fOADBCache) AliEMCALOADBCache::Release();
 }
 
 /**
@@ -322,43 +325,31 @@ Int_t AliEmcalCorrectionComponent::InitBadChannels()
   
   Int_t runBC = fEventManager.InputEvent()->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
     
-    TFile *fbad=new TFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("EMCALBadChannels.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"AliEMCALBadChannels");
+    fileBC = Form("%s/EMCALBadChannels.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     AliInfo("Loading Bad Channels OADB from $ALICE_PHYSICS/OADB/EMCAL");
     
-    TFile *fbad=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALBadChannels.root was not found");
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"AliEMCALBadChannels");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALBadChannels");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external hot channel set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
   
@@ -375,12 +366,22 @@ Int_t AliEmcalCorrectionComponent::InitBadChannels()
       AliError(Form("Can not get EMCALBadChannelMap_Mod%d",i));
       continue;
     }
+    h=(TH2I*)h->Clone();
     h->SetDirectory(0);
     fRecoUtils->SetEMCALChannelStatusMap(i,h);
   }
   
-  delete contBC;
-  
   return 1;
 }
 
+/**
+ * Get the EMCal OADB containers, which are shared with the other
+ * components and EMCal tasks and loaded only once per process.
+ */
+AliEMCALOADBCache * AliEmcalCorrectionComponent::GetOADBCache()
+{
+  if (!fOADBCache) fOADBCache = AliEMCALOADBCache::Acquire();
+
+  return fOADBCache;
+}
+
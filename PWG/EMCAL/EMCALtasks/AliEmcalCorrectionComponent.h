@@ -9,6 +9,7 @@ class TH1F;
 
 class AliMCEvent;
 class AliEMCALRecoUtils;
+class AliEMCALOADBCache;
 class AliVCaloCells;
 class AliVTrack;
 class AliVCluster;
@@ -59,6 +60,7 @@ class AliEmcalCorrectionComponent : public TNamed {
   void GetPass();
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
+  AliEMCALOADBCache *GetOADBCache();
 
   // Containers and cells
   AliParticleContainer   *AddParticleContainer(const char *n)                    { return AliEmcalContainerUtils::AddContainer<AliParticleContainer>(n, fParticleCollArray); }
@@ -133,13 +135,14 @@ class AliEmcalCorrectionComponent : public TNamed {
   TList                  *fOutput;                        //!<! List of output histograms
   
   TString                fBasePath;                       ///< Base folder path to get root files
+  AliEMCALOADBCache      *fOADBCache;                     //!<! OADB containers shared with the other EMCal tasks
 
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionComponent, 5); // EMCal correction component
+  ClassDef(AliEmcalCorrectionComponent, 6); // EMCal correction component
   /// \endcond
 };
 
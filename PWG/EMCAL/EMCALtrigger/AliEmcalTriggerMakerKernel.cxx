@@ -19,6 +19,7 @@
 
 #include <TArrayI.h>
 #include <TF1.h>
+#include <TMath.h>
 #include <TObjArray.h>
 #include <TRandom.h>
 
@@ -72,6 +73,7 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fPatchEnergySmearedTable(),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
@@ -312,6 +314,7 @@ void AliEmcalTriggerMakerKernel::Reset(){
   fLevel0TimeMap->Reset();
   fTriggerBitMap->Reset();
   if(fPatchEnergySimpleSmeared) fPatchEnergySimpleSmeared->Reset();
+  fPatchEnergySmearedTable.Clear();
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
 }
 
@@ -504,6 +507,11 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  // Summed-area table of the smeared energies, the smeared energy of any patch
+  // is obtained from it in constant time independent of the patch size.
+  // The online and offline ADC sums are provided by the patch finder.
+  if(fPatchEnergySimpleSmeared) BuildSummedAreaTable(*fPatchEnergySimpleSmeared, fPatchEnergySmearedTable);
+
   std::vector<AliEMCALTriggerRawPatch> patches;
   if (fPatchFinder) {
     if (useL0amp) {
@@ -547,12 +555,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetPatchEnergySmeared(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -578,12 +581,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetPatchEnergySmeared(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -591,6 +589,30 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSummedAreaTable(const AliEMCALTriggerDataGrid<double> &grid, SummedAreaTable &table) const {
+  const int ncols = grid.GetNumberOfCols(), nrows = grid.GetNumberOfRows(), stride = ncols + 1;
+  table.fNCols = ncols;
+  table.fNRows = nrows;
+  table.fSums.assign(stride * (nrows + 1), 0.);
+  for(int irow = 0; irow < nrows; irow++){
+    double rowsum = 0;
+    for(int icol = 0; icol < ncols; icol++){
+      rowsum += grid(icol, irow);
+      table.fSums[(irow + 1) * stride + icol + 1] = table.fSums[irow * stride + icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerMakerKernel::GetSummedArea(const SummedAreaTable &table, Int_t col, Int_t row, Int_t ncols, Int_t nrows) const {
+  if(table.fSums.empty()) return 0.;
+  const int stride = table.fNCols + 1;
+  int colmin = TMath::Max(col, 0), colmax = TMath::Min(col + ncols, table.fNCols),
+      rowmin = TMath::Max(row, 0), rowmax = TMath::Min(row + nrows, table.fNRows);
+  if(colmax <= colmin || rowmax <= rowmin) return 0.;
+  return table.fSums[rowmax * stride + colmax] - table.fSums[rowmin * stride + colmax]
+       - table.fSums[rowmax * stride + colmin] + table.fSums[rowmin * stride + colmin];
+}
+
 double AliEmcalTriggerMakerKernel::GetL0TriggerChannelAmplitude(Int_t col, Int_t row) const{
   double amp = 0;
   try {
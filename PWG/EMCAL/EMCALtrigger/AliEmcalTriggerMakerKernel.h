@@ -169,6 +169,18 @@ public:
    */
   double GetDataGridDimensionRows() const;
 
+  /**
+   * @brief Get the sum of the smeared energies in a square patch (in col-row space)
+   *
+   * Evaluated from the summed-area table built in CreateTriggerPatches, hence
+   * only valid after the trigger patches of the event have been created.
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Patch size in FastORs
+   * @return Sum of the smeared energies in the patch (0 if smearing is disabled)
+   */
+  double GetPatchEnergySmeared(Int_t col, Int_t row, Int_t size) const { return GetSummedArea(fPatchEnergySmearedTable, col, row, size, size); }
+
   /**
    * @brief Define whether running on MC or not (for offset)
    * @param isMC Flag for MC
@@ -473,6 +485,41 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @struct SummedAreaTable
+   * @brief Summed-area table of a data grid, together with the dimensions of the grid
+   *
+   * Entry (col, row) of the table, stored row by row with (fNCols + 1) x (fNRows + 1)
+   * entries, contains the sum of all channels with lower column and row. The sum over
+   * any rectangle of the grid is then obtained from the four table entries at its corners.
+   */
+  struct SummedAreaTable {
+    int                 fNCols;     ///< Number of columns of the grid
+    int                 fNRows;     ///< Number of rows of the grid
+    std::vector<double> fSums;      ///< Partial sums
+
+    SummedAreaTable(): fNCols(0), fNRows(0), fSums() {}
+    void Clear() { fNCols = 0; fNRows = 0; fSums.clear(); }
+  };
+
+  /**
+   * @brief Build the summed-area table of a data grid
+   * @param[in] grid Data grid to be integrated
+   * @param[out] table Summed-area table
+   */
+  void BuildSummedAreaTable(const AliEMCALTriggerDataGrid<double> &grid, SummedAreaTable &table) const;
+
+  /**
+   * @brief Sum of the channels in a rectangle of the data grid from its summed-area table
+   * @param[in] table Summed-area table, see BuildSummedAreaTable
+   * @param[in] col Starting column of the rectangle
+   * @param[in] row Starting row of the rectangle
+   * @param[in] ncols Number of columns of the rectangle
+   * @param[in] nrows Number of rows of the rectangle
+   * @return Sum of the channels in the rectangle, clamped to the grid (0 if the table is empty)
+   */
+  double GetSummedArea(const SummedAreaTable &table, Int_t col, Int_t row, Int_t ncols, Int_t nrows) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -506,11 +553,12 @@ protected:
   AliEMCALTriggerDataGrid<double>           *fPatchEnergySimpleSmeared;   //!<! Data grid for smeared energy values from cell energies
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
+  SummedAreaTable                           fPatchEnergySmearedTable;     //!<! Summed-area table of the smeared energies
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
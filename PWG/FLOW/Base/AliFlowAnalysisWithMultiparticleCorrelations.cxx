@@ -24,6 +24,9 @@
 #define AliFlowAnalysisWithMultiparticleCorrelations_cxx
 
 #include "AliFlowAnalysisWithMultiparticleCorrelations.h"
+#include "AliFlowMultiparticleCorrelator.h"
+#include "TObjArray.h"
+#include <map>
 
 using std::endl;
 using std::cout;
@@ -80,6 +83,9 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fCalculateOnlyForSC(kFALSE),
  fCalculateOnlyCos(kFALSE),
  fCalculateOnlySin(kFALSE),
+ fCorrelator(NULL),
+ fCorrelatorBinsQC(),
+ fCorrelatorBinsSC(),
  // 4.) Event-by-event cumulants:
  fEbECumulantsList(NULL),
  fEbECumulantsFlagsPro(NULL),
@@ -169,6 +175,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleC
  // Destructor.
  
  delete fHistList;
+ delete fCorrelator;
 
 } // end of AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleCorrelations()
 
@@ -205,6 +212,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::Init()
  this->BookEverythingForDiffCorrelations(); 
  this->BookEverythingForSymmetryPlanes();
  this->BookEverythingForEtaGaps();
+ this->BookCorrelator();
 
  // d) Set all flags:
  // ... 
@@ -724,6 +732,31 @@ void AliFlowAnalysisWithMultiparticleCorrelations::InitializeArraysForEtaGaps()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithMultiparticleCorrelations::EvaluateCorrelator()
+{
+ // Evaluate all correlators booked in fCorrelator from the Q-vector components of this event.
+
+ for(Int_t i=0;i<fCorrelator->GetNumberOfQTerms();i++)
+ {
+  fCorrelator->SetQ(i,fQvector[fCorrelator->GetQHarmonic(i)][fCorrelator->GetQPower(i)]);
+ }
+ fCorrelator->Evaluate();
+
+} // void AliFlowAnalysisWithMultiparticleCorrelations::EvaluateCorrelator()
+
+//=======================================================================================================================
+
+Double_t AliFlowAnalysisWithMultiparticleCorrelations::CorrelatorBinValue(const CorrelatorBin &bin, Bool_t numerator) const
+{
+ // Value of the correlation booked for a bin, as CastStringToCorrelation(label,numerator) for its label.
+
+ if(!numerator){return fCorrelator->GetRe(bin.fDenominator);}
+ return bin.fImaginary ? fCorrelator->GetIm(bin.fNumerator) : fCorrelator->GetRe(bin.fNumerator);
+
+} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::CorrelatorBinValue(const CorrelatorBin &bin, Bool_t numerator) const
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlowEventSimple *anEvent)
 {
  // Calculate multi-particle correlations from Q-vector components.
@@ -736,6 +769,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
  if(!anEvent){Fatal(sMethodName.Data(),"'anEvent'!?!? You again!!!!");}
 
  // a) Calculate all booked multi-particle correlations:
+ if(fCorrelator){this->EvaluateCorrelator();}
  Double_t dMultRP = fSelectRandomlyRPs ? fnSelectedRandomlyRPs : anEvent->GetNumberOfRPs(); // TBI shall I promote this variable into data member? 
  if(fSkipSomeIntervals){ dMultRP = dMultRP - fNumberOfSkippedRPParticles; }
  
@@ -749,12 +783,22 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
    Int_t nBins = 0;
    if(fCorrelationsPro[cs][co]){nBins = fCorrelationsPro[cs][co]->GetNbinsX();}
    else{continue;}
+   if(fCorrelator){nBins = fCorrelatorBins[cs][co].size();} // only the labelled bins were booked
    for(Int_t b=1;b<=nBins;b++)
    {
-    TString sBinLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
-    if(sBinLabel.EqualTo("")){break;} 
-    Double_t num = CastStringToCorrelation(sBinLabel.Data(),kTRUE);
-    Double_t den = CastStringToCorrelation(sBinLabel.Data(),kFALSE);
+    Double_t num = 0.;
+    Double_t den = 0.;
+    if(fCorrelator)
+    {
+     num = CorrelatorBinValue(fCorrelatorBins[cs][co][b-1],kTRUE);
+     den = CorrelatorBinValue(fCorrelatorBins[cs][co][b-1],kFALSE);
+    } else
+      {
+       TString sBinLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
+       if(sBinLabel.EqualTo("")){break;} 
+       num = CastStringToCorrelation(sBinLabel.Data(),kTRUE);
+       den = CastStringToCorrelation(sBinLabel.Data(),kFALSE);
+      } // else
     Double_t weight = den; // TBI: add support for other options for the weight eventually
     if(den>0.) 
     {
@@ -943,34 +987,11 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
 
  TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(const char *string, Bool_t numerator)"; 
 
- if(!(TString(string).BeginsWith("Cos") || TString(string).BeginsWith("Sin")))
- {
-  cout<<Form("And the fatal string is... '%s'. Congratulations!!",string)<<endl; 
-  Fatal(sMethodName.Data(),"!(TString(string).BeginsWith(...");
- }
-
  Bool_t bRealPart = kTRUE;
  if(TString(string).BeginsWith("Sin")){bRealPart = kFALSE;}
 
  Int_t n[8] = {0,0,0,0,0,0,0,0}; // harmonics, supporting up to 8p correlations
- UInt_t whichCorr = 0;   
- for(Int_t t=0;t<=TString(string).Length();t++)
- {
-  if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
-  {
-   n[whichCorr] = string[t-1] - '0';
-   if(TString(string[t-2]).EqualTo("-")){n[whichCorr] = -1*n[whichCorr];}
-   if(!(TString(string[t-2]).EqualTo("-") 
-      || TString(string[t-2]).EqualTo(",")
-      || TString(string[t-2]).EqualTo("("))) // TBI relax this eventually to allow two-digits harmonics
-   { 
-    cout<<Form("And the fatal string is... '%s'. Congratulations!!",string)<<endl; 
-    Fatal(sMethodName.Data(),"!(TString(string[t-2]).EqualTo(...");
-   }
-   whichCorr++;
-   if(whichCorr>=9){Fatal(sMethodName.Data(),"whichCorr>=9");} // not supporting corr. beyond 8p 
-  } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
- } // for(UInt_t t=0;t<=TString(string).Length();t++)
+ UInt_t whichCorr = CastStringToHarmonics(string,n);
 
  switch(whichCorr)
  {
@@ -1033,6 +1054,41 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
 
 //=======================================================================================================================
 
+Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)
+{
+ // Cast string of the generic form Cos/Sin(-n_1,-n_2,...,n_{k-1},n_k) into the harmonics n_1,...,n_k. Returns k.
+
+ TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)"; 
+
+ if(!(TString(string).BeginsWith("Cos") || TString(string).BeginsWith("Sin")))
+ {
+  Fatal(sMethodName.Data(),"!(TString(string).BeginsWith(... for '%s'",string);
+ }
+
+ UInt_t whichCorr = 0;   
+ for(Int_t t=0;t<=TString(string).Length();t++)
+ {
+  if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
+  {
+   n[whichCorr] = string[t-1] - '0';
+   if(TString(string[t-2]).EqualTo("-")){n[whichCorr] = -1*n[whichCorr];}
+   if(!(TString(string[t-2]).EqualTo("-") 
+      || TString(string[t-2]).EqualTo(",")
+      || TString(string[t-2]).EqualTo("("))) // TBI relax this eventually to allow two-digits harmonics
+   { 
+    Fatal(sMethodName.Data(),"!(TString(string[t-2]).EqualTo(... for '%s'",string);
+   }
+   whichCorr++;
+   if(whichCorr>=9){Fatal(sMethodName.Data(),"whichCorr>=9");} // not supporting corr. beyond 8p 
+  } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
+ } // for(UInt_t t=0;t<=TString(string).Length();t++)
+
+ return whichCorr;
+
+} // Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D)
 {
  // Calculate products of multi-particle correlations (needed for error propagation).
@@ -1041,18 +1097,34 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateProductsOfCorrelatio
  if(!anEvent){Fatal(sMethodName.Data(),"Sorry, 'anEvent' is on holidays.");} 
  if(!profile2D){Fatal(sMethodName.Data(),"Sorry, 'profile2D' is on holidays.");} 
 
+ // Correlators of the bins, resolved in BookCorrelator():
+ const std::vector<CorrelatorBin> *bins = NULL;
+ if(fCorrelator && profile2D == fProductsQCPro){bins = &fCorrelatorBinsQC;}
+ else if(fCorrelator && profile2D == fProductsSCPro){bins = &fCorrelatorBinsSC;}
+
  Int_t nBins = profile2D->GetXaxis()->GetNbins();
+ if(bins && (Int_t)bins->size() != nBins){bins = NULL;} // not all bins are labelled, cast the labels
  for(Int_t bx=2;bx<=nBins;bx++)
  {
   for(Int_t by=1;by<bx;by++)
   {
    const char *binLabelX = profile2D->GetXaxis()->GetBinLabel(bx);
    const char *binLabelY = profile2D->GetYaxis()->GetBinLabel(by);
-   Double_t numX = this->CastStringToCorrelation(binLabelX,kTRUE); // numerator
-   Double_t denX = this->CastStringToCorrelation(binLabelX,kFALSE); // denominator
+   Double_t numX = 0., denX = 0., numY = 0., denY = 0.;
+   if(bins)
+   {
+    numX = CorrelatorBinValue((*bins)[bx-1],kTRUE); // numerator
+    denX = CorrelatorBinValue((*bins)[bx-1],kFALSE); // denominator
+    numY = CorrelatorBinValue((*bins)[by-1],kTRUE); // numerator
+    denY = CorrelatorBinValue((*bins)[by-1],kFALSE); // denominator
+   } else
+     {
+      numX = this->CastStringToCorrelation(binLabelX,kTRUE); // numerator
+      denX = this->CastStringToCorrelation(binLabelX,kFALSE); // denominator
+      numY = this->CastStringToCorrelation(binLabelY,kTRUE); // numerator
+      denY = this->CastStringToCorrelation(binLabelY,kFALSE); // denominator
+     } // else
    Double_t wX = denX; // weight TBI add support for other options
-   Double_t numY = this->CastStringToCorrelation(binLabelY,kTRUE); // numerator
-   Double_t denY = this->CastStringToCorrelation(binLabelY,kFALSE); // denominator
    Double_t wY = denY; // weight TBI add support for other options
    if(TMath::Abs(denX) > 0. && TMath::Abs(denY) > 0.)
    {
@@ -3111,6 +3183,65 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForEtaGaps()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelator()
+{
+ // Expand all the correlations booked in fCorrelationsPro, and the products for error propagation, into fCorrelator.
+ // The sub-correlators shared by several correlations are then calculated only once per event. 
+ // The bin labels are cast here, once: per event the bins are filled directly from their correlator indices.
+
+ TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelator()"; 
+
+ if(!fCalculateCorrelations){return;}
+
+ delete fCorrelator;
+ fCorrelator = new AliFlowMultiparticleCorrelator();
+
+ TObjArray axes; // all the axes whose bin labels are correlations
+ std::vector<CorrelatorBin> *bins[18] = {NULL}; // correlators of the bins of each axis
+ for(Int_t cs=0;cs<2;cs++) 
+ {
+  for(Int_t co=0;co<8;co++) 
+  {
+   fCorrelatorBins[cs][co].clear();
+   if(fCorrelationsPro[cs][co]){bins[axes.GetEntriesFast()] = &fCorrelatorBins[cs][co]; axes.Add(fCorrelationsPro[cs][co]->GetXaxis());}
+  }
+ }
+ fCorrelatorBinsQC.clear();
+ fCorrelatorBinsSC.clear();
+ if(fProductsQCPro){bins[axes.GetEntriesFast()] = &fCorrelatorBinsQC; axes.Add(fProductsQCPro->GetXaxis());}
+ if(fProductsSCPro){bins[axes.GetEntriesFast()] = &fCorrelatorBinsSC; axes.Add(fProductsSCPro->GetXaxis());}
+
+ std::map<TString,CorrelatorBin> booked; // bin label => correlators, each label is cast only once
+ for(Int_t a=0;a<axes.GetEntriesFast();a++)
+ {
+  TAxis *axis = (TAxis*)axes.At(a);
+  for(Int_t b=1;b<=axis->GetNbins();b++)
+  {
+   TString sBinLabel = axis->GetBinLabel(b);
+   if(sBinLabel.EqualTo("")){break;}
+   std::map<TString,CorrelatorBin>::const_iterator it = booked.find(sBinLabel);
+   if(it == booked.end())
+   {
+    Int_t n[8] = {0,0,0,0,0,0,0,0};
+    Int_t zero[8] = {0,0,0,0,0,0,0,0};
+    Int_t k = CastStringToHarmonics(sBinLabel.Data(),n);
+    CorrelatorBin bin;
+    bin.fNumerator = fCorrelator->AddCorrelator(k,n);
+    bin.fDenominator = fCorrelator->AddCorrelator(k,zero);
+    bin.fImaginary = sBinLabel.BeginsWith("Sin");
+    it = booked.insert(std::make_pair(sBinLabel,bin)).first;
+   }
+   bins[a]->push_back(it->second);
+  } // for(Int_t b=1;b<=axis->GetNbins();b++)
+ } // for(Int_t a=0;a<axes.GetEntriesFast();a++)
+
+ Info(sMethodName.Data(),"Booked %d correlators, with %d terms over %d Q-vector components.",
+      fCorrelator->GetNumberOfCorrelators(),fCorrelator->GetNumberOfNodes(),fCorrelator->GetNumberOfQTerms());
+
+} // void AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelator()
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForEbECumulants()
 {
  // Book all the stuff for event-by-event cumulants.
@@ -30,6 +30,9 @@
 #include "TStopwatch.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include <vector>
+
+class AliFlowMultiparticleCorrelator;
 
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
@@ -72,6 +75,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
    virtual void BookEverythingForDiffCorrelations();
    virtual void BookEverythingForSymmetryPlanes();
    virtual void BookEverythingForEtaGaps();
+   virtual void BookCorrelator();
    
   // 2.) Method Make() and methods called in it:
   virtual void Make(AliFlowEventSimple *anEvent);
@@ -80,6 +84,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
    virtual void DetermineRandomIndices(AliFlowEventSimple *anEvent);
    virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
    virtual void FillQvector(AliFlowEventSimple *anEvent);
+   virtual void EvaluateCorrelator();
    virtual void CalculateCorrelations(AliFlowEventSimple *anEvent);
    virtual void CalculateDiffCorrelations(AliFlowEventSimple *anEvent);
    virtual void CalculateEbECumulants(AliFlowEventSimple *anEvent);
@@ -313,6 +318,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual TComplex FourDiff(Int_t n1, Int_t n2, Int_t n3, Int_t n4);
   virtual Double_t Weight(const Double_t &value, const char *type, const char *variable); // value, [RP,POI], [phi,pt,eta]
   virtual Double_t CastStringToCorrelation(const char *string, Bool_t numerator);
+  virtual Int_t CastStringToHarmonics(const char *string, Int_t *n);
   virtual Double_t Covariance(const char *x, const char *y, TProfile2D *profile2D, Bool_t bUnbiasedEstimator = kFALSE);
   virtual TComplex Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0); // Credits: Kristjan Gulbrandsen (gulbrand@nbi.dk) 
   virtual void CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D);
@@ -325,6 +331,14 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t TrackIsInSpecifiedIntervals(AliFlowTrackSimple *);
 
  private:
+  struct CorrelatorBin {
+   Int_t fNumerator;    // correlator in fCorrelator
+   Int_t fDenominator;  // 'number of combinations' in fCorrelator
+   Bool_t fImaginary;   // Sin(...) label
+  };
+
+  Double_t CorrelatorBinValue(const CorrelatorBin &bin, Bool_t numerator) const;
+
   AliFlowAnalysisWithMultiparticleCorrelations(const AliFlowAnalysisWithMultiparticleCorrelations& afawQc);
   AliFlowAnalysisWithMultiparticleCorrelations& operator=(const AliFlowAnalysisWithMultiparticleCorrelations& afawQc); 
   // Data members are grouped as:
@@ -403,6 +417,10 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateOnlyForSC;         // calculate only correlations needed for 'standard candles'
   Bool_t fCalculateOnlyCos;           // calculate only 'cos' correlations
   Bool_t fCalculateOnlySin;           // calculate only 'sin' correlations
+  AliFlowMultiparticleCorrelator *fCorrelator; //! all booked correlators, expanded once and evaluated once per event
+  std::vector<CorrelatorBin> fCorrelatorBins[2][8]; //! [0=cos,1=sin][1p,2p,...,8p][bin-1] => correlators of the labelled bins of fCorrelationsPro
+  std::vector<CorrelatorBin> fCorrelatorBinsQC; //! [bin-1] => correlators of fProductsQCPro (same labels on both axes)
+  std::vector<CorrelatorBin> fCorrelatorBinsSC; //! [bin-1] => correlators of fProductsSCPro (same labels on both axes)
 
   // 4.) Event-by-event cumulants:
   TList *fEbECumulantsList;         // list to hold all e-b-e cumulants objects
@@ -476,7 +494,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,7);
 
 };
 
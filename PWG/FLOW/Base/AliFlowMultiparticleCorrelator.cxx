@@ -0,0 +1,252 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+#include "AliFlowMultiparticleCorrelator.h"
+
+//********************************************************************
+// AliFlowMultiparticleCorrelator:                                   *
+// Multi-particle correlators from Q-vectors, expanded once into a   *
+// graph shared by all the requested correlators.                    *
+//********************************************************************
+
+ClassImp(AliFlowMultiparticleCorrelator)
+
+//________________________________________________________________________
+
+AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator():
+ TObject(),
+ fOp(),
+ fA(),
+ fB(),
+ fNTerms(),
+ fCoef(),
+ fTerms(),
+ fCorrelators(),
+ fRecursionNodes(),
+ fCorrelatorIndex(),
+ fQNodes(),
+ fQTerms(),
+ fProducts(),
+ fQHarmonic(),
+ fQPower(),
+ fQRe(),
+ fQIm(),
+ fRe(),
+ fIm()
+{
+ // Constructor.
+}
+
+//________________________________________________________________________
+
+AliFlowMultiparticleCorrelator::~AliFlowMultiparticleCorrelator()
+{
+ // Destructor.
+}
+
+//________________________________________________________________________
+
+void AliFlowMultiparticleCorrelator::Clear(Option_t*)
+{
+ // Remove all the correlators.
+
+ fOp.clear(); fA.clear(); fB.clear(); fNTerms.clear(); fCoef.clear(); fTerms.clear();
+ fCorrelators.clear();
+ fRecursionNodes.clear(); fCorrelatorIndex.clear(); fQNodes.clear(); fQTerms.clear(); fProducts.clear();
+ fQHarmonic.clear(); fQPower.clear(); fQRe.clear(); fQIm.clear();
+ fRe.clear(); fIm.clear();
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::AddCorrelator(Int_t n, const Int_t *harmonics)
+{
+ // Book the n-particle correlator <exp[i(h1*phi1+...+hn*phin)]>, which is
+ // not normalized: the correlator with all harmonics 0 is the number of
+ // combinations. Returns its index for GetRe(), GetIm() and GetCorrelator().
+
+ if(n<1 || n>8){Fatal("AliFlowMultiparticleCorrelator::AddCorrelator","n = %d",n);}
+
+ std::vector<Int_t> key(harmonics,harmonics+n);
+ std::map<std::vector<Int_t>,Int_t>::iterator it = fCorrelatorIndex.find(key);
+ if(it != fCorrelatorIndex.end()){return it->second;}
+
+ Int_t harmonic[8];
+ for(Int_t i=0;i<n;i++){harmonic[i] = harmonics[i];}
+ fCorrelators.push_back(Recursion(n,harmonic));
+ fCorrelatorIndex[key] = fCorrelators.size()-1;
+
+ return fCorrelators.size()-1;
+}
+
+//________________________________________________________________________
+
+void AliFlowMultiparticleCorrelator::Evaluate()
+{
+ // Evaluate all the correlators from the Q(n,p) terms of the event.
+
+ Int_t nNodes = fOp.size();
+ for(Int_t i=0;i<nNodes;i++)
+ {
+  Int_t a = fA[i];
+  switch(fOp[i])
+  {
+   case kQ:
+    fRe[i] = fQRe[a];
+    fIm[i] = fQIm[a];
+   break;
+   case kQConjugate:
+    fRe[i] = fQRe[a];
+    fIm[i] = -fQIm[a];
+   break;
+   case kProduct:
+   {
+    Int_t b = fB[i];
+    fRe[i] = fRe[a]*fRe[b] - fIm[a]*fIm[b];
+    fIm[i] = fRe[a]*fIm[b] + fIm[a]*fRe[b];
+   }
+   break;
+   case kCombination:
+   {
+    Double_t sumRe = 0., sumIm = 0.;
+    const Int_t *terms = &fTerms[fB[i]];
+    for(Int_t t=0;t<fNTerms[i];t++)
+    {
+     sumRe += fRe[terms[t]];
+     sumIm += fIm[terms[t]];
+    }
+    fRe[i] = fRe[a] + fCoef[i]*sumRe;
+    fIm[i] = fIm[a] + fCoef[i]*sumIm;
+   }
+   break;
+  } // switch(fOp[i])
+ } // for(Int_t i=0;i<nNodes;i++)
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+{
+ // Symbolic version of AliFlowAnalysisWithMultiparticleCorrelations::Recursion(),
+ // returning the node of the result. Identical calls share their node.
+
+ std::vector<Int_t> key(3+n);
+ key[0] = n; key[1] = mult; key[2] = skip;
+ for(Int_t i=0;i<n;i++){key[3+i] = harmonic[i];}
+ std::map<std::vector<Int_t>,Int_t>::iterator it = fRecursionNodes.find(key);
+ if(it != fRecursionNodes.end()){return it->second;}
+
+ Int_t nm1 = n-1;
+ Int_t c = QNode(harmonic[nm1],mult);
+ if(nm1 == 0){return fRecursionNodes[key] = c;}
+ c = ProductNode(c,Recursion(nm1,harmonic));
+ if(nm1 == skip){return fRecursionNodes[key] = c;}
+
+ std::vector<Int_t> c2;
+ Int_t multp1 = mult+1;
+ Int_t nm2 = n-2;
+ Int_t counter1 = 0;
+ Int_t hhold = harmonic[counter1];
+ harmonic[counter1] = harmonic[nm2];
+ harmonic[nm2] = hhold + harmonic[nm1];
+ c2.push_back(Recursion(nm1,harmonic,multp1,nm2));
+ Int_t counter2 = n-3;
+ while(counter2 >= skip)
+ {
+  harmonic[nm2] = harmonic[counter1];
+  harmonic[counter1] = hhold;
+  ++counter1;
+  hhold = harmonic[counter1];
+  harmonic[counter1] = harmonic[nm2];
+  harmonic[nm2] = hhold + harmonic[nm1];
+  c2.push_back(Recursion(nm1,harmonic,multp1,counter2));
+  --counter2;
+ }
+ harmonic[nm2] = harmonic[counter1];
+ harmonic[counter1] = hhold;
+
+ return fRecursionNodes[key] = CombinationNode(c,-1.*mult,c2);
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::QNode(Int_t n, Int_t p)
+{
+ // Node of Q(n,p), using Q(-n,p) = Q(n,p)^*.
+
+ std::pair<Int_t,Int_t> key(n,p);
+ std::map<std::pair<Int_t,Int_t>,Int_t>::iterator it = fQNodes.find(key);
+ if(it != fQNodes.end()){return it->second;}
+
+ std::pair<Int_t,Int_t> term(n>=0 ? n : -n,p);
+ std::map<std::pair<Int_t,Int_t>,Int_t>::iterator itTerm = fQTerms.find(term);
+ Int_t iTerm = 0;
+ if(itTerm != fQTerms.end()){iTerm = itTerm->second;}
+ else
+ {
+  iTerm = fQHarmonic.size();
+  fQHarmonic.push_back(term.first);
+  fQPower.push_back(p);
+  fQRe.push_back(0.);
+  fQIm.push_back(0.);
+  fQTerms[term] = iTerm;
+ }
+
+ return fQNodes[key] = AddNode(n>=0 ? kQ : kQConjugate,iTerm,0,0.);
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::ProductNode(Int_t a, Int_t b)
+{
+ // Node of a*b.
+
+ std::pair<Int_t,Int_t> key(a,b);
+ std::map<std::pair<Int_t,Int_t>,Int_t>::iterator it = fProducts.find(key);
+ if(it != fProducts.end()){return it->second;}
+
+ return fProducts[key] = AddNode(kProduct,a,b,0.);
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::CombinationNode(Int_t a, Double_t coef, const std::vector<Int_t> &terms)
+{
+ // Node of a + coef*(sum of terms). Only reached once per distinct recursion call,
+ // so it does not need its own deduplication.
+
+ Int_t node = AddNode(kCombination,a,fTerms.size(),coef);
+ fTerms.insert(fTerms.end(),terms.begin(),terms.end());
+ fNTerms[node] = terms.size();
+
+ return node;
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowMultiparticleCorrelator::AddNode(Int_t op, Int_t a, Int_t b, Double_t coef)
+{
+ // Append a node, after all the nodes it depends on.
+
+ fOp.push_back(op);
+ fA.push_back(a);
+ fB.push_back(b);
+ fNTerms.push_back(0);
+ fCoef.push_back(coef);
+ fRe.push_back(0.);
+ fIm.push_back(0.);
+
+ return fOp.size()-1;
+}
@@ -0,0 +1,86 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef ALIFLOWMULTIPARTICLECORRELATOR_H
+#define ALIFLOWMULTIPARTICLECORRELATOR_H
+
+#include <map>
+#include <vector>
+
+#include "TObject.h"
+#include "TComplex.h"
+
+//********************************************************************
+// AliFlowMultiparticleCorrelator:                                   *
+// Multi-particle correlators <exp[i(n1*phi1+...+nk*phik)]> from     *
+// Q-vectors Q(n,p), for any set of harmonics up to 8 particles.     *
+// At setup the recursion of K. Gulbrandsen is expanded once for all *
+// the requested correlators into a graph over the Q(n,p) terms, in  *
+// which the sub-correlators shared by several correlators appear    *
+// only once. Per event the user sets the Q(n,p) terms listed by     *
+// GetQHarmonic(i) and GetQPower(i) (n >= 0) and calls Evaluate().   *
+//********************************************************************
+
+class AliFlowMultiparticleCorrelator: public TObject {
+ public:
+  AliFlowMultiparticleCorrelator();
+  virtual ~AliFlowMultiparticleCorrelator();
+  virtual void Clear(Option_t *option="");
+
+  // Setup:
+  Int_t AddCorrelator(Int_t n, const Int_t *harmonics); // returns the index of the correlator
+  Int_t GetNumberOfCorrelators() const {return (Int_t)fCorrelators.size();}
+  Int_t GetNumberOfNodes() const {return (Int_t)fOp.size();}
+  Int_t GetNumberOfQTerms() const {return (Int_t)fQHarmonic.size();}
+  Int_t GetQHarmonic(Int_t i) const {return fQHarmonic[i];}
+  Int_t GetQPower(Int_t i) const {return fQPower[i];}
+
+  // Per event:
+  void SetQ(Int_t i, Double_t re, Double_t im) {fQRe[i] = re; fQIm[i] = im;}
+  void SetQ(Int_t i, const TComplex &q) {fQRe[i] = q.Re(); fQIm[i] = q.Im();}
+  void Evaluate();
+  Double_t GetRe(Int_t i) const {return fRe[fCorrelators[i]];}
+  Double_t GetIm(Int_t i) const {return fIm[fCorrelators[i]];}
+  TComplex GetCorrelator(Int_t i) const {return TComplex(GetRe(i),GetIm(i));}
+
+ private:
+  AliFlowMultiparticleCorrelator(const AliFlowMultiparticleCorrelator& c);
+  AliFlowMultiparticleCorrelator& operator=(const AliFlowMultiparticleCorrelator& c);
+
+  enum {kQ, kQConjugate, kProduct, kCombination};
+
+  Int_t Recursion(Int_t n, Int_t *harmonic, Int_t mult = 1, Int_t skip = 0);
+  Int_t QNode(Int_t n, Int_t p);
+  Int_t ProductNode(Int_t a, Int_t b);
+  Int_t CombinationNode(Int_t a, Double_t coef, const std::vector<Int_t> &terms);
+  Int_t AddNode(Int_t op, Int_t a, Int_t b, Double_t coef);
+
+  // Graph, nodes in evaluation order:
+  std::vector<Int_t> fOp;       //! operation of each node
+  std::vector<Int_t> fA;        //! Q term (kQ, kQConjugate) or first operand
+  std::vector<Int_t> fB;        //! second operand (kProduct) or first of the summed terms in fTerms (kCombination)
+  std::vector<Int_t> fNTerms;   //! number of summed terms (kCombination)
+  std::vector<Double_t> fCoef;  //! kCombination: a + coef*(sum of terms)
+  std::vector<Int_t> fTerms;    //! summed terms of the kCombination nodes
+  std::vector<Int_t> fCorrelators; //! node of each requested correlator
+
+  // Deduplication:
+  std::map<std::vector<Int_t>,Int_t> fRecursionNodes; //! (n,mult,skip,harmonics) -> node
+  std::map<std::vector<Int_t>,Int_t> fCorrelatorIndex; //! harmonics -> correlator
+  std::map<std::pair<Int_t,Int_t>,Int_t> fQNodes;     //! (n,p) -> node
+  std::map<std::pair<Int_t,Int_t>,Int_t> fQTerms;     //! (|n|,p) -> Q term
+  std::map<std::pair<Int_t,Int_t>,Int_t> fProducts;   //! (a,b) -> node
+
+  // Values:
+  std::vector<Int_t> fQHarmonic; //! harmonic of each Q term
+  std::vector<Int_t> fQPower;    //! power of each Q term
+  std::vector<Double_t> fQRe;    //! Q terms of the event
+  std::vector<Double_t> fQIm;    //!
+  std::vector<Double_t> fRe;     //! node values of the event
+  std::vector<Double_t> fIm;     //!
+
+  ClassDef(AliFlowMultiparticleCorrelator,1);
+};
+
+#endif
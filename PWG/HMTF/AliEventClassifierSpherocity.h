@@ -2,11 +2,12 @@
 #define AliEventClassifierSpherocity_cxx
 
 #include "AliEventClassifierBase.h"
+#include "AliEventShapeCalculator.h"
 
 class AliEventClassifierSpherocity : public AliEventClassifierBase {
  public:
   AliEventClassifierSpherocity()
-    : AliEventClassifierBase() {}
+    : AliEventClassifierBase(), fEventShape() {}
   AliEventClassifierSpherocity(const char* name, const char* title,
 			TList *taskOutputList);
   virtual ~AliEventClassifierSpherocity() {}
@@ -14,8 +15,10 @@ class AliEventClassifierSpherocity : public AliEventClassifierBase {
  private:
   Bool_t TrackPassesSelection(AliMCParticle* track, AliStack *stack, Int_t iTrack);
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
+
+  AliEventShapeCalculator fEventShape;  //! Particles of the current event
   
-  ClassDef(AliEventClassifierSpherocity, 1);
+  ClassDef(AliEventClassifierSpherocity, 2);
 };
 
 #endif
@@ -239,6 +239,15 @@ AliEmcalJet* AliJetContainer::GetLeadingJet(const char* opt)
   TString option(opt);
   option.ToLower();
 
+  if (fUseKinematicsCache && !option.Contains("rho")) {
+    const std::vector<Int_t> &acc = GetAcceptedIndices();
+    Int_t iMax = -1;
+    for (std::vector<Int_t>::const_iterator it = acc.begin(); it != acc.end(); ++it) {
+      if (iMax < 0 || GetCachedPt(*it) > GetCachedPt(iMax)) iMax = *it;
+    }
+    return iMax < 0 ? 0 : GetJet(iMax);
+  }
+
   Int_t tempID = fCurrentID;
   ResetCurrentID();
 
@@ -285,6 +294,7 @@ AliEmcalJet* AliJetContainer::GetAcceptJet(Int_t i) const
 {
   UInt_t rejectionReason = 0;
   AliEmcalJet *jet = GetJet(i);
+  if (fUseKinematicsCache) return (jet && IsCachedAccepted(i)) ? jet : 0;
   if(!AcceptJet(jet, rejectionReason)) return 0;
 
   return jet;
@@ -789,6 +799,7 @@ void AliJetContainer::ResetCuts()
   fLeadingHadronType = 0;
   fZLeadingEmcCut = 10.;
   fZLeadingChCut  = 10.;
+  ResetKinematicsCache();
 }
 
 /**
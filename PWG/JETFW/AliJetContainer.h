@@ -93,7 +93,7 @@ class AliJetContainer : public AliParticleContainer {
   void LoadLocalRho(const AliVEvent *event);
   void LoadRhoMass(const AliVEvent *event);
 
-  void                        SetJetAcceptanceType(UInt_t type)         { fJetAcceptanceType          = type ; }
+  void                        SetJetAcceptanceType(UInt_t type)         { fJetAcceptanceType          = type ; ResetKinematicsCache(); }
   void                        PrintCuts();
   void                        ResetCuts();
   void                        SetJetEtaLimits(Float_t min, Float_t max)            { SetEtaLimits(min, max)             ; }
@@ -102,31 +102,31 @@ class AliJetContainer : public AliParticleContainer {
   void                        SetJetPtCutMax(Float_t cut)                          { SetMaxPt(cut)                      ; }
   void                        SetRunNumber(Int_t r)                                { fRunNumber = r;                      }
   void                        SetJetRadius(Float_t r)                              { fJetRadius      = r                ; } 
-  void                        SetJetAreaCut(Float_t cut)                           { fJetAreaCut     = cut              ; }
+  void                        SetJetAreaCut(Float_t cut)                           { fJetAreaCut     = cut              ; ResetKinematicsCache(); }
   void                        SetPercAreaCut(Float_t p)                            { if(fJetRadius==0.) AliWarning("JetRadius not set. Area cut will be 0"); 
-                                                                                     fJetAreaCut = p*TMath::Pi()*fJetRadius*fJetRadius; }
-  void                        SetAreaEmcCut(Double_t a = 0.99)                     { fAreaEmcCut     = a                ; }
-  void                        SetZLeadingCut(Float_t zemc, Float_t zch)            { fZLeadingEmcCut = zemc; fZLeadingChCut = zch ; }
-  void                        SetNEFCut(Float_t min = 0., Float_t max = 1.)        { fNEFMinCut = min; fNEFMaxCut = max;  }
-  void                        SetFlavourCut(Int_t myflavour)                       { fFlavourSelection = myflavour;}
-  void                        SetMinClusterPt(Float_t b)                           { fMinClusterPt   = b                ; }
-  void                        SetMaxClusterPt(Float_t b)                           { fMaxClusterPt   = b                ; }
-  void                        SetMinTrackPt(Float_t b)                             { fMinTrackPt     = b                ; }
-  void                        SetMaxTrackPt(Float_t b)                             { fMaxTrackPt     = b                ; }
+                                                                                     fJetAreaCut = p*TMath::Pi()*fJetRadius*fJetRadius; ResetKinematicsCache(); }
+  void                        SetAreaEmcCut(Double_t a = 0.99)                     { fAreaEmcCut     = a                ; ResetKinematicsCache(); }
+  void                        SetZLeadingCut(Float_t zemc, Float_t zch)            { fZLeadingEmcCut = zemc; fZLeadingChCut = zch ; ResetKinematicsCache(); }
+  void                        SetNEFCut(Float_t min = 0., Float_t max = 1.)        { fNEFMinCut = min; fNEFMaxCut = max; ResetKinematicsCache(); }
+  void                        SetFlavourCut(Int_t myflavour)                       { fFlavourSelection = myflavour; ResetKinematicsCache(); }
+  void                        SetMinClusterPt(Float_t b)                           { fMinClusterPt   = b                ; ResetKinematicsCache(); }
+  void                        SetMaxClusterPt(Float_t b)                           { fMaxClusterPt   = b                ; ResetKinematicsCache(); }
+  void                        SetMinTrackPt(Float_t b)                             { fMinTrackPt     = b                ; ResetKinematicsCache(); }
+  void                        SetMaxTrackPt(Float_t b)                             { fMaxTrackPt     = b                ; ResetKinematicsCache(); }
   void                        SetPtBiasJetClus(Float_t b)                          { SetMinClusterPt(b)                 ; }
   void                        SetNLeadingJets(Int_t t)                             { fNLeadingJets   = t                ; }
-  void                        SetMinNConstituents(Int_t n)                         { fMinNConstituents = n              ; }
+  void                        SetMinNConstituents(Int_t n)                         { fMinNConstituents = n              ; ResetKinematicsCache(); }
   void                        SetPtBiasJetTrack(Float_t b)                         { SetMinTrackPt(b)                   ; }
-  void                        SetLeadingHadronType(Int_t t)                        { fLeadingHadronType = t             ; }
+  void                        SetLeadingHadronType(Int_t t)                        { fLeadingHadronType = t             ; ResetKinematicsCache(); }
   void                        SetJetTrigger(UInt_t t=AliVEvent::kEMCEJE)           { fJetTrigger     = t                ; }
-  void                        SetTagStatus(Int_t i)                                { fTagStatus      = i                ; }
+  void                        SetTagStatus(Int_t i)                                { fTagStatus      = i                ; ResetKinematicsCache(); }
 
   void                        SetRhoName(const char *n)                            { fRhoName        = n                ; }
   void                        SetLocalRhoName(const char *n)                       { fLocalRhoName   = n                ; }
   void                        SetRhoMassName(const char *n)                        { fRhoMassName    = n                ; }
     
-  void                        SetTpcHolePos(Double_t b)                                {fTpcHolePos       =   b     ;}
-  void                        SetTpcHoleWidth(Double_t b)                             {fTpcHoleWidth    =   b     ;} 
+  void                        SetTpcHolePos(Double_t b)                                {fTpcHolePos       =   b     ; ResetKinematicsCache(); }
+  void                        SetTpcHoleWidth(Double_t b)                             {fTpcHoleWidth    =   b     ; ResetKinematicsCache(); } 
 
 
   void                        ConnectParticleContainer(AliParticleContainer *c)    { fParticleContainer = c             ; }
@@ -0,0 +1,179 @@
+// $Id$
+//
+// Transverse event shapes (spherocity, sphericity and thrust) of a set of
+// particles, computed exactly from their transverse momenta.
+//
+// Fill the momenta of the event with AddParticle() or AddMomentum(), call
+// Compute() and read the shapes; Clear() before the next event keeps the
+// buffers allocated.
+//
+// The spherocity is
+//   S0 = pi^2/4 min_n ( sum |pT_i x n| / sum pT_i )^2
+// As a function of the axis angle the sum is concave between two
+// consecutive track directions (modulo pi), so the minimum lies along one
+// of the tracks. With the momenta folded into the upper half plane and
+// sorted by azimuth, sum |pT_i x n| along track k is n x (sum of the
+// momenta after k - sum of the momenta before k), i.e. O(1) per track
+// from prefix sums. The thrust
+//   T = max_n sum |pT_i . n| / sum pT_i
+// is the largest |sum of the momenta on one side of a line - sum on the
+// other side|, obtained from the same prefix sums. The whole computation
+// is O(N log N), for the sort, instead of the O(N x steps) scan of trial
+// axes, and gives the true minimum rather than the one on the grid.
+//
+// The sphericity is the transverse linearized one, from the pT-weighted
+// momentum tensor: 2 lambda_min / (lambda_1 + lambda_2).
+
+#include "AliEventShapeCalculator.h"
+
+#include <algorithm>
+
+#include <TMath.h>
+
+ClassImp(AliEventShapeCalculator)
+
+//________________________________________________________________________
+AliEventShapeCalculator::AliEventShapeCalculator() :
+  TObject(),
+  fPx(),
+  fPy(),
+  fDirections(),
+  fSumPt(0),
+  fSpherocity(-1),
+  fSpherocityAxis(0),
+  fSphericity(-1),
+  fThrust(-1),
+  fThrustAxis(0)
+{
+  // Constructor.
+
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::Clear(Option_t * /*option*/)
+{
+  // Remove the particles of the previous event.
+
+  fPx.clear();
+  fPy.clear();
+  fSumPt          = 0;
+  fSpherocity     = -1;
+  fSpherocityAxis = 0;
+  fSphericity     = -1;
+  fThrust         = -1;
+  fThrustAxis     = 0;
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::AddParticle(Double_t pt, Double_t phi)
+{
+  // Add a particle from its transverse momentum and azimuth.
+
+  AddMomentum(pt*TMath::Cos(phi), pt*TMath::Sin(phi));
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::AddMomentum(Double_t px, Double_t py)
+{
+  // Add a particle from its transverse momentum components.
+  // Particles with zero transverse momentum do not change the shapes and are ignored.
+
+  if (px == 0 && py == 0) return;
+  fPx.push_back(px);
+  fPy.push_back(py);
+}
+
+//________________________________________________________________________
+Bool_t AliEventShapeCalculator::Compute()
+{
+  // Compute the event shapes of the particles added since the last Clear().
+  // Returns kFALSE, with all the shapes set to -1, if there is no particle.
+
+  fSpherocity = -1;
+  fSphericity = -1;
+  fThrust     = -1;
+  fSumPt      = 0;
+
+  Int_t n = fPx.size();
+  if (n == 0) return kFALSE;
+
+  // single pass: scalar sum, sphericity tensor and folded directions
+  Double_t s00 = 0, s01 = 0, s11 = 0;
+  fDirections.resize(n);
+  for (Int_t i = 0; i < n; i++) {
+    Double_t px = fPx[i];
+    Double_t py = fPy[i];
+    Double_t pt = TMath::Sqrt(px*px + py*py);
+    fSumPt += pt;
+    s00 += px*px/pt;
+    s01 += px*py/pt;
+    s11 += py*py/pt;
+
+    // |p x n| and |p . n| do not change under p -> -p
+    if (py < 0 || (py == 0 && px < 0)) {
+      px = -px;
+      py = -py;
+    }
+    Direction &d = fDirections[i];
+    d.fAlpha = TMath::ATan2(py, px);
+    if (d.fAlpha >= TMath::Pi()) d.fAlpha = 0;
+    d.fQx = px;
+    d.fQy = py;
+  }
+
+  // sphericity
+  Double_t S00 = s00/fSumPt;
+  Double_t S01 = s01/fSumPt;
+  Double_t S11 = s11/fSumPt;
+  Double_t trace = S00 + S11;
+  Double_t root = TMath::Sqrt(TMath::Max(trace*trace - 4*(S00*S11 - S01*S01), 0.));
+  Double_t lambda1 = (trace + root)/2;
+  Double_t lambda2 = (trace - root)/2;
+  fSphericity = trace != 0 ? 2*TMath::Min(lambda1, lambda2)/trace : 0;
+
+  std::sort(fDirections.begin(), fDirections.end());
+
+  Double_t sumQx = 0, sumQy = 0;
+  for (Int_t i = 0; i < n; i++) {
+    sumQx += fDirections[i].fQx;
+    sumQy += fDirections[i].fQy;
+  }
+
+  // before[k] = sum of the folded momenta with smaller azimuth than k
+  Double_t beforeX = 0, beforeY = 0;
+  Double_t minCross = -1, maxV2 = -1;
+  for (Int_t k = 0; k < n; k++) {
+    const Direction &d = fDirections[k];
+
+    // thrust: line just below track k, momenta from k on against the ones before
+    Double_t vx = sumQx - 2*beforeX;
+    Double_t vy = sumQy - 2*beforeY;
+    Double_t v2 = vx*vx + vy*vy;
+    if (v2 > maxV2) {
+      maxV2 = v2;
+      fThrustAxis = TMath::ATan2(vy, vx);
+    }
+
+    // spherocity: axis along track k
+    Double_t q = TMath::Sqrt(d.fQx*d.fQx + d.fQy*d.fQy);
+    Double_t afterX = sumQx - beforeX - d.fQx;
+    Double_t afterY = sumQy - beforeY - d.fQy;
+    Double_t cross = TMath::Abs(d.fQx*(afterY - beforeY) - d.fQy*(afterX - beforeX))/q;
+    if (minCross < 0 || cross < minCross) {
+      minCross = cross;
+      fSpherocityAxis = d.fAlpha;
+    }
+
+    beforeX += d.fQx;
+    beforeY += d.fQy;
+  }
+
+  if (fThrustAxis < 0) fThrustAxis += TMath::Pi();
+  if (fThrustAxis >= TMath::Pi()) fThrustAxis -= TMath::Pi();
+
+  Double_t ratio = minCross/fSumPt;
+  fSpherocity = ratio*ratio*TMath::Pi()*TMath::Pi()/4;
+  fThrust = TMath::Sqrt(maxV2)/fSumPt;
+
+  return kTRUE;
+}
@@ -0,0 +1,51 @@
+#ifndef ALIEVENTSHAPECALCULATOR_H
+#define ALIEVENTSHAPECALCULATOR_H
+
+// $Id$
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliEventShapeCalculator : public TObject {
+ public:
+  AliEventShapeCalculator();
+  virtual ~AliEventShapeCalculator() {}
+
+  void     Clear(Option_t *option="");
+  void     AddParticle(Double_t pt, Double_t phi);
+  void     AddMomentum(Double_t px, Double_t py);
+  Bool_t   Compute();
+
+  Int_t    GetNParticles()        const { return fPx.size();        }
+  Double_t GetSumPt()             const { return fSumPt;            }
+  Double_t GetSpherocity()        const { return fSpherocity;       }
+  Double_t GetSpherocityAxisPhi() const { return fSpherocityAxis;   }
+  Double_t GetSphericity()        const { return fSphericity;       }
+  Double_t GetThrust()            const { return fThrust;           }
+  Double_t GetThrustAxisPhi()     const { return fThrustAxis;       }
+
+ private:
+  AliEventShapeCalculator(const AliEventShapeCalculator&);             // not implemented
+  AliEventShapeCalculator& operator=(const AliEventShapeCalculator&);  // not implemented
+
+  struct Direction {
+    Double_t fAlpha;          // azimuth of the folded momentum, in [0,pi)
+    Double_t fQx;             // folded momentum
+    Double_t fQy;             //
+    bool operator<(const Direction &d) const { return fAlpha < d.fAlpha; }
+  };
+
+  std::vector<Double_t>  fPx;             //! transverse momenta of the event
+  std::vector<Double_t>  fPy;             //!
+  std::vector<Direction> fDirections;     //! work buffer, sorted by azimuth
+  Double_t               fSumPt;          //! scalar sum of the transverse momenta
+  Double_t               fSpherocity;     //! transverse spherocity, -1 if not computed
+  Double_t               fSpherocityAxis; //! azimuth of the spherocity axis, in [0,pi)
+  Double_t               fSphericity;     //! transverse linearized sphericity, -1 if not computed
+  Double_t               fThrust;         //! transverse thrust, -1 if not computed
+  Double_t               fThrustAxis;     //! azimuth of the thrust axis, in [0,pi)
+
+  ClassDef(AliEventShapeCalculator, 1); // Exact transverse event shapes
+};
+#endif
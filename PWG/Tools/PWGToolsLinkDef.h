@@ -6,6 +6,7 @@
 
 #pragma link C++ class AliAnalysisHelperJetTasks+;
 #pragma link C++ class AliBasicParticle+;
+#pragma link C++ class AliEventShapeCalculator+;
 #pragma link C++ class AliFigure+;
 #pragma link C++ class AliCanvas+;
 #pragma link C++ class AliHelperPID+;
@@ -14,6 +14,7 @@
 #include "AliMFTAnalysisTools.h"
 #include "TRandom.h"
 #include "TList.h"
+#include "TVectorD.h"
 
 ClassImp(AliAnalysisTaskDimuonBackground)
 
@@ -172,6 +173,9 @@ void AliAnalysisTaskDimuonBackground::UserCreateOutputObjects() {
   SetMainInputHandler(mgr);
   if (fMainInputHandler) SetMixingInputHandler(fMainInputHandler);
 
+  // the muons of the mixed events are taken from the cache of the mixing handler, if enabled
+  if (fMixingInputHandler && fMixingInputHandler->MixedEventCacheSize() > 0) fMixingInputHandler->RegisterMixedEventCacheUser(this);
+
   PostData(1, fHistogramList);
 
 }
@@ -287,6 +291,9 @@ void AliAnalysisTaskDimuonBackground::UserExec(Option_t *) {
   }   // end of loop on 1st muon
 
   //--------------------------------------------------------------------------------
+
+  // keep the muons of this event for the mixing with the following events
+  if (fMixingInputHandler && fMixingInputHandler->MixedEventCacheSize() > 0) fMixingInputHandler->CacheMixedEvent(this, GetMuonsForMixing(aodEv));
   
   PostData(1, fHistogramList);
 
@@ -333,23 +340,26 @@ void AliAnalysisTaskDimuonBackground::UserExecMix(Option_t *) {
 
   for (Int_t iBuffer=0; iBuffer<bufferSize; iBuffer++) {
 
-    AliAODEvent *aodEvMix = dynamic_cast<AliAODEvent *>(GetMixedEvent(iBuffer));
-    if (!aodEvMix) continue;
+    // muons of the mixed event, from the cache of the mixing handler or from the event read from the chain
+    TObjArray *muonsMixEv = dynamic_cast<TObjArray *>(fMixingInputHandler->GetCachedMixedEvent(this, iBuffer));
+    Bool_t isCached = (muonsMixEv != 0);
+    if (!isCached) {
+      AliAODEvent *aodEvMix = dynamic_cast<AliAODEvent *>(GetMixedEvent(iBuffer));
+      if (!aodEvMix) continue;
+      muonsMixEv = GetMuonsForMixing(aodEvMix);
+    }
 
     // Getting primary vertex, either from the generation or from the reconstruction -------------------
     
-    AliAODMCHeader *mcHeaderMixEv = (AliAODMCHeader*) (aodEvMix->GetList()->FindObject(AliAODMCHeader::StdBranchName()));
-    mcHeaderMixEv->GetVertex(fPrimaryVertexMixEvTrue);
+    const TVectorD &vertexMixEv = *(static_cast<TVectorD *>(muonsMixEv->At(0)));
+    for (Int_t i=0; i<3; i++) fPrimaryVertexMixEvTrue[i] = vertexMixEv[i];
  
     if (fVertexMode == kGenerated) {
-      mcHeaderMixEv->GetVertex(fPrimaryVertexMixEv);
-      for (Int_t i=0; i<3; i++) fPrimaryVertexMixEv[i] = gRandom->Gaus(fPrimaryVertexMixEv[i], fVtxResolutionITS[i]);
+      for (Int_t i=0; i<3; i++) fPrimaryVertexMixEv[i] = gRandom->Gaus(vertexMixEv[i], fVtxResolutionITS[i]);
     }
     else if (fVertexMode == kReconstructed) {
-      aodEvMix->GetPrimaryVertex()->GetXYZ(fPrimaryVertexMixEv);
+      for (Int_t i=0; i<3; i++) fPrimaryVertexMixEv[i] = vertexMixEv[3+i];
     }
-
-    TClonesArray *stackMCMixEv = (TClonesArray*) (aodEvMix->GetList()->FindObject(AliAODMCParticle::StdBranchName()));
   
     // Loop over MUON+MFT muons of 1st and 2nd events
     
@@ -362,12 +372,9 @@ void AliAnalysisTaskDimuonBackground::UserExecMix(Option_t *) {
       if (AliMFTAnalysisTools::IsTrackInjected(recMuon[0], mcHeader, stackMC)) continue;    // Only HIJING tracks are considered to build the background
       if (!IsSingleMuonCutPassed(recMuon[0]))                                  continue;
 
-      for (Int_t jTrack=0; jTrack<aodEvMix->GetNumberOfTracks(); jTrack++) { 
+      for (Int_t jTrack=1; jTrack<muonsMixEv->GetEntriesFast(); jTrack++) { 
 
-	recMuon[1] = (AliAODTrack*) aodEvMix->GetTrack(jTrack);
-	if (!(recMuon[1]->IsMuonGlobalTrack()))                                            continue;
-	if (AliMFTAnalysisTools::IsTrackInjected(recMuon[1], mcHeaderMixEv, stackMCMixEv)) continue;    // Only HIJING tracks are considered to build the background
-	if (!IsSingleMuonCutPassed(recMuon[1]))                                            continue;
+	recMuon[1] = (AliAODTrack*) muonsMixEv->At(jTrack);    // selected as in UserExec() by GetMuonsForMixing()
 
 	// ----------- Translating muons to a common primary vertex (the origin). Preserve original tracks in case one wants to use them
 
@@ -422,6 +429,8 @@ void AliAnalysisTaskDimuonBackground::UserExecMix(Option_t *) {
     }   // end of loop on 1st muon
     
     //--------------------------------------------------------------------------------------------------
+
+    if (!isCached) delete muonsMixEv;
    
   }   // end of loop on events in buffer
 
@@ -510,6 +519,40 @@ AliMixInputEventHandler *AliAnalysisTaskDimuonBackground::SetMixingInputHandler(
 
 //====================================================================================================================================================
 
+TObjArray *AliAnalysisTaskDimuonBackground::GetMuonsForMixing(AliAODEvent *aodEv) {
+
+  // Reduced copy of the event used for the mixing (owned by the caller):
+  // a TVectorD with the generated and reconstructed primary vertex, followed by
+  // copies of the non injected global muons passing the single muon cuts
+
+  AliAODMCHeader *mcHeader = (AliAODMCHeader*) (aodEv->GetList()->FindObject(AliAODMCHeader::StdBranchName()));
+  TClonesArray *stackMC = (TClonesArray*) (aodEv->GetList()->FindObject(AliAODMCParticle::StdBranchName()));
+
+  TObjArray *muons = new TObjArray();
+  muons->SetOwner(kTRUE);
+
+  Double_t vertex[3] = {0};
+  TVectorD *vertices = new TVectorD(6);
+  mcHeader->GetVertex(vertex);
+  for (Int_t i=0; i<3; i++) (*vertices)[i] = vertex[i];
+  aodEv->GetPrimaryVertex()->GetXYZ(vertex);
+  for (Int_t i=0; i<3; i++) (*vertices)[3+i] = vertex[i];
+  muons->Add(vertices);
+
+  for (Int_t iTrack=0; iTrack<aodEv->GetNumberOfTracks(); iTrack++) { 
+    AliAODTrack *recMuon = (AliAODTrack*) aodEv->GetTrack(iTrack);
+    if (!(recMuon->IsMuonGlobalTrack()))                                  continue;
+    if (AliMFTAnalysisTools::IsTrackInjected(recMuon, mcHeader, stackMC)) continue;    // Only HIJING tracks are considered to build the background
+    if (!IsSingleMuonCutPassed(recMuon))                                  continue;
+    muons->Add(new AliAODTrack(*recMuon));
+  }
+
+  return muons;
+
+}
+
+//====================================================================================================================================================
+
 Bool_t AliAnalysisTaskDimuonBackground::IsSingleMuonCutPassed(AliAODTrack *mu) {
 
   if (mu->GetMatchTrigger() < fMinTriggerMatch)                   return kFALSE;
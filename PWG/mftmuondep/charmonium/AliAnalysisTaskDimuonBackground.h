@@ -10,6 +10,9 @@
 #include "AliAODTrack.h"
 #include "THnSparse.h"
 
+class AliAODEvent;
+class TObjArray;
+
 //====================================================================================================================================================
 
 class  AliAnalysisTaskDimuonBackground : public AliAnalysisTaskSE {
@@ -50,6 +53,7 @@ public:
   AliMixInputEventHandler* SetMixingInputHandler(AliMultiInputEventHandler *mainIH);
 
   Bool_t IsSingleMuonCutPassed(AliAODTrack *mu);
+  TObjArray* GetMuonsForMixing(AliAODEvent *aodEv);
 
 private:
 
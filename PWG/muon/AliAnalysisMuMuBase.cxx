@@ -69,7 +69,11 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fHistoHandleIndex(),
+fHistoHandlePaths(),
+fHistoHandleNames(),
+fHistoHandleObjects()
 {
  /// default ctor
 }
@@ -465,6 +469,136 @@ TH1* AliAnalysisMuMuBase::Histo(const char* eventSelection,
   return fHistogramCollection ? fHistogramCollection->Histo(Form("/%s/%s/%s/%s",eventSelection,triggerClassName,cent,what),histoname) : 0x0;
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::HistoHandle(const char* eventSelection,
+                                       const char* triggerClassName,
+                                       const char* cent,
+                                       const char* histoname)
+{
+  /// Get the handle of one histo, to be used with Histo(Int_t)
+  return InternalHistoHandle(Form("/%s/%s/%s",eventSelection,triggerClassName,cent),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::HistoHandle(const char* eventSelection,
+                                       const char* triggerClassName,
+                                       const char* cent,
+                                       const char* what,
+                                       const char* histoname)
+{
+  /// Get the handle of one histo, to be used with Histo(Int_t)
+  return InternalHistoHandle(Form("/%s/%s/%s/%s",eventSelection,triggerClassName,cent,what),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::MCHistoHandle(const char* eventSelection,
+                                         const char* triggerClassName,
+                                         const char* cent,
+                                         const char* histoname)
+{
+  /// Get the handle of one MC histo, to be used with Histo(Int_t)
+  return InternalHistoHandle(Form("/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,cent),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::MCHistoHandle(const char* eventSelection,
+                                         const char* triggerClassName,
+                                         const char* cent,
+                                         const char* what,
+                                         const char* histoname)
+{
+  /// Get the handle of one MC histo, to be used with Histo(Int_t)
+  return InternalHistoHandle(Form("/%s/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,cent,what),histoname);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::InternalHistoHandle(const char* path, const char* histoname)
+{
+  /// Get a handle for (path,histoname).
+  ///
+  /// Only here are the keys formatted and hashed : daughter classes should get
+  /// their handles once (e.g. in DefineHistogramCollection or SetRun), keep them
+  /// and use Histo(Int_t) in the FillHistosForXXX methods.
+  /// The handle stays valid even if the histogram collection is changed (see Init),
+  /// and the histogram need not exist yet when the handle is requested.
+
+  std::string key(path);
+  key += "/";
+  key += histoname;
+
+  std::map<std::string,Int_t>::const_iterator it = fHistoHandleIndex.find(key);
+  if ( it != fHistoHandleIndex.end() )
+  {
+    return it->second;
+  }
+
+  Int_t handle = fHistoHandleObjects.size();
+
+  fHistoHandleIndex[key] = handle;
+  fHistoHandlePaths.push_back(path);
+  fHistoHandleNames.push_back(histoname);
+  fHistoHandleObjects.push_back(0x0);
+
+  return handle;
+}
+
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::HistoObject(Int_t handle)
+{
+  /// Get one object (histo, profile or THnSparse) back from its handle
+  /// (see HistoHandle and MCHistoHandle)
+
+  if ( handle < 0 || handle >= static_cast<Int_t>(fHistoHandleObjects.size()) )
+  {
+    AliError(Form("Invalid histogram handle %d",handle));
+    return 0x0;
+  }
+
+  TObject* o = fHistoHandleObjects[handle];
+
+  if ( !o && fHistogramCollection )
+  {
+    o = fHistogramCollection->GetObject(fHistoHandlePaths[handle].c_str(),fHistoHandleNames[handle].c_str());
+    fHistoHandleObjects[handle] = o;
+  }
+
+  return o;
+}
+
+//_____________________________________________________________________________
+TH1* AliAnalysisMuMuBase::Histo(Int_t handle)
+{
+  /// Get one histo back from its handle (see HistoHandle and MCHistoHandle).
+  /// Use HistoObject for the handles of objects which are not TH1 (e.g. THnSparse)
+
+  return static_cast<TH1*>(HistoObject(handle));
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ResetHistoHandles()
+{
+  /// Forget the objects cached for the handles, e.g. because the histogram
+  /// collection has changed. The handles themselves remain valid.
+
+  fHistoHandleObjects.assign(fHistoHandleObjects.size(),static_cast<TObject*>(0x0));
+}
+
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::RemoveFromHistogramCollection(const char* fullIdentifier)
+{
+  /// Remove (and delete) one object of the histogram collection.
+  /// Daughter classes must remove objects through this method, so that no handle
+  /// keeps pointing to a deleted histogram.
+
+  if ( !fHistogramCollection ) return 0x0;
+
+  TObject* o = fHistogramCollection->Remove(fullIdentifier);
+
+  ResetHistoHandles();
+
+  return o;
+}
+
 //_____________________________________________________________________________
 TProfile* AliAnalysisMuMuBase::Prof(const char* eventSelection,
                                     const char* histoname)
@@ -516,6 +650,7 @@ void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
   /// Set the internal references
   fEventCounters       = &cc;
   fHistogramCollection = &hc;
+  ResetHistoHandles();
   fBinning             = &binning;
   fCutRegistry         = &registry;
 }
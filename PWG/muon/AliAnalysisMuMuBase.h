@@ -13,6 +13,9 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -101,7 +104,7 @@ public:
   Bool_t AlwaysFalse(const AliVParticle& /*particle*/, const AliVParticle& /*particle*/) const { return kFALSE; }
   void NameOfAlwaysFalse(TString& name) const { name = "NONE"; }
 
-  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; }
+  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; ResetHistoHandles(); }
 
 protected:
 
@@ -180,6 +183,19 @@ protected:
   TH1* MCHisto(const char* eventSelection, const char* triggerClassName, const char* cent,
              const char* what, const char* histoname);
 
+  Int_t HistoHandle(const char* eventSelection, const char* triggerClassName, const char* cent, const char* histoname);
+  Int_t HistoHandle(const char* eventSelection, const char* triggerClassName, const char* cent,
+                    const char* what, const char* histoname);
+
+  Int_t MCHistoHandle(const char* eventSelection, const char* triggerClassName, const char* cent, const char* histoname);
+  Int_t MCHistoHandle(const char* eventSelection, const char* triggerClassName, const char* cent,
+                      const char* what, const char* histoname);
+
+  TH1* Histo(Int_t handle);
+  TObject* HistoObject(Int_t handle);
+
+  TObject* RemoveFromHistogramCollection(const char* fullIdentifier);
+
   TProfile* Prof(const char* eventSelection, const char* histoname);
   TProfile* Prof(const char* eventSelection, const char* triggerClassName, const char* histoname);
   TProfile* Prof(const char* eventSelection, const char* triggerClassName, const char* cent, const char* histoname);
@@ -201,6 +217,9 @@ protected:
 
 private:
 
+  Int_t InternalHistoHandle(const char* path, const char* histoname);
+  void ResetHistoHandles();
+
   /// not implemented on purpose
   AliAnalysisMuMuBase& operator=(const AliAnalysisMuMuBase& rhs);
   /// not implemented on purpose
@@ -214,8 +233,12 @@ private:
   AliMCEvent* fMCEvent; //! current MC event
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
+  std::map<std::string,Int_t> fHistoHandleIndex; //! handle of each path+histoname
+  std::vector<std::string> fHistoHandlePaths; //! path of each handle
+  std::vector<std::string> fHistoHandleNames; //! histogram name of each handle
+  std::vector<TObject*> fHistoHandleObjects; //! object of each handle (0x0 if not resolved yet)
 
-  ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
+  ClassDef(AliAnalysisMuMuBase,2) // base class for a companion class to AliAnalysisMuMu
 };
 
 #endif
@@ -49,7 +49,9 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fPairHistoBlocks(),
+fPairHistoHandles()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -328,11 +330,8 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   // Usual cuts
   if (!AliAnalysisMuonUtility::IsMuonTrack(&tracki) || !AliAnalysisMuonUtility::IsMuonTrack(&trackj) ) return;
 
-  // Get total charge in order to get the correct histo name
+  // Get total charge in order to get the correct histo handles
   Double_t PairCharge = tracki.Charge() + trackj.Charge();
-  TString scharge  = "";
-  if( PairCharge == +2 )      scharge = "PP";
-  else if( PairCharge == -2 ) scharge = "MM";
 
   // Pointers in case running on MC
   Int_t labeli               = 0;
@@ -342,12 +341,9 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
 
-  // Usefull string :)
-  TString smix = IsMixedHisto ? "Mix" : "";
-
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
-  AliMergeableCollectionProxy* mcProxy(0x0); // to be set later maybe
+  // Histogram handles of this pair (see PairHistoBlock)
+  Int_t block = PairHistoBlock(eventSelection,triggerClassName,centrality,pairCutName,PairCharge,IsMixedHisto,kFALSE);
+  Int_t mcBlock(-1); // to be set later maybe
 
   // Construct dimuons vector
   TLorentzVector pi(tracki.Px(),tracki.Py(),tracki.Pz(),
@@ -374,8 +370,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     mcTracki = MCEvent()->GetTrack(labeli);
     if(!mcTracki) return;
     if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -383,8 +377,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     mcTrackj = MCEvent()->GetTrack(labelj);
     if(!mcTrackj) return;
     if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -392,26 +384,18 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Int_t currMotheri = mcTracki->GetMother();
     Int_t currMotherj = mcTrackj->GetMother();
     if( currMotheri!=currMotherj ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
     if( currMotheri<0 ) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
     // Check if mother is J/psi
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
     if(!mother){
-      delete proxy;
-      delete mcProxy;
       return;
     }
     if(mother->PdgCode() !=443) {
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
@@ -423,43 +407,42 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
     if(!mcTracki || !mcTrackj){
       AliError("Miss one or several MC track");
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
+    // Histogram handles for MC
+    mcBlock = PairHistoBlock(eventSelection,triggerClassName,centrality,pairCutName,PairCharge,IsMixedHisto,kTRUE);
     TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
   }
 
+  // Pointers to the handles are only taken now, as getting a new block may reallocate fPairHistoHandles
+  const Int_t* h = &fPairHistoHandles[block];
+  const Int_t* mch = ( mcBlock >= 0 ) ? &fPairHistoHandles[mcBlock] : 0x0;
+
   // Weight tracks if specified
   Double_t inputWeight=1.;
   if(!fWeightMuon)      inputWeight = WeightPairDistribution(pair4Momentum.Pt(),pair4Momentum.Rapidity());
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt")  ) {
+  if ( h[kPairPt] >= 0 && HistoObject(h[kPairPt]) ) {
     Double_t x[2] = {pair4Momentum.Pt(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    static_cast<THnSparse*>(HistoObject(h[kPairPt]))->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Y")   ){
+  if ( h[kPairY] >= 0 && HistoObject(h[kPairY]) ){
     Double_t x[2] = {pair4Momentum.Rapidity(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    static_cast<THnSparse*>(HistoObject(h[kPairY]))->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Eta") ){
+  if ( h[kPairEta] >= 0 && HistoObject(h[kPairEta]) ){
     Double_t x[2] = {pair4Momentum.Eta(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    static_cast<THnSparse*>(HistoObject(h[kPairEta]))->Fill(x,inputWeight);
   }
 
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( h[kPairPtPaireVsPtTrack] >= 0 && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
+    static_cast<TH2*>( Histo(h[kPairPtPaireVsPtTrack]))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+    static_cast<TH2*>( Histo(h[kPairPtPaireVsPtTrack]))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
   }
 
   // Fill histos with MC stack info (only opposite charge muons)
@@ -472,21 +455,19 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
 
     // Fill histo
-    if ( proxy->Histo("PtRecVsSim") )  proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( mcProxy->Histo("Pt"))  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( mcProxy->Histo("Y"))   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( mcProxy->Histo("Eta")) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    if ( Histo(h[kPairPtRecVsSim]) )  Histo(h[kPairPtRecVsSim])->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( Histo(mch[kPairPt]))  Histo(mch[kPairPt])->Fill(mcpj.Pt(),inputWeightMC);
+    if ( Histo(mch[kPairY]))   Histo(mch[kPairY])->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( Histo(mch[kPairEta])) Histo(mch[kPairEta])->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
   }
 
-  TIter nextBin(fBinsToFill);
-  nextBin.Reset();
-  AliAnalysisMuMuBinning::Range* r;
+  // Loop over all bin ranges, in the order of the handles of the blocks
+  for ( Int_t ib = 0; fBinsToFill && ib <= fBinsToFill->GetLast(); ++ib ){
 
-  // Loop over all bin ranges
-  while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
+    AliAnalysisMuMuBinning::Range* r = static_cast<AliAnalysisMuMuBinning::Range*>(fBinsToFill->At(ib));
 
     // --- In this loop we first check if the pairs pass some tests and we fill histo accordingly. ---
 
@@ -494,19 +475,16 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Bool_t ok(kFALSE);
     Bool_t okMC(kFALSE);
 
-    ok = CheckBinRangeCut(r,&pair4Momentum,proxy);
-    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,proxy);
+    ok = CheckBinRangeCut(r,&pair4Momentum,h);
+    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,h);
+
+    // Handles of the Minv histo and mean pt profiles associated to the bin
+    const Int_t* hbin = h + kNPairHistos + ib*kNPairBinHistos;
 
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok )
     {
-      // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(hbin+kPairMinv,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +497,15 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(hbin+kPairMinvAccEff,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      const Int_t* mchbin = mch + kNPairHistos + ib*kNPairBinHistos;
+
+      FillMinvHisto(mchbin+kPairMinv,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,18 +518,121 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(mchbin+kPairMinvAccEff,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
   }
-  delete proxy;
-  delete mcProxy;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuMinv::PairHistoBlock(const char* eventSelection,
+                                          const char* triggerClassName,
+                                          const char* centrality,
+                                          const char* pairCutName,
+                                          Double_t PairCharge,
+                                          Bool_t mix,
+                                          Bool_t mc)
+{
+  /// Get the histogram handles of one path, pair charge and mixing, as kNPairHistos
+  /// entries of fPairHistoHandles starting at the returned index, followed by
+  /// kNPairBinHistos entries for each bin of fBinsToFill (in the fBinsToFill order).
+  /// The MC blocks only hold the Pt, Y, Eta and bin entries.
+  /// The handles (and the disabled histograms) are resolved only the first time a block is seen,
+  /// so that the per pair filling does not need to format names nor to match the disabling patterns.
+
+  TString smix = mix ? "Mix" : "";
+  TString scharge  = "";
+  if( PairCharge == +2 )      scharge = "PP";
+  else if( PairCharge == -2 ) scharge = "MM";
+
+  TString key = mc ? BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName) :
+                     BuildPath(eventSelection,triggerClassName,centrality,pairCutName);
+  key += smix;
+  key += scharge;
+
+  std::map<std::string,Int_t>::const_iterator it = fPairHistoBlocks.find(key.Data());
+  if ( it != fPairHistoBlocks.end() )
+  {
+    return it->second;
+  }
+
+  Int_t block = fPairHistoHandles.size();
+
+  fPairHistoBlocks[key.Data()] = block;
+
+  if ( mc )
+  {
+    const char* names[] = { "Pt", "Y", "Eta" };
+    for ( Int_t ih = 0; ih < kNPairHistos; ++ih )
+    {
+      fPairHistoHandles.push_back( ih <= kPairEta ? MCHistoHandle(eventSelection,triggerClassName,centrality,pairCutName,names[ih]) : -1 );
+    }
+  }
+  else
+  {
+    const char* names[] = { "Pt", "Y", "Eta", "PtPaireVsPtTrack", "PtRecVsSim", "NchForJpsi", "NchForPsiP" };
+    for ( Int_t ih = 0; ih < kNPairHistos; ++ih )
+    {
+      TString name(names[ih]);
+      if ( ih <= kPairEta ) name += smix + scharge;
+
+      if ( ( ih <= kPairEta || ih == kPairPtPaireVsPtTrack ) && IsHistogramDisabled(names[ih]) )
+      {
+        fPairHistoHandles.push_back(-1);
+      }
+      else
+      {
+        fPairHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,pairCutName,name.Data()));
+      }
+    }
+  }
+
+  for ( Int_t ib = 0; fBinsToFill && ib <= fBinsToFill->GetLast(); ++ib )
+  {
+    AliAnalysisMuMuBinning::Range* r = static_cast<AliAnalysisMuMuBinning::Range*>(fBinsToFill->At(ib));
+
+    for ( Int_t i = 0; i < 2; ++i )
+    {
+      TString minvName = GetMinvHistoName(*r,i==1,PairCharge,mix);
+
+      if ( IsHistogramDisabled(minvName.Data()) )
+      {
+        fPairHistoHandles.push_back(-1);
+        fPairHistoHandles.push_back(-1);
+        fPairHistoHandles.push_back(-1);
+        continue;
+      }
+
+      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
+      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
+
+      if ( mc )
+      {
+        fPairHistoHandles.push_back(MCHistoHandle(eventSelection,triggerClassName,centrality,pairCutName,minvName.Data()));
+        fPairHistoHandles.push_back(MCHistoHandle(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data()));
+        fPairHistoHandles.push_back(MCHistoHandle(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data()));
+      }
+      else
+      {
+        fPairHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,pairCutName,minvName.Data()));
+        fPairHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data()));
+        fPairHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data()));
+      }
+    }
+  }
+
+  return block;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::ResetPairHistoBlocks()
+{
+  /// Forget the pair histogram handles, e.g. because the bins to fill
+  /// or the Minv histogram names have changed
+
+  fPairHistoBlocks.clear();
+  fPairHistoHandles.clear();
 }
 
 
@@ -687,21 +760,23 @@ void AliAnalysisMuMuMinv::FillHistosForMCEvent(const char* eventSelection,const
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight)
+void AliAnalysisMuMuMinv::FillMinvHisto(const Int_t* h, TLorentzVector* pair4Momentum, Double_t inputWeight)
 {
-  /// Create, fill and store Minv histo
-  if (!IsHistogramDisabled(minvName->Data())){
-
-    TH1* h(0x0);
+  /// Fill Minv histo and mean pt profiles, from their handles (see PairHistoBlock) :
+  /// h[0] is the Minv histo, h[1] and h[2] the MeanPt and MeanPtSquare profiles
+  /// (all of them -1 if the Minv histo is disabled)
+  if ( h[0] >= 0 ){
 
-    h = proxy->Histo(minvName->Data());
-    if (h) h->Fill(pair4Momentum->M(),inputWeight);
+    TH1* hminv = Histo(h[0]);
+    if (hminv) hminv->Fill(pair4Momentum->M(),inputWeight);
 
     // Fill Mean pT
     if ( fComputeMeanPt ){
-      if ( !hprof ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      TProfile* hprof  = static_cast<TProfile*>(HistoObject(h[1]));
+      TProfile* hprof2 = static_cast<TProfile*>(HistoObject(h[2]));
+      if ( !hprof ) AliError(Form("Could not get hprofile for %s",hminv ? hminv->GetName() : "Minv"));
       else hprof->Fill(pair4Momentum->M(),pair4Momentum->Pt(),inputWeight);
-      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",hminv ? hminv->GetName() : "Minv"));
       else hprof2->Fill(pair4Momentum->M(),pair4Momentum->Pt()*pair4Momentum->Pt(),inputWeight);
     }
   }
@@ -818,9 +893,10 @@ Bool_t AliAnalysisMuMuMinv::IsPtInRange(const AliVParticle& t1, const AliVPartic
 }
 
 //_____________________________________________________________________________
-Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy)
+Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, const Int_t* h)
 {
   /// Check if our pairs match conditions from the binning range
+  /// h are the histogram handles of the pair (see PairHistoBlock)
 
   // --- fully integrated case ---
 
@@ -830,12 +906,12 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
 
     ok = kTRUE;
 
-    TH1* h(0x0);
+    TH1* hnch(0x0);
 
     // Fill NchForJpsi histo according to pair4Momentum.M()
     if ( pair4Momentum->M() >= 2.9 && pair4Momentum->M() <= 3.3 ){
 
-      h = proxy->Histo("NchForJpsi");
+      hnch = Histo(h[kPairNchForJpsi]);
 
       Double_t ntrcorr = (-1.);
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -855,11 +931,11 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
           }
         }
       }
-      h->Fill(ntrcorr);
+      if (hnch) hnch->Fill(ntrcorr);
     }
     else if ( pair4Momentum->M() >= 3.6 && pair4Momentum->M() <= 3.9){
 
-      h = proxy->Histo("NchForPsiP");
+      hnch = Histo(h[kPairNchForPsiP]);
       Double_t ntrcorr = (-1.);
 
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -879,7 +955,7 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
           }
         }
       }
-      h->Fill(ntrcorr);
+      if (hnch) hnch->Fill(ntrcorr);
     }
   }
 
@@ -1110,6 +1186,7 @@ void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+  ResetPairHistoBlocks();
 }
 
 //________________________________________________________________________
@@ -43,7 +43,7 @@ public:
 
   void SetMuonWeight() { fWeightMuon=kTRUE; }
 
-  void SetLegacyBinNaming() { fMinvBinSeparator = ""; }
+  void SetLegacyBinNaming() { fMinvBinSeparator = ""; ResetPairHistoBlocks(); }
 
   void SetBinsToFill(const char* particle, const char* bins);
 
@@ -72,7 +72,7 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
-  void FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight);
+  void FillMinvHisto(const Int_t* h, TLorentzVector* pair4Momentum, Double_t inputWeight);
 
 private:
 
@@ -91,7 +91,13 @@ private:
 
   Double_t TriggerLptApt(Double_t *x, Double_t *par);
 
-  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy);
+  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, const Int_t* h);
+
+  Int_t PairHistoBlock(const char* eventSelection, const char* triggerClassName,
+                       const char* centrality, const char* pairCutName,
+                       Double_t PairCharge, Bool_t mix, Bool_t mc);
+
+  void ResetPairHistoBlocks();
 
   Bool_t CheckMCTracksMatchingStackAndMother(Int_t labeli, Int_t labelj, AliVParticle* mcTracki, AliVParticle* mcTrackj, Double_t inputWeightMC);
 
@@ -112,7 +118,17 @@ private:
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  /// histograms filled for each pair, see PairHistoBlock
+  enum EPairHisto { kPairPt, kPairY, kPairEta, kPairPtPaireVsPtTrack, kPairPtRecVsSim,
+    kPairNchForJpsi, kPairNchForPsiP, kNPairHistos };
+  /// histograms filled for each pair and each bin of fBinsToFill, see PairHistoBlock
+  enum EPairBinHisto { kPairMinv, kPairMeanPt, kPairMeanPtSquare,
+    kPairMinvAccEff, kPairMeanPtAccEff, kPairMeanPtSquareAccEff, kNPairBinHistos };
+
+  std::map<std::string,Int_t> fPairHistoBlocks; //! first entry in fPairHistoHandles for each path, pair charge and mixing
+  std::vector<Int_t> fPairHistoHandles; //! histogram handles (-1 if disabled), kNPairHistos + kNPairBinHistos x bins per block
+
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
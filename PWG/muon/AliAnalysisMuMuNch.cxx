@@ -2492,20 +2492,20 @@ void AliAnalysisMuMuNch::Terminate(Option_t *)
 
   if ( HistogramCollection()->FindObject(Form("/%s/AliAnalysisMuMuNch/NTrackletVsEta",MCInputPrefix())) )
   {
-    HistogramCollection()->Remove(Form("/%s/AliAnalysisMuMuNch/NTrackletVsEta",MCInputPrefix()));
-    HistogramCollection()->Remove(Form("/%s/AliAnalysisMuMuNch/NTrackletVsPhi",MCInputPrefix()));
-    HistogramCollection()->Remove(Form("/%s/AliAnalysisMuMuNch/NchVsEta",MCInputPrefix()));
-    HistogramCollection()->Remove(Form("/%s/AliAnalysisMuMuNch/NchVsPhi",MCInputPrefix()));
-    HistogramCollection()->Remove(Form("/%s/AliAnalysisMuMuNch/SPDcorrectionVsEta",MCInputPrefix()));
-    HistogramCollection()->Remove("/AliAnalysisMuMuNch/NBkgTrackletsVSEta");
+    RemoveFromHistogramCollection(Form("/%s/AliAnalysisMuMuNch/NTrackletVsEta",MCInputPrefix()));
+    RemoveFromHistogramCollection(Form("/%s/AliAnalysisMuMuNch/NTrackletVsPhi",MCInputPrefix()));
+    RemoveFromHistogramCollection(Form("/%s/AliAnalysisMuMuNch/NchVsEta",MCInputPrefix()));
+    RemoveFromHistogramCollection(Form("/%s/AliAnalysisMuMuNch/NchVsPhi",MCInputPrefix()));
+    RemoveFromHistogramCollection(Form("/%s/AliAnalysisMuMuNch/SPDcorrectionVsEta",MCInputPrefix()));
+    RemoveFromHistogramCollection("/AliAnalysisMuMuNch/NBkgTrackletsVSEta");
   }
 
   if ( HistogramCollection()->FindObject("/AliAnalysisMuMuNch/NTrackletVsEta") )
   {
-    HistogramCollection()->Remove("/AliAnalysisMuMuNch/NTrackletVsEta");
-    HistogramCollection()->Remove("/AliAnalysisMuMuNch/test");
-    HistogramCollection()->Remove("/AliAnalysisMuMuNch/NTrackletVsPhi");
-    HistogramCollection()->Remove("/AliAnalysisMuMuNch/SPDcorrectionVsEta");
+    RemoveFromHistogramCollection("/AliAnalysisMuMuNch/NTrackletVsEta");
+    RemoveFromHistogramCollection("/AliAnalysisMuMuNch/test");
+    RemoveFromHistogramCollection("/AliAnalysisMuMuNch/NTrackletVsPhi");
+    RemoveFromHistogramCollection("/AliAnalysisMuMuNch/SPDcorrectionVsEta");
   }
   //____ Compute dNchdEta histo
   TObjArray* idArr =  HistogramCollection()->SortAllIdentifiers();
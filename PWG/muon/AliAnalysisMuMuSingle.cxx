@@ -36,7 +36,9 @@ fMuonTrackCuts(0x0),
 fShouldSeparatePlusAndMinus(kFALSE),
 fAccEffHisto(0x0),
 fPtEtaSpectraPerBCX(kFALSE),
-fDCAHistos(kFALSE)
+fDCAHistos(kFALSE),
+fTrackHistoBlocks(),
+fTrackHistoHandles()
 {
   /// ctor
 }
@@ -265,10 +267,11 @@ void AliAnalysisMuMuSingle::DefineHistogramCollection(const char* eventSelection
 
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuSingle::FillHistosForMuonTrack(AliMergeableCollectionProxy& proxy,
+void AliAnalysisMuMuSingle::FillHistosForMuonTrack(const char* path, Int_t block,
                                                    const AliVParticle& track)
 {
   /// Fill histograms for one track
+  /// block is the first of the handles of path (see TrackHistoBlock)
 
   AliCodeTimerAuto("",0);
 
@@ -280,79 +283,73 @@ void AliAnalysisMuMuSingle::FillHistosForMuonTrack(AliMergeableCollectionProxy&
   TLorentzVector p(track.Px(),track.Py(),track.Pz(),
                    TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+track.P()*track.P()));
 
-
-  TString charge("");
-
-  if ( ShouldSeparatePlusAndMinus() )
+  // handles of the histograms of this track charge
+  const Int_t* h = &fTrackHistoHandles[block];
+  if ( ShouldSeparatePlusAndMinus() && track.Charge() < 0 )
   {
-    if ( track.Charge() < 0 )
-    {
-      charge = "Minus";
-    }
-    else
-    {
-      charge = "Plus";
-    }
+    h += kNTrackHistos;
   }
 
   Double_t dca = EAGetTrackDCA(track);
 
   Double_t theta = AliAnalysisMuonUtility::GetThetaAbsDeg(&track);
 
-  if (!IsHistogramDisabled("BCX"))
+  if ( h[kBCX] >= 0 )
   {
-    proxy.Histo("BCX")->Fill(1.0*Event()->GetBunchCrossNumber());
+    Histo(h[kBCX])->Fill(1.0*Event()->GetBunchCrossNumber());
   }
 
-  if (!IsHistogramDisabled("Chi2MatchTrigger"))
+  if ( h[kChi2MatchTrigger] >= 0 )
   {
-    proxy.Histo("Chi2MatchTrigger")->Fill(AliAnalysisMuonUtility::GetChi2MatchTrigger(&track));
+    Histo(h[kChi2MatchTrigger])->Fill(AliAnalysisMuonUtility::GetChi2MatchTrigger(&track));
   }
 
-  if (!IsHistogramDisabled("EtaRapidityMu*"))
+  if ( h[kEtaRapidityMu] >= 0 )
   {
-    proxy.Histo(Form("EtaRapidityMu%s",charge.Data()))->Fill(p.Rapidity(),p.Eta());
+    Histo(h[kEtaRapidityMu])->Fill(p.Rapidity(),p.Eta());
   }
 
-  if (!IsHistogramDisabled("PtEtaMu*"))
+  if ( h[kPtEtaMu] >= 0 )
   {
-    TH1* h = proxy.Histo(Form("PtEtaMu%s",charge.Data()));
+    TH1* hpteta = Histo(h[kPtEtaMu]);
 
-    h->Fill(p.Eta(),p.Pt());
+    hpteta->Fill(p.Eta(),p.Pt());
 
     if  ( fPtEtaSpectraPerBCX )
     {
-      if (!IsHistogramDisabled("BCX"))
+      if ( h[kBCX] >= 0 )
       {
-        TH1* hbcx = proxy.Histo(Form("PtEtaMu%sBCX%d",charge.Data(),Event()->GetBunchCrossNumber()));
+        TString name(Form("%sBCX%d",hpteta->GetName(),Event()->GetBunchCrossNumber()));
+
+        TH1* hbcx = HistogramCollection()->Histo(path,name.Data());
 
         if (!hbcx)
         {
-          hbcx = static_cast<TH1*>(h->Clone(Form("PtEtaMu%sBCX%d",charge.Data(),Event()->GetBunchCrossNumber())));
-          proxy.Adopt(hbcx);
+          hbcx = static_cast<TH1*>(hpteta->Clone(name.Data()));
+          HistogramCollection()->Adopt(path,hbcx);
         }
       }
     }
   }
 
-  if (!IsHistogramDisabled("PtRapidityMu*"))
+  if ( h[kPtRapidityMu] >= 0 )
   {
-    proxy.Histo(Form("PtRapidityMu%s",charge.Data()))->Fill(p.Rapidity(),p.Pt());
+    Histo(h[kPtRapidityMu])->Fill(p.Rapidity(),p.Pt());
   }
 
-  if (!IsHistogramDisabled("PEtaMu*"))
+  if ( h[kPEtaMu] >= 0 )
   {
-    proxy.Histo(Form("PEtaMu%s",charge.Data()))->Fill(p.Eta(),p.P());
+    Histo(h[kPEtaMu])->Fill(p.Eta(),p.P());
   }
 
-  if (!IsHistogramDisabled("PtPhiMu*"))
+  if ( h[kPtPhiMu] >= 0 )
   {
-    proxy.Histo(Form("PtPhiMu%s",charge.Data()))->Fill(p.Phi(),p.Pt());
+    Histo(h[kPtPhiMu])->Fill(p.Phi(),p.Pt());
   }
 
-  if (!IsHistogramDisabled("Chi2Mu*"))
+  if ( h[kChi2Mu] >= 0 )
   {
-    proxy.Histo(Form("Chi2Mu%s",charge.Data()))->Fill(AliAnalysisMuonUtility::GetChi2perNDFtracker(&track));
+    Histo(h[kChi2Mu])->Fill(AliAnalysisMuonUtility::GetChi2perNDFtracker(&track));
   }
 
   // if (!IsHistogramDisabled("HitperTriggerLocalBoardMu*"))
@@ -373,30 +370,30 @@ void AliAnalysisMuMuSingle::FillHistosForMuonTrack(AliMergeableCollectionProxy&
   if ( theta >= 2.0 && theta < 3.0 )
   {
 
-    if (!IsHistogramDisabled("dcaP23Mu*"))
+    if ( h[kDcaP23Mu] >= 0 )
     {
-      proxy.Histo(Form("dcaP23Mu%s",charge.Data()))->Fill(p.P(),dca);
+      Histo(h[kDcaP23Mu])->Fill(p.P(),dca);
     }
 
     if ( p.Pt() > 2 )
     {
-      if (!IsHistogramDisabled("dcaPwPtCut23Mu*"))
+      if ( h[kDcaPwPtCut23Mu] >= 0 )
       {
-        proxy.Histo(Form("dcaPwPtCut23Mu%s",charge.Data()))->Fill(p.P(),dca);
+        Histo(h[kDcaPwPtCut23Mu])->Fill(p.P(),dca);
       }
     }
   }
   else if ( theta >= 3.0 && theta < 10.0 )
   {
-    if (!IsHistogramDisabled("dcaP310Mu*"))
+    if ( h[kDcaP310Mu] >= 0 )
     {
-      proxy.Histo(Form("dcaP310Mu%s",charge.Data()))->Fill(p.P(),dca);
+      Histo(h[kDcaP310Mu])->Fill(p.P(),dca);
     }
     if ( p.Pt() > 2 )
     {
-      if (!IsHistogramDisabled("dcaPwPtCut310Mu*"))
+      if ( h[kDcaPwPtCut310Mu] >= 0 )
       {
-        proxy.Histo(Form("dcaPwPtCut310Mu%s",charge.Data()))->Fill(p.P(),dca);
+        Histo(h[kDcaPwPtCut310Mu])->Fill(p.P(),dca);
       }
     }
   }
@@ -413,11 +410,71 @@ void AliAnalysisMuMuSingle::FillHistosForTrack(const char* eventSelection,
 
   if (!AliAnalysisMuonUtility::IsMuonTrack(&track) ) return;
 
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,trackCutName));
+  TString path(BuildPath(eventSelection,triggerClassName,centrality,trackCutName));
+
+  Int_t block = TrackHistoBlock(eventSelection,triggerClassName,centrality,trackCutName,path.Data());
+
+  FillHistosForMuonTrack(path.Data(),block,track);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuSingle::TrackHistoBlock(const char* eventSelection,
+                                             const char* triggerClassName,
+                                             const char* centrality,
+                                             const char* trackCutName,
+                                             const char* path)
+{
+  /// Get the histogram handles of one path, as 2 x kNTrackHistos entries of
+  /// fTrackHistoHandles starting at the returned index : first the mu+ (or all mu)
+  /// histograms, then the mu- ones.
+  /// The handles (and the disabled histograms) are resolved only the first time a path is seen,
+  /// so that the per track filling does not need to format names nor to match the disabling patterns.
+
+  std::map<std::string,Int_t>::const_iterator it = fTrackHistoBlocks.find(path);
+  if ( it != fTrackHistoBlocks.end() )
+  {
+    return it->second;
+  }
+
+  const char* names[] = { "BCX", "Chi2MatchTrigger", "EtaRapidityMu", "PtEtaMu", "PtRapidityMu", "PEtaMu",
+    "PtPhiMu", "Chi2Mu", "dcaP23Mu", "dcaPwPtCut23Mu", "dcaP310Mu", "dcaPwPtCut310Mu" };
+  // BCX and Chi2MatchTrigger are never separated by charge
+  const Bool_t charged[] = { kFALSE, kFALSE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE, kTRUE };
+  const char* suffix[] = { "Plus", "Minus" };
 
-  FillHistosForMuonTrack(*proxy,track);
+  Int_t block = fTrackHistoHandles.size();
+
+  fTrackHistoBlocks[path] = block;
+
+  for ( Int_t i = 0; i < 2; ++i )
+  {
+    for ( Int_t ih = 0; ih < kNTrackHistos; ++ih )
+    {
+      TString pattern(names[ih]);
+      TString name(names[ih]);
+
+      if ( charged[ih] )
+      {
+        pattern += "*";
+        if ( ShouldSeparatePlusAndMinus() ) name += suffix[i];
+      }
+
+      if ( IsHistogramDisabled(pattern.Data()) )
+      {
+        fTrackHistoHandles.push_back(-1);
+      }
+      else if ( strlen(trackCutName) > 0 )
+      {
+        fTrackHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,trackCutName,name.Data()));
+      }
+      else
+      {
+        fTrackHistoHandles.push_back(HistoHandle(eventSelection,triggerClassName,centrality,name.Data()));
+      }
+    }
+  }
 
-  delete proxy;
+  return block;
 }
 
 //_____________________________________________________________________________
@@ -71,7 +71,7 @@ protected:
                                   const char* trackCutName,
                                   const AliVParticle& part);
 
-  void FillHistosForMuonTrack(AliMergeableCollectionProxy& proxy, const AliVParticle& track);
+  void FillHistosForMuonTrack(const char* path, Int_t block, const AliVParticle& track);
 
 
 private:
@@ -93,6 +93,9 @@ private:
 
   Double_t GetTrackTheta(const AliVParticle& particle) const;
 
+  Int_t TrackHistoBlock(const char* eventSelection, const char* triggerClassName,
+                        const char* centrality, const char* trackCutName, const char* path);
+
   /* methods prefixed with EA should really not exist at all. They are there
    only because the some of our base interfaces are shamelessly incomplete or
    inadequate...
@@ -118,7 +121,14 @@ private:
   Bool_t fPtEtaSpectraPerBCX; // make pt vs eta spectra bunch by bunch (caution : much slower !)
   Bool_t fDCAHistos; // make DCA histograms
 
-  ClassDef(AliAnalysisMuMuSingle,3) // implementation of AliAnalysisMuMuBase for single mu analysis
+  /// histograms filled for each track, see TrackHistoBlock
+  enum ETrackHisto { kBCX, kChi2MatchTrigger, kEtaRapidityMu, kPtEtaMu, kPtRapidityMu, kPEtaMu,
+    kPtPhiMu, kChi2Mu, kDcaP23Mu, kDcaPwPtCut23Mu, kDcaP310Mu, kDcaPwPtCut310Mu, kNTrackHistos };
+
+  std::map<std::string,Int_t> fTrackHistoBlocks; //! first entry in fTrackHistoHandles for each path
+  std::vector<Int_t> fTrackHistoHandles; //! histogram handles (-1 if disabled), kNTrackHistos x 2 charges per path
+
+  ClassDef(AliAnalysisMuMuSingle,4) // implementation of AliAnalysisMuMuBase for single mu analysis
 };
 
 #endif
@@ -590,7 +590,18 @@ void AliAnalysisTaskMuMu::FillCounters(const char* eventSelection, const char* t
 void AliAnalysisTaskMuMu::FinishTaskOutput()
 {
   /// prune empty histograms BEFORE mergin, in order to save some bytes...
-  if ( fHistogramCollection ) fHistogramCollection->PruneEmptyObjects();
+  if ( fHistogramCollection )
+  {
+    fHistogramCollection->PruneEmptyObjects();
+
+    // the pruned histograms are deleted : drop the histograms cached by the sub-analyses
+    TIter nextAnalysis(fSubAnalysisVector);
+    AliAnalysisMuMuBase* analysis;
+    while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) )
+    {
+      analysis->SetHistogramCollection(fHistogramCollection);
+    }
+  }
 }
 
 //________________________________________________________________________
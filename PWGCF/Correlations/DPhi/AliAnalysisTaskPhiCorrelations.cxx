@@ -55,6 +55,7 @@
 #include "AliGenHepMCEventHeader.h"
 
 #include "AliEventPoolManager.h"
+#include "AliMixingRingBuffer.h"
 #include "AliBasicParticle.h"
 #include "AliVHeader.h"
 
@@ -92,6 +93,9 @@
 
 ClassImp( AliAnalysisTaskPhiCorrelations )
 
+const Double_t AliAnalysisTaskPhiCorrelations::fgkMixingTargetFraction = 0.1;
+const Int_t    AliAnalysisTaskPhiCorrelations::fgkMixingTargetEvents   = 5;
+
 //____________________________________________________________________
 AliAnalysisTaskPhiCorrelations:: AliAnalysisTaskPhiCorrelations(const char* name):
 AliAnalysisTask(name,""),
@@ -193,7 +197,9 @@ fCustomParticlesA(""),
 fCustomParticlesB(""),
 fEventPoolOutputList(),
 fUsePtBinnedEventPool(0),
-fCheckEventNumberInMixedEvent(kFALSE)
+fCheckEventNumberInMixedEvent(kFALSE),
+fUseMixingRingBuffer(kFALSE),
+fMixingRingBuffers(0x0)
 {
   // Default constructor
   // Define input and output slots here
@@ -209,6 +215,8 @@ AliAnalysisTaskPhiCorrelations::~AliAnalysisTaskPhiCorrelations()
   
   if (fListOfHistos  && !AliAnalysisManager::GetAnalysisManager()->IsProofMode()) 
     delete fListOfHistos;
+  
+  delete fMixingRingBuffers;
 }
 
 //____________________________________________________________________
@@ -451,7 +459,7 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
   if(!fPoolMgr)
   {
     fPoolMgr = new AliEventPoolManager(poolsize, fMixingTracks, nCentralityBins, centralityBins, nZvtxBins, zvtxbin, nPsiBins, psibins, nPtBins, ptbins);
-    fPoolMgr->SetTargetValues(fMixingTracks, 0.1, 5);
+    fPoolMgr->SetTargetValues(fMixingTracks, fgkMixingTargetFraction, fgkMixingTargetEvents);
   }
 
   // Check binning of pool manager (basic dimensional check for the time being)
@@ -478,7 +486,11 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
 
   // save to output if requested
   if(fEventPoolOutputList.size())
+  {
+    if (fUseMixingRingBuffer)
+      AliWarning("Mixed events are stored in ring buffers, the saved pools will be empty");
     fListOfHistos->Add(fPoolMgr);
+  }
 }
 
 //____________________________________________________________________
@@ -773,14 +785,15 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
     for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
     {
       AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
+      Int_t nMix = GetMixingPoolNEvents(pool);
       if (fFillOnlyStep0) {
-        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool->NTracksInPool());
-        ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, pool->GetCurrentNEvents());
+        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, GetMixingPoolNTracks(pool));
+        ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
       }
-      if (pool->IsReady())
-        for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
-	  fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepAll, tracksMC, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
-      pool->UpdatePool(CloneAndReduceTrackList(tracksCorrelateMC, pool->GetPtMin(), pool->GetPtMax()));
+      if (IsMixingPoolReady(pool))
+        for (Int_t jMix=0; jMix<nMix; jMix++) 
+	  fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepAll, tracksMC, GetMixedEvent(pool, jMix), 1.0 / nMix, (jMix == 0));
+      UpdateMixingPool(pool, tracksCorrelateMC);
     }
   }
   
@@ -889,10 +902,11 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx + 200, 0., iPool);
-          if (pool->IsReady())
-            for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
-              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTrackedOnlyPrim, tracksRecoMatchedPrim, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
-          pool->UpdatePool(CloneAndReduceTrackList(tracksCorrelateRecoMatchedPrim, pool->GetPtMin(), pool->GetPtMax()));
+          Int_t nMix = GetMixingPoolNEvents(pool);
+          if (IsMixingPoolReady(pool))
+            for (Int_t jMix=0; jMix<nMix; jMix++) 
+              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTrackedOnlyPrim, tracksRecoMatchedPrim, GetMixedEvent(pool, jMix), 1.0 / nMix, (jMix == 0));
+          UpdateMixingPool(pool, tracksCorrelateRecoMatchedPrim);
         }
       }
       
@@ -923,10 +937,11 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx + 300, 0., iPool);
-          if (pool->IsReady())
-            for (Int_t jMix=0; jMix<pool->GetCurrentNEvents(); jMix++) 
-              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTracked, tracksRecoMatchedAll, pool->GetEvent(jMix), 1.0 / pool->GetCurrentNEvents(), (jMix == 0));
-          pool->UpdatePool(CloneAndReduceTrackList(tracksCorrelateRecoMatchedAll, pool->GetPtMin(), pool->GetPtMax()));
+          Int_t nMix = GetMixingPoolNEvents(pool);
+          if (IsMixingPoolReady(pool))
+            for (Int_t jMix=0; jMix<nMix; jMix++) 
+              fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTracked, tracksRecoMatchedAll, GetMixedEvent(pool, jMix), 1.0 / nMix, (jMix == 0));
+          UpdateMixingPool(pool, tracksCorrelateRecoMatchedAll);
         }
       }
       
@@ -971,19 +986,22 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
           AliEventPool* pool2 = fPoolMgr->GetEventPool(centrality, zVtx + 100, 0., iPool);
-          ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool2->NTracksInPool());
-          ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, pool2->GetCurrentNEvents());
-          if (pool2->IsReady())
+          Int_t nMix = GetMixingPoolNEvents(pool2);
+          ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, GetMixingPoolNTracks(pool2));
+          ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
+          if (IsMixingPoolReady(pool2))
           {
-            for (Int_t jMix=0; jMix<pool2->GetCurrentNEvents(); jMix++)
+            for (Int_t jMix=0; jMix<nMix; jMix++)
             {
+              TObjArray* bgTracks = GetMixedEvent(pool2, jMix);
+
               // STEP 6
               if (!fSkipStep6)
-                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0));
+                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracks, bgTracks, 1.0 / nMix, (jMix == 0));
               
               // two track cut, STEP 8
               if (fTwoTrackEfficiencyCut > 0)
-                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0), kTRUE, bSign, fTwoTrackEfficiencyCut);
+                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracks, bgTracks, 1.0 / nMix, (jMix == 0), kTRUE, bSign, fTwoTrackEfficiencyCut);
               
               // apply correction efficiency, STEP 10
               if (fEfficiencyCorrectionTriggers || fEfficiencyCorrectionAssociated)
@@ -991,11 +1009,11 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
                 // with or without two track efficiency depending on if fTwoTrackEfficiencyCut is set
                 Bool_t twoTrackCut = (fTwoTrackEfficiencyCut > 0);
                 
-                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepCorrected, tracks, pool2->GetEvent(jMix), 1.0 / pool2->GetCurrentNEvents(), (jMix == 0), twoTrackCut, bSign, fTwoTrackEfficiencyCut, kTRUE);
+                fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepCorrected, tracks, bgTracks, 1.0 / nMix, (jMix == 0), twoTrackCut, bSign, fTwoTrackEfficiencyCut, kTRUE);
               }
             }
           }
-          pool2->UpdatePool(CloneAndReduceTrackList(tracksCorrelate, pool2->GetPtMin(), pool2->GetPtMax()));
+          UpdateMixingPool(pool2, tracksCorrelate);
         }
       }
       
@@ -1300,20 +1318,20 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseDataMode()
       
   //     pool->SetDebug(1);
        
-      if (pool->IsReady()) 
+      if (IsMixingPoolReady(pool)) 
       {
-        Int_t nMix = pool->GetCurrentNEvents();
+        Int_t nMix = GetMixingPoolNEvents(pool);
   //       cout << "nMix = " << nMix << " tracks in pool = " << pool->NTracksInPool() << endl;
         
         ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(2);
         ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(3, nMix);
-        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, pool->NTracksInPool());
+        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, GetMixingPoolNTracks(pool));
         ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
       
         // Fill mixed-event histos here  
         for (Int_t jMix=0; jMix<nMix; jMix++) 
         {
-          TObjArray* bgTracks = pool->GetEvent(jMix);
+          TObjArray* bgTracks = GetMixedEvent(pool, jMix);
         
           if (!fSkipStep6)
             fHistosMixed->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracksClone, bgTracks, 1.0 / nMix, (jMix == 0), kFALSE, 0, 0.02, kTRUE);
@@ -1324,16 +1342,7 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseDataMode()
       }
       
       if (!pool->GetLockFlag())
-      {
-        TObjArray* storeInMixed = 0;
-        if (tracksCorrelate)
-          storeInMixed = CloneAndReduceTrackList(tracksCorrelate, pool->GetPtMin(), pool->GetPtMax());
-        else
-          storeInMixed = CloneAndReduceTrackList(tracksClone, pool->GetPtMin(), pool->GetPtMax());
-        
-        // ownership is with the pool now
-        pool->UpdatePool(storeInMixed);
-      }
+        UpdateMixingPool(pool, (tracksCorrelate) ? tracksCorrelate : tracksClone);
       //pool->PrintInfo();
     }
   }
@@ -1622,6 +1631,89 @@ TObjArray* AliAnalysisTaskPhiCorrelations::CloneAndReduceTrackList(TObjArray* tr
   return tracksClone;
 }
 
+//____________________________________________________________________
+AliMixingRingBuffer* AliAnalysisTaskPhiCorrelations::GetMixingRingBuffer(AliEventPool* pool)
+{
+  // returns the ring buffer which stores the events of the given pool, created on first use
+  // the pool manager is still used for the binning, the buffer takes the same target values as the pool manager
+  
+  if (!fMixingRingBuffers)
+  {
+    fMixingRingBuffers = new TMap;
+    fMixingRingBuffers->SetOwnerValue(kTRUE);
+  }
+  
+  AliMixingRingBuffer* buffer = (AliMixingRingBuffer*) fMixingRingBuffers->GetValue(pool);
+  if (!buffer)
+  {
+    buffer = new AliMixingRingBuffer(fMixingTracks, fgkMixingTargetFraction, fgkMixingTargetEvents, pool->GetPtMin(), pool->GetPtMax());
+    fMixingRingBuffers->Add(pool, buffer);
+  }
+  
+  return buffer;
+}
+
+//____________________________________________________________________
+Bool_t AliAnalysisTaskPhiCorrelations::IsMixingPoolReady(AliEventPool* pool)
+{
+  // returns if the pool (or its ring buffer) contains enough events for mixing
+  
+  if (fUseMixingRingBuffer)
+    return GetMixingRingBuffer(pool)->IsReady();
+  
+  return pool->IsReady();
+}
+
+//____________________________________________________________________
+Int_t AliAnalysisTaskPhiCorrelations::GetMixingPoolNEvents(AliEventPool* pool)
+{
+  // returns the number of events in the pool (or its ring buffer)
+  
+  if (fUseMixingRingBuffer)
+    return GetMixingRingBuffer(pool)->GetCurrentNEvents();
+  
+  return pool->GetCurrentNEvents();
+}
+
+//____________________________________________________________________
+Int_t AliAnalysisTaskPhiCorrelations::GetMixingPoolNTracks(AliEventPool* pool)
+{
+  // returns the number of tracks in the pool (or its ring buffer)
+  
+  if (fUseMixingRingBuffer)
+    return GetMixingRingBuffer(pool)->NTracksInPool();
+  
+  return pool->NTracksInPool();
+}
+
+//____________________________________________________________________
+TObjArray* AliAnalysisTaskPhiCorrelations::GetMixedEvent(AliEventPool* pool, Int_t jMix)
+{
+  // returns the tracks of event jMix of the pool
+  // in ring buffer mode the array is a recycled view which is only valid until the next call
+  
+  if (fUseMixingRingBuffer)
+    return GetMixingRingBuffer(pool)->GetEvent(jMix);
+  
+  return pool->GetEvent(jMix);
+}
+
+//____________________________________________________________________
+void AliAnalysisTaskPhiCorrelations::UpdateMixingPool(AliEventPool* pool, TObjArray* tracks)
+{
+  // adds the tracks in the pt range of the pool as new event to the pool
+  // in ring buffer mode the tracks are copied into the recycled storage without allocating AliBasicParticles
+  
+  if (fUseMixingRingBuffer)
+  {
+    GetMixingRingBuffer(pool)->UpdatePool(tracks, fFillCorrelationsRapidity);
+    return;
+  }
+  
+  // ownership is with the pool
+  pool->UpdatePool(CloneAndReduceTrackList(tracks, pool->GetPtMin(), pool->GetPtMax()));
+}
+
 //____________________________________________________________________
 void  AliAnalysisTaskPhiCorrelations::Initialize()
 {
@@ -2086,4 +2178,7 @@ void AliAnalysisTaskPhiCorrelations::FinishTaskOutput()
 {
   // Clear unnecessary pools before saving
   fPoolMgr->ClearPools();
+  
+  if (fMixingRingBuffers)
+    fMixingRingBuffers->DeleteValues();
 }
@@ -42,6 +42,8 @@ class AliUEHistograms;
 class TH1;
 class TObjArray;
 class AliEventPoolManager;
+class AliEventPool;
+class AliMixingRingBuffer;
 class AliESDEvent;
 class AliHelperPID;
 class AliAnalysisUtils;
@@ -173,11 +175,15 @@ public:
   AliEventPoolManager* GetEventPoolManager() {return fPoolMgr;}
   void SetUsePtBinnedEventPool(Bool_t val) {fUsePtBinnedEventPool = val;}
   void SetCheckEventNumberInMixedEvent(Bool_t val) {fCheckEventNumberInMixedEvent = val;}
+  void SetUseMixingRingBuffer(Bool_t flag = kTRUE) {fUseMixingRingBuffer = flag;}
 
   // Set which pools will be saved
   void AddEventPoolsToOutput(Double_t minCent, Double_t maxCent,  Double_t minZvtx, Double_t maxZvtx, Double_t minPt, Double_t maxPt);
 
 private:
+  static const Double_t fgkMixingTargetFraction;  // fraction of fMixingTracks after which a mixing pool is ready
+  static const Int_t    fgkMixingTargetEvents;    // number of events after which a mixing pool is ready
+
   AliAnalysisTaskPhiCorrelations(const  AliAnalysisTaskPhiCorrelations &det);
   AliAnalysisTaskPhiCorrelations&   operator=(const  AliAnalysisTaskPhiCorrelations &det);
   void            AddSettingsTree();                                  // add list of settings to output list
@@ -198,6 +204,12 @@ private:
   Bool_t IsMuEvent();
   Bool_t InitiateEventPlane(Double_t& evtPlanePhi, AliVEvent* inputEvent);
   Long64_t GetUniqueEventID(AliVEvent* inputEvent);
+  AliMixingRingBuffer* GetMixingRingBuffer(AliEventPool* pool);
+  Bool_t IsMixingPoolReady(AliEventPool* pool);
+  Int_t GetMixingPoolNEvents(AliEventPool* pool);
+  Int_t GetMixingPoolNTracks(AliEventPool* pool);
+  TObjArray* GetMixedEvent(AliEventPool* pool, Int_t jMix);
+  void UpdateMixingPool(AliEventPool* pool, TObjArray* tracks);
 
   // General configuration
   Int_t               fDebug;           //  Debug flag
@@ -316,8 +328,10 @@ private:
   vector<vector<Double_t> >   fEventPoolOutputList; // vector representing a list of pools (given by value range) that will be saved
   Bool_t                      fUsePtBinnedEventPool; // uses event pool in pt bins
   Bool_t                      fCheckEventNumberInMixedEvent; // check event number before correlation in mixed event
+  Bool_t                      fUseMixingRingBuffer; // store mixed events in AliMixingRingBuffer instead of the AliEventPool (pools cannot be saved then)
+  TMap*                       fMixingRingBuffers;   //! ring buffers (values) for each used AliEventPool (keys)
 
-  ClassDef(AliAnalysisTaskPhiCorrelations, 62); // Analysis task for delta phi correlations
+  ClassDef(AliAnalysisTaskPhiCorrelations, 63); // Analysis task for delta phi correlations
 };
 
 #endif
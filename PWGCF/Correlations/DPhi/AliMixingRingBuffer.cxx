@@ -0,0 +1,212 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id:$ */
+
+#include <algorithm>
+
+#include <TObjArray.h>
+#include <TClonesArray.h>
+
+#include "AliMixingRingBuffer.h"
+#include "AliBasicParticle.h"
+#include "AliVParticle.h"
+#include "AliLog.h"
+
+ClassImp(AliMixingRingBuffer)
+
+//____________________________________________________________________
+AliMixingRingBuffer::AliMixingRingBuffer(Int_t targetTrackDepth, Float_t targetFraction, Int_t targetEvents, Double_t ptMin, Double_t ptMax) :
+  TObject(),
+  fTargetTrackDepth(targetTrackDepth),
+  fTargetFraction(targetFraction),
+  fTargetEvents(targetEvents),
+  fPtMin(ptMin),
+  fPtMax(ptMax),
+  fFirst(0),
+  fNEvents(0),
+  fNTracks(0),
+  fEta(),
+  fPhi(),
+  fPt(),
+  fCharge(),
+  fUniqueID(),
+  fEventIndex(),
+  fView(new TClonesArray("AliBasicParticle")),
+  fViewEvent(-1)
+{
+  // constructor
+}
+
+//____________________________________________________________________
+AliMixingRingBuffer::~AliMixingRingBuffer()
+{
+  // destructor
+
+  delete fView;
+}
+
+//____________________________________________________________________
+Bool_t AliMixingRingBuffer::IsReady() const
+{
+  // same condition as AliEventPool::IsReady
+
+  return ((fNTracks >= fTargetFraction * fTargetTrackDepth) || ((fTargetEvents > 0) && (fNEvents >= fTargetEvents)));
+}
+
+//____________________________________________________________________
+Int_t AliMixingRingBuffer::NextFreeSlot()
+{
+  // returns the slot following the newest event. If all slots are in use, the slots are
+  // rotated such that the oldest event is in slot 0 and a new slot is appended
+
+  if (fNEvents < (Int_t) fEta.size())
+    return (fFirst + fNEvents) % fEta.size();
+
+  // only the outer vectors are rotated, the per-slot storage is swapped and not copied
+  std::rotate(fEta.begin(), fEta.begin() + fFirst, fEta.end());
+  std::rotate(fPhi.begin(), fPhi.begin() + fFirst, fPhi.end());
+  std::rotate(fPt.begin(), fPt.begin() + fFirst, fPt.end());
+  std::rotate(fCharge.begin(), fCharge.begin() + fFirst, fCharge.end());
+  std::rotate(fUniqueID.begin(), fUniqueID.begin() + fFirst, fUniqueID.end());
+  std::rotate(fEventIndex.begin(), fEventIndex.begin() + fFirst, fEventIndex.end());
+  fFirst = 0;
+
+  fEta.push_back(std::vector<Float_t>());
+  fPhi.push_back(std::vector<Float_t>());
+  fPt.push_back(std::vector<Float_t>());
+  fCharge.push_back(std::vector<Short_t>());
+  fUniqueID.push_back(std::vector<UInt_t>());
+  fEventIndex.push_back(std::vector<Long64_t>());
+
+  return fEta.size() - 1;
+}
+
+//____________________________________________________________________
+void AliMixingRingBuffer::RemoveFirstEvent()
+{
+  // drops the oldest event. Its slot keeps its capacity and is refilled by a later event
+
+  if (fNEvents == 0)
+    return;
+
+  fNTracks -= fPt[fFirst].size();
+  fFirst = (fFirst + 1) % fEta.size();
+  fNEvents--;
+}
+
+//____________________________________________________________________
+void AliMixingRingBuffer::UpdatePool(TObjArray* tracks, Bool_t useRapidity)
+{
+  // adds the tracks within the pT range of this pool as new event and removes the
+  // oldest event following the rules of AliEventPool::UpdatePool
+  // The input tracks are not modified or owned; this replaces CloneAndReduceTrackList + AliEventPool::UpdatePool
+
+  fViewEvent = -1;
+
+  Int_t slot = NextFreeSlot();
+
+  std::vector<Float_t>& eta = fEta[slot];
+  std::vector<Float_t>& phi = fPhi[slot];
+  std::vector<Float_t>& pt = fPt[slot];
+  std::vector<Short_t>& charge = fCharge[slot];
+  std::vector<UInt_t>& uniqueID = fUniqueID[slot];
+  std::vector<Long64_t>& eventIndex = fEventIndex[slot];
+
+  // clear() keeps the capacity, the slot is recycled in place
+  eta.clear();
+  phi.clear();
+  pt.clear();
+  charge.clear();
+  uniqueID.clear();
+  eventIndex.clear();
+
+  for (Int_t i=0; i<tracks->GetEntriesFast(); i++)
+  {
+    AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
+
+    if ( (fPtMax-fPtMin > 0) && ((particle->Pt()<fPtMin) || (particle->Pt()>=fPtMax)) )
+      continue;
+
+    // AliBasicParticle already carries y in its eta field if it was reduced with rapidity
+    AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*>(particle);
+    if (particleBasic || !useRapidity)
+      eta.push_back(particle->Eta());
+    else
+      eta.push_back(particle->Y());
+
+    phi.push_back(particle->Phi());
+    pt.push_back(particle->Pt());
+    charge.push_back(particle->Charge());
+    uniqueID.push_back(particle->GetUniqueID());
+    eventIndex.push_back((particleBasic) ? particleBasic->GetEventIndex() : 0);
+  }
+
+  Int_t mult = pt.size();
+
+  // remove 0th element before appending this event (see AliEventPool::UpdatePool)
+  if (fNTracks > fTargetTrackDepth && fNEvents > 0)
+    if (fNTracks - NTracksInEvent(0) + mult > fTargetTrackDepth)
+      RemoveFirstEvent();
+
+  fNEvents++;
+  fNTracks += mult;
+
+  AliDebug(1, Form("Added event with %d tracks; %d events with %d tracks in pool", mult, fNEvents, fNTracks));
+}
+
+//____________________________________________________________________
+TObjArray* AliMixingRingBuffer::GetEvent(Int_t iEvent)
+{
+  // returns a view of event iEvent (0 = oldest) as array of AliBasicParticle
+  // The particles are constructed in place in a recycled TClonesArray; the array stays
+  // valid until the next call to GetEvent with a different index or UpdatePool
+
+  if (iEvent < 0 || iEvent >= fNEvents)
+  {
+    AliError(Form("Invalid event %d requested (%d events in pool)", iEvent, fNEvents));
+    return 0;
+  }
+
+  if (iEvent == fViewEvent)
+    return fView;
+
+  fView->Clear();
+
+  Int_t slot = Slot(iEvent);
+  Int_t nTracks = fPt[slot].size();
+  for (Int_t i=0; i<nTracks; i++)
+  {
+    AliBasicParticle* particle = new((*fView)[i]) AliBasicParticle(fEta[slot][i], fPhi[slot][i], fPt[slot][i], fCharge[slot][i]);
+    particle->SetUniqueID(fUniqueID[slot][i]);
+    particle->SetEventIndex(fEventIndex[slot][i]);
+  }
+
+  fViewEvent = iEvent;
+
+  return fView;
+}
+
+//____________________________________________________________________
+void AliMixingRingBuffer::Clear(Option_t* /*option*/)
+{
+  // removes all events; the allocated slots are kept
+
+  fFirst = 0;
+  fNEvents = 0;
+  fNTracks = 0;
+  fViewEvent = -1;
+  fView->Clear();
+}
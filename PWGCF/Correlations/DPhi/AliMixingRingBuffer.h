@@ -0,0 +1,73 @@
+#ifndef AliMixingRingBuffer_H
+#define AliMixingRingBuffer_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+////////////////////////////////////////////////////////////////////////
+//
+// Ring buffer holding the reduced tracks of the events of one mixing
+// pool. The tracks are stored as contiguous arrays of eta, phi, pT and
+// charge per event slot. Slots of evicted events are recycled in place,
+// so that after the warm-up phase no memory is allocated per event.
+//
+// The eviction follows the same rules as AliEventPool::UpdatePool.
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include <vector>
+
+class TObjArray;
+class TClonesArray;
+
+class AliMixingRingBuffer : public TObject
+{
+public:
+  AliMixingRingBuffer(Int_t targetTrackDepth = 50000, Float_t targetFraction = 0.1, Int_t targetEvents = 5, Double_t ptMin = 0., Double_t ptMax = -1.);
+  virtual ~AliMixingRingBuffer();
+
+  void UpdatePool(TObjArray* tracks, Bool_t useRapidity = kFALSE);
+  virtual void Clear(Option_t* option = "");
+
+  Bool_t IsReady() const;
+  Int_t GetCurrentNEvents() const { return fNEvents; }
+  Int_t NTracksInPool() const { return fNTracks; }
+  Int_t NTracksInEvent(Int_t iEvent) const { return fPt[Slot(iEvent)].size(); }
+  Double_t GetPtMin() const { return fPtMin; }
+  Double_t GetPtMax() const { return fPtMax; }
+
+  TObjArray* GetEvent(Int_t iEvent);
+
+private:
+  AliMixingRingBuffer(const AliMixingRingBuffer&);
+  AliMixingRingBuffer& operator=(const AliMixingRingBuffer&);
+
+  Int_t Slot(Int_t iEvent) const { return (fFirst + iEvent) % fEta.size(); }
+  void RemoveFirstEvent();
+  Int_t NextFreeSlot();
+
+  Int_t    fTargetTrackDepth;  // number of tracks which should be kept in the pool
+  Float_t  fTargetFraction;    // fraction of fTargetTrackDepth after which the pool is ready
+  Int_t    fTargetEvents;      // number of events after which the pool is ready
+  Double_t fPtMin;             // minimum pT of stored tracks
+  Double_t fPtMax;             // maximum pT of stored tracks (no selection if < fPtMin)
+
+  Int_t fFirst;    // slot of the oldest event
+  Int_t fNEvents;  // number of events in the pool
+  Int_t fNTracks;  // number of tracks in the pool
+
+  std::vector<std::vector<Float_t> >  fEta;         //! eta (or y) per slot
+  std::vector<std::vector<Float_t> >  fPhi;         //! phi per slot
+  std::vector<std::vector<Float_t> >  fPt;          //! pT per slot
+  std::vector<std::vector<Short_t> >  fCharge;      //! charge per slot
+  std::vector<std::vector<UInt_t> >   fUniqueID;    //! unique ID per slot
+  std::vector<std::vector<Long64_t> > fEventIndex;  //! event index per slot
+
+  TClonesArray* fView;       //! recycled AliBasicParticle view on one stored event
+  Int_t         fViewEvent;  //! event currently held by fView (-1 if none)
+
+  ClassDef(AliMixingRingBuffer, 1); // ring buffer of reduced tracks for event mixing
+};
+
+#endif
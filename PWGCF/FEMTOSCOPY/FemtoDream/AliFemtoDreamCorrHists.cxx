@@ -491,3 +491,69 @@ void AliFemtoDreamCorrHists::FillMixedEventkTCentDist(
     }
   }
 }
+
+int AliFemtoDreamCorrHists::GetCentBin(float cent) {
+  //same binning as in Fill[Same/Mixed]EventkTCentDist, -1 if outside
+  int centBin=-1;
+  if (0 < cent) {
+    for (int iCent=0; iCent<fCentBins.size(); ++iCent) {
+      if (cent < fCentBins[iCent]) {
+        centBin=iCent;
+        break;
+      }
+    }
+  }
+  return centBin;
+}
+
+void AliFemtoDreamCorrHists::FillSameEventMultDist(
+    int i,int iMult,int n,const double *RelK) {
+  if (fSameEventMultDist[i]) {
+    for (int iPair=0;iPair<n;++iPair) {
+      fSameEventMultDist[i]->Fill(RelK[iPair],iMult);
+    }
+  }
+}
+
+void AliFemtoDreamCorrHists::FillSameEventkTDist(
+    int i,int n,const double *kT,const double *RelK,float cent) {
+  if (fSameEventkTDist[i]) {
+    for (int iPair=0;iPair<n;++iPair) {
+      fSameEventkTDist[i]->Fill(RelK[iPair],kT[iPair]);
+    }
+  }
+  if (fDokTCentralityBins) {
+    int centBin=GetCentBin(cent);
+    if (centBin!=-1) {
+      for (int iPair=0;iPair<n;++iPair) {
+        fSameEventkTCentDist[i][centBin]->Fill(RelK[iPair],kT[iPair]);
+      }
+    }
+  }
+}
+
+void AliFemtoDreamCorrHists::FillMixedEventMultDist(
+    int i,int iMult,int n,const double *RelK) {
+  if (fMixedEventMultDist[i]) {
+    for (int iPair=0;iPair<n;++iPair) {
+      fMixedEventMultDist[i]->Fill(RelK[iPair],iMult);
+    }
+  }
+}
+
+void AliFemtoDreamCorrHists::FillMixedEventkTDist(
+    int i,int n,const double *kT,const double *RelK,float cent) {
+  if (fMixedEventkTDist[i]) {
+    for (int iPair=0;iPair<n;++iPair) {
+      fMixedEventkTDist[i]->Fill(RelK[iPair],kT[iPair]);
+    }
+  }
+  if (fDokTCentralityBins) {
+    int centBin=GetCentBin(cent);
+    if (centBin!=-1) {
+      for (int iPair=0;iPair<n;++iPair) {
+        fMixedEventkTCentDist[i][centBin]->Fill(RelK[iPair],kT[iPair]);
+      }
+    }
+  }
+}
@@ -55,6 +55,27 @@ class AliFemtoDreamCorrHists {
   void FillMixedEventmTDist(int i,float mT,float RelK){
     if (fMixedEventmTDist[i])fMixedEventmTDist[i]->Fill(RelK,mT);
   }
+  //Bulk filling of a block of n pairs
+  void FillSameEventDist(int i,int n,const double *RelK){
+    fSameEventDist[i]->FillN(n,RelK,0);};
+  void FillSameEventMultDist(int i,int iMult,int n,const double *RelK);
+  void FillSameEventkTDist(int i,int n,const double *kT,const double *RelK,
+                           float cent);
+  void FillSameEventmTDist(int i,int n,const double *mT,const double *RelK){
+    if (fSameEventmTDist[i]) {
+      for (int iPair=0;iPair<n;++iPair) fSameEventmTDist[i]->Fill(RelK[iPair],mT[iPair]);
+    }
+  }
+  void FillMixedEventDist(int i,int n,const double *RelK){
+    fMixedEventDist[i]->FillN(n,RelK,0);};
+  void FillMixedEventMultDist(int i,int iMult,int n,const double *RelK);
+  void FillMixedEventkTDist(int i,int n,const double *kT,const double *RelK,
+                            float cent);
+  void FillMixedEventmTDist(int i,int n,const double *mT,const double *RelK){
+    if (fMixedEventmTDist[i]) {
+      for (int iPair=0;iPair<n;++iPair) fMixedEventmTDist[i]->Fill(RelK[iPair],mT[iPair]);
+    }
+  }
   void FillPartnersSE(int hist,int nPart1,int nPart2){
     if (!fMinimalBooking)fPairCounterSE[hist]->Fill(nPart1,nPart2);
   }
@@ -83,6 +104,7 @@ class AliFemtoDreamCorrHists {
   TList* GetQAHists(){return fQA;};
   TString ClassName(){return "AliFemtoDreamCorrHists";}
  private:
+  int GetCentBin(float cent);
   TList         *fQA;
   TList         *fResults;
   TList         **fPairs;
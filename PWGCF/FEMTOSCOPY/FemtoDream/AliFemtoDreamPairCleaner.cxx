@@ -5,18 +5,24 @@
  *      Author: bernhardhohlweger
  */
 
+#include <algorithm>
 #include <iostream>
 #include "AliFemtoDreamPairCleaner.h"
 ClassImp(AliFemtoDreamPairCleaner)
 AliFemtoDreamPairCleaner::AliFemtoDreamPairCleaner()
 :fMinimalBooking(false)
 ,fHists(0)
+,fIDIndex()
+,fPartners()
 {
 }
 AliFemtoDreamPairCleaner::AliFemtoDreamPairCleaner(
     int nTrackDecayChecks, int nDecayDecayChecks,bool MinimalBooking)
+:fMinimalBooking(MinimalBooking)
+,fHists(0)
+,fIDIndex()
+,fPartners()
 {
-  fMinimalBooking=MinimalBooking;
   if (!fMinimalBooking) {
     fHists=new AliFemtoDreamPairCleanerHists(
         nTrackDecayChecks,nDecayDecayChecks);
@@ -33,24 +39,30 @@ void AliFemtoDreamPairCleaner::CleanTrackAndDecay(
     std::vector<AliFemtoDreamBasePart> *Tracks,
     std::vector<AliFemtoDreamBasePart> *Decay, int histnumber)
 {
+  //A decay is removed by the first track, which is one of its daughters.
+  //The decays using a track ID are found with the index instead of looping
+  //over all the decays for every track.
   int counter=0;
-  for (auto itTrack=Tracks->begin();itTrack!=Tracks->end();++itTrack) {
-    //std::cout  << "New Track" << std::endl;
-    for (auto itDecay=Decay->begin();itDecay!=Decay->end();++itDecay) {
-      if (itDecay->UseParticle()) {
-        //std::cout  << "New v0" << std::endl;
-        std::vector<int> IDTrack=itTrack->GetIDTracks();
-        std::vector<int> IDDaug=itDecay->GetIDTracks();
-        for (auto itIDs=IDDaug.begin();itIDs!=IDDaug.end();++itIDs) {
-          //std::cout <<"ID of Track: "<<IDTrack.at(0)<<" IDs of Daughter: "
-//              <<*itIDs<<'\n';
-          if (*itIDs==IDTrack.at(0)) {
-            itDecay->SetUse(false);
+  BuildIDIndex(Decay);
+  if (!fIDIndex.empty()) {
+    for (auto itTrack=Tracks->begin();itTrack!=Tracks->end();++itTrack) {
+      int IDTrack=itTrack->GetIDTracks().at(0);
+      auto itID=std::lower_bound(fIDIndex.begin(),fIDIndex.end(),
+                                 std::make_pair(IDTrack,-1));
+      while (itID!=fIDIndex.end()&&itID->first==IDTrack) {
+        //one entry per daughter of the decay with this ID
+        AliFemtoDreamBasePart &itDecay=Decay->at(itID->second);
+        if (itDecay.UseParticle()) {
+          itDecay.SetUse(false);
+          counter++;
+          //the other daughters of the same decay with this ID are also counted
+          auto itNext=itID+1;
+          while (itNext!=fIDIndex.end()&&*itNext==*itID) {
             counter++;
+            ++itNext;
           }
         }
-      } else {
-        continue;
+        ++itID;
       }
     }
   }
@@ -59,33 +71,30 @@ void AliFemtoDreamPairCleaner::CleanTrackAndDecay(
 void AliFemtoDreamPairCleaner::CleanDecayAndDecay(
     std::vector<AliFemtoDreamBasePart> *Decay1,
     std::vector<AliFemtoDreamBasePart> *Decay2, int histnumber) {
+  //Each pair of decays with common daughters is resolved by the CPA, the one
+  //with the lower CPA is removed. The status of the second decay is not
+  //checked, such that it can still remove the first one.
   int counter=0;
+  BuildIDIndex(Decay2);
   for (auto itDecay1=Decay1->begin();itDecay1!=Decay1->end();++itDecay1) {
-    if (itDecay1->UseParticle()) {
-      for (auto itDecay2=Decay2->begin();itDecay2!=Decay2->end();++itDecay2) {
-        if (itDecay1->UseParticle()) {
-          std::vector<int> IDDaug1=itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2=itDecay2->GetIDTracks();
-          for (auto itID1s=IDDaug1.begin();itID1s!=IDDaug1.end();++itID1s) {
-            for (auto itID2s=IDDaug2.begin();itID2s!=IDDaug2.end();++itID2s) {
-              if (*itID1s==*itID2s) {
-                if (itDecay1->GetCPA() < itDecay2->GetCPA()) {
-                  itDecay1->SetUse(false);
-                  counter++;
-                } else {
-                  itDecay2->SetUse(false);
-                  counter++;
-                }
-              }
-            }
-          }
-        } else {
-          continue;
-        }
-      }
-    } else {
+    if (!itDecay1->UseParticle()) {
       continue;
     }
+    FindPartners(itDecay1->GetIDTracks(),-1);
+    auto itPartner=fPartners.begin();
+    while (itPartner!=fPartners.end()&&itDecay1->UseParticle()) {
+      //number of common daughter IDs of the pair
+      auto itLast=std::upper_bound(itPartner,fPartners.end(),*itPartner);
+      int nShared=itLast-itPartner;
+      AliFemtoDreamBasePart &itDecay2=Decay2->at(*itPartner);
+      if (itDecay1->GetCPA() < itDecay2.GetCPA()) {
+        itDecay1->SetUse(false);
+      } else {
+        itDecay2.SetUse(false);
+      }
+      counter+=nShared;
+      itPartner=itLast;
+    }
   }
   if (!fMinimalBooking) fHists->FillDaughtersSharedDaughter(histnumber,counter);
 }
@@ -93,41 +102,66 @@ void AliFemtoDreamPairCleaner::CleanDecayAndDecay(
 void AliFemtoDreamPairCleaner::CleanDecay(
     std::vector<AliFemtoDreamBasePart> *Decay,int histnumber)
 {
+  //Each pair of decays in use with common daughters is resolved by the CPA.
+  //A decay already removed keeps removing the later decays it shares
+  //daughters with, if their CPA is lower.
   int counter=0;
-  for (std::vector<AliFemtoDreamBasePart>::iterator itDecay1=Decay->begin();
-      itDecay1!=Decay->end();++itDecay1) {
-    if (itDecay1->UseParticle()) {
-      //std::cout  << "New Particle 1" << std::endl;
-      for (auto itDecay2=itDecay1+1;itDecay2!=Decay->end();++itDecay2) {
-        if (itDecay2->UseParticle()) {
-          //std::cout  << "New Particle 2" << std::endl;
-          std::vector<int> IDDaug1=itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2=itDecay2->GetIDTracks();
-          for (auto itID1s=IDDaug1.begin();itID1s!=IDDaug1.end();++itID1s) {
-            for (auto itID2s=IDDaug2.begin();itID2s!=IDDaug2.end();++itID2s) {
-              //std::cout <<"ID of Daug v01: "<<*itID1s<<" ID of Daug v02: "
-//                  <<*itID2s<<'\n';
-              if (*itID1s==*itID2s) {
-                if (itDecay1->GetCPA() < itDecay2->GetCPA()) {
-                  itDecay1->SetUse(false);
-                  counter++;
-                } else {
-                  itDecay2->SetUse(false);
-                  counter++;                }
-              }
-            }
-          }
+  BuildIDIndex(Decay);
+  for (auto itDecay1=Decay->begin();itDecay1!=Decay->end();++itDecay1) {
+    if (!itDecay1->UseParticle()) {
+      continue;
+    }
+    FindPartners(itDecay1->GetIDTracks(),itDecay1-Decay->begin());
+    auto itPartner=fPartners.begin();
+    while (itPartner!=fPartners.end()) {
+      auto itLast=std::upper_bound(itPartner,fPartners.end(),*itPartner);
+      int nShared=itLast-itPartner;
+      AliFemtoDreamBasePart &itDecay2=Decay->at(*itPartner);
+      if (itDecay2.UseParticle()) {
+        if (itDecay1->GetCPA() < itDecay2.GetCPA()) {
+          itDecay1->SetUse(false);
         } else {
-          continue;
+          itDecay2.SetUse(false);
         }
+        counter+=nShared;
       }
-    } else {
-      continue;
+      itPartner=itLast;
     }
   }
   if (!fMinimalBooking) fHists->FillDaughtersSharedDaughter(histnumber,counter);
 }
 
+void AliFemtoDreamPairCleaner::BuildIDIndex(
+    std::vector<AliFemtoDreamBasePart> *Decay)
+{
+  //(daughter ID, decay index) of all the daughters, sorted by ID and then
+  //by the position of the decay in the vector
+  fIDIndex.clear();
+  for (auto itDecay=Decay->begin();itDecay!=Decay->end();++itDecay) {
+    std::vector<int> IDDaug=itDecay->GetIDTracks();
+    for (auto itIDs=IDDaug.begin();itIDs!=IDDaug.end();++itIDs) {
+      fIDIndex.push_back(std::make_pair(*itIDs,(int)(itDecay-Decay->begin())));
+    }
+  }
+  std::sort(fIDIndex.begin(),fIDIndex.end());
+}
+
+void AliFemtoDreamPairCleaner::FindPartners(std::vector<int> IDs,int after)
+{
+  //Decays of the index sharing daughters with the given IDs and positioned
+  //after the given one, sorted. A decay appears once per common ID pair.
+  fPartners.clear();
+  for (auto itIDs=IDs.begin();itIDs!=IDs.end();++itIDs) {
+    auto itID=std::lower_bound(fIDIndex.begin(),fIDIndex.end(),
+                               std::make_pair(*itIDs,after+1));
+    while (itID!=fIDIndex.end()&&itID->first==*itIDs) {
+      fPartners.push_back(itID->second);
+      ++itID;
+    }
+  }
+  std::sort(fPartners.begin(),fPartners.end());
+}
+
 void AliFemtoDreamPairCleaner::StoreParticle(
     std::vector<AliFemtoDreamBasePart> Particles)
 {
@@ -7,6 +7,7 @@
 
 #ifndef ALIFEMTODREAMPAIRCLEANER_H_
 #define ALIFEMTODREAMPAIRCLEANER_H_
+#include <utility>
 #include <vector>
 #include "Rtypes.h"
 #include "AliFemtoDreamBasePart.h"
@@ -30,10 +31,14 @@ class AliFemtoDreamPairCleaner {
       {return fParticles;};
   void ResetArray();
  private:
+  void BuildIDIndex(std::vector<AliFemtoDreamBasePart> *Decay);
+  void FindPartners(std::vector<int> IDs,int after);
   bool fMinimalBooking;
   std::vector<std::vector<AliFemtoDreamBasePart>> fParticles;
   AliFemtoDreamPairCleanerHists *fHists;
-  ClassDef(AliFemtoDreamPairCleaner,2)
+  std::vector<std::pair<int,int>> fIDIndex; //! (daughter ID, decay) of the event
+  std::vector<int> fPartners;               //! decays sharing daughters with one decay
+  ClassDef(AliFemtoDreamPairCleaner,3)
 };
 
 #endif /* ALIFEMTODREAMPAIRCLEANER_H_ */
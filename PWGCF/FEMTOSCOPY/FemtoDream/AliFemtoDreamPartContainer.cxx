@@ -12,6 +12,9 @@
 #include "TVector3.h"
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer() : fPartBuffer(),
+    fPxBuffer(),
+    fPyBuffer(),
+    fPzBuffer(),
     fMixingDepth(0)
 {
 
@@ -19,6 +22,9 @@ AliFemtoDreamPartContainer::AliFemtoDreamPartContainer() : fPartBuffer(),
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
 :fPartBuffer(),
+ fPxBuffer(),
+ fPyBuffer(),
+ fPzBuffer(),
  fMixingDepth(MixingDepth)
 {
 
@@ -38,6 +44,9 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth=obj.fMixingDepth;
   this->fPartBuffer=obj.fPartBuffer;
+  this->fPxBuffer=obj.fPxBuffer;
+  this->fPyBuffer=obj.fPyBuffer;
+  this->fPzBuffer=obj.fPzBuffer;
   return (*this);
 }
 
@@ -47,11 +56,34 @@ AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 void AliFemtoDreamPartContainer::SetEvent(
     std::vector<AliFemtoDreamBasePart> &Particles)
 {
+  //The momentum arrays of the dropped event are recycled for the new one
+  std::vector<float> Px,Py,Pz;
   if (!(fPartBuffer.size() < fMixingDepth)){
 //    std::cout << "Popping Front" << std::endl;
     fPartBuffer.pop_front();
+    Px.swap(fPxBuffer.front());
+    Py.swap(fPyBuffer.front());
+    Pz.swap(fPzBuffer.front());
+    fPxBuffer.pop_front();
+    fPyBuffer.pop_front();
+    fPzBuffer.pop_front();
   }
   fPartBuffer.push_back(Particles);
+  Px.clear();
+  Py.clear();
+  Pz.clear();
+  for (auto itPart=Particles.begin();itPart!=Particles.end();++itPart) {
+    TVector3 P(itPart->GetMomentum());
+    Px.push_back(P.X());
+    Py.push_back(P.Y());
+    Pz.push_back(P.Z());
+  }
+  fPxBuffer.push_back(std::vector<float>());
+  fPyBuffer.push_back(std::vector<float>());
+  fPzBuffer.push_back(std::vector<float>());
+  fPxBuffer.back().swap(Px);
+  fPyBuffer.back().swap(Py);
+  fPzBuffer.back().swap(Pz);
 //  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
 //      << Particles.size() << '\n';
   return;
@@ -27,11 +27,19 @@ class AliFemtoDreamPartContainer {
   std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer()
       const {return fPartBuffer;};
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  //Momenta of the particles of one event, contiguous and in the same order
+  //as in GetEvent(Depth)
+  const std::vector<float> &GetPx(int Depth) const {return fPxBuffer[Depth];};
+  const std::vector<float> &GetPy(int Depth) const {return fPyBuffer[Depth];};
+  const std::vector<float> &GetPz(int Depth) const {return fPzBuffer[Depth];};
   unsigned int GetMixingDepth() const {return fPartBuffer.size();};
  private:
   std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
+  std::deque<std::vector<float>> fPxBuffer;
+  std::deque<std::vector<float>> fPyBuffer;
+  std::deque<std::vector<float>> fPzBuffer;
   unsigned int fMixingDepth;
-  ClassDef(AliFemtoDreamPartContainer,2);
+  ClassDef(AliFemtoDreamPartContainer,3);
 };
 
 #endif /* ALIFEMTODREAMPARTCONTAINER_H_ */
@@ -12,7 +12,14 @@
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
 :fPartContainer(0),
- fPDGParticleSpecies(0)
+ fPDGParticleSpecies(0),
+ fMassParticleSpecies(0),
+ fPx(0),
+ fPy(0),
+ fPz(0),
+ fRelK(0),
+ fkT(0),
+ fmT(0)
 {
 
 }
@@ -22,6 +29,13 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
 :fPartContainer(conf->GetNParticles(),
                 AliFemtoDreamPartContainer(conf->GetMixingDepth()))
 ,fPDGParticleSpecies(conf->GetPDGCodes())
+,fMassParticleSpecies(0)
+,fPx(0)
+,fPy(0)
+,fPz(0)
+,fRelK(0)
+,fkT(0)
+,fmT(0)
 {}
 
 AliFemtoDreamZVtxMultContainer::~AliFemtoDreamZVtxMultContainer() {
@@ -56,67 +70,61 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamCorrHists *ResultsHist,int iMult,float cent)
 {
-  float RelativeK = 0;
   int HistCounter=0;
+  SetEventKinematics(Particles);
   //First loop over all the different Species
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
   for (auto itSpec1=Particles.begin();itSpec1!=Particles.end();++itSpec1) {
-    auto itPDGPar2 = fPDGParticleSpecies.begin();
-    itPDGPar2+=itSpec1-Particles.begin();
+    int iSpec1=itSpec1-Particles.begin();
     for (auto itSpec2=itSpec1;itSpec2!=Particles.end();++itSpec2) {
+      int iSpec2=itSpec2-Particles.begin();
       ResultsHist->FillPartnersSE(HistCounter,itSpec1->size(),itSpec2->size());
-      //Now loop over the actual Particles and correlate them
-      for (auto itPart1=itSpec1->begin();itPart1!=itSpec1->end();++itPart1) {
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1==itSpec2) {
-          itPart2=itPart1+1;
-        } else {
-          itPart2=itSpec2->begin();
-        }
-        while (itPart2!=itSpec2->end()) {
-          RelativeK=RelativePairMomentum(itPart1->GetMomentum(),*itPDGPar1,
-                                         itPart2->GetMomentum(),
-                                         *itPDGPar2);
-          ResultsHist->FillSameEventDist(HistCounter,RelativeK);
-          if (ResultsHist->GetDoMultBinning()) {
-            ResultsHist->FillSameEventMultDist(HistCounter,iMult+1,RelativeK);
-          }
-          if (ResultsHist->GetDokTBinning()) {
-            ResultsHist->FillSameEventkTDist(
-                HistCounter,
-                RelativePairkT(
-                    itPart1->GetMomentum(),*itPDGPar1,
-                    itPart2->GetMomentum(),*itPDGPar2),
-                    RelativeK,cent);
-          }
-          if (ResultsHist->GetDomTBinning()) {
-            ResultsHist->FillSameEventmTDist(
-                HistCounter,
-                RelativePairmT(
-                    itPart1->GetMomentum(),*itPDGPar1,
-                    itPart2->GetMomentum(),*itPDGPar2),
-                    RelativeK);
-          }
-          if (ResultsHist->GetEtaPhiPlots()) {
-            DeltaEtaDeltaPhi(HistCounter,&(*itPart1),&(*itPart2),true,ResultsHist);
+      //Now correlate all the pairs of the two species at once
+      PairKinematics(fPx[iSpec1],fPy[iSpec1],fPz[iSpec1],GetMass(iSpec1),
+                     fPx[iSpec2],fPy[iSpec2],fPz[iSpec2],GetMass(iSpec2),
+                     itSpec1==itSpec2);
+      int nPairs=fRelK.size();
+      ResultsHist->FillSameEventDist(HistCounter,nPairs,fRelK.data());
+      if (ResultsHist->GetDoMultBinning()) {
+        ResultsHist->FillSameEventMultDist(
+            HistCounter,iMult+1,nPairs,fRelK.data());
+      }
+      if (ResultsHist->GetDokTBinning()) {
+        ResultsHist->FillSameEventkTDist(
+            HistCounter,nPairs,fkT.data(),fRelK.data(),cent);
+      }
+      if (ResultsHist->GetDomTBinning()) {
+        ResultsHist->FillSameEventmTDist(
+            HistCounter,nPairs,fmT.data(),fRelK.data());
+      }
+      if (ResultsHist->GetEtaPhiPlots()||ResultsHist->GetDodPhidEtaPlots()) {
+        //Pair by pair QA, in the same order as the pairs of the block
+        for (auto itPart1=itSpec1->begin();itPart1!=itSpec1->end();++itPart1) {
+          std::vector<AliFemtoDreamBasePart>::iterator itPart2;
+          if (itSpec1==itSpec2) {
+            itPart2=itPart1+1;
+          } else {
+            itPart2=itSpec2->begin();
           }
-          if (ResultsHist->GetDodPhidEtaPlots()) {
-            float deta=itPart1->GetEta().at(0)-itPart2->GetEta().at(0);
-            float dphi=itPart1->GetPhi().at(0)-itPart2->GetPhi().at(0);
-            if (dphi < 0) {
-              ResultsHist->FilldPhidEtaSE(HistCounter,dphi+2*TMath::Pi(),deta);
-            } else {
+          while (itPart2!=itSpec2->end()) {
+            if (ResultsHist->GetEtaPhiPlots()) {
+              DeltaEtaDeltaPhi(HistCounter,&(*itPart1),&(*itPart2),true,ResultsHist);
+            }
+            if (ResultsHist->GetDodPhidEtaPlots()) {
+              float deta=itPart1->GetEta().at(0)-itPart2->GetEta().at(0);
+              float dphi=itPart1->GetPhi().at(0)-itPart2->GetPhi().at(0);
+              if (dphi < 0) {
+                ResultsHist->FilldPhidEtaSE(HistCounter,dphi+2*TMath::Pi(),deta);
+              } else {
 
-              ResultsHist->FilldPhidEtaSE(HistCounter,dphi,deta);
+                ResultsHist->FilldPhidEtaSE(HistCounter,dphi,deta);
+              }
             }
+            ++itPart2;
           }
-          ++itPart2;
         }
       }
       ++HistCounter;
-      itPDGPar2++;
     }
-    itPDGPar1++;
   }
 }
 void AliFemtoDreamZVtxMultContainer::PairMCParticlesSE(
@@ -167,6 +175,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
 {
   float RelativeK = 0;
   int HistCounter=0;
+  SetEventKinematics(Particles);
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   //First loop over all the different Species
   for (auto itSpec1=Particles.begin();itSpec1!=Particles.end();++itSpec1) {
@@ -176,40 +185,46 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     auto itPDGPar2 = fPDGParticleSpecies.begin()+SkipPart;
     for (auto itSpec2=fPartContainer.begin()+SkipPart;
         itSpec2!=fPartContainer.end();++itSpec2) {
+      int iSpec2=itSpec2-fPartContainer.begin();
       if(itSpec1->size()>0) {
         ResultsHist->FillEffectiveMixingDepth(
             HistCounter,(int)itSpec2->GetMixingDepth());
       }
       for(int iDepth=0;iDepth<(int)itSpec2->GetMixingDepth();++iDepth){
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent=
+        //The buffered event is referenced, not copied
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent=
             itSpec2->GetEvent(iDepth);
         ResultsHist->FillPartnersME(
             HistCounter,itSpec1->size(),ParticlesOfEvent.size());
+        PairKinematics(fPx[SkipPart],fPy[SkipPart],fPz[SkipPart],
+                       GetMass(SkipPart),
+                       itSpec2->GetPx(iDepth),itSpec2->GetPy(iDepth),
+                       itSpec2->GetPz(iDepth),GetMass(iSpec2),false);
+        int nPairs=fRelK.size();
+        ResultsHist->FillMixedEventDist(HistCounter,nPairs,fRelK.data());
+        if (ResultsHist->GetDoMultBinning()) {
+          ResultsHist->FillMixedEventMultDist(
+              HistCounter,iMult+1,nPairs,fRelK.data());
+        }
+        if (ResultsHist->GetDokTBinning()) {
+          ResultsHist->FillMixedEventkTDist(
+              HistCounter,nPairs,fkT.data(),fRelK.data(),cent);
+        }
+        if (ResultsHist->GetDomTBinning()) {
+          ResultsHist->FillMixedEventmTDist(
+              HistCounter,nPairs,fmT.data(),fRelK.data());
+        }
+        if (!ResultsHist->GetObtainMomentumResolution()&&
+            !ResultsHist->GetEtaPhiPlots()&&
+            !ResultsHist->GetDodPhidEtaPlots()) {
+          continue;
+        }
+        //Pair by pair QA, in the same order as the pairs of the block
+        int iPair=0;
         for (auto itPart1=itSpec1->begin();itPart1!=itSpec1->end();++itPart1) {
           for(auto itPart2=ParticlesOfEvent.begin();
-              itPart2!=ParticlesOfEvent.end();++itPart2) {
-            RelativeK=RelativePairMomentum(itPart1->GetMomentum(),*itPDGPar1,
-                                           itPart2->GetMomentum(),*itPDGPar2);
-            ResultsHist->FillMixedEventDist(HistCounter,RelativeK);
-            if (ResultsHist->GetDoMultBinning()) {
-              ResultsHist->FillMixedEventMultDist(HistCounter,iMult+1,RelativeK);
-            }
-            if (ResultsHist->GetDokTBinning()) {
-              ResultsHist->FillMixedEventkTDist(
-                  HistCounter,
-                  RelativePairkT(
-                      itPart1->GetMomentum(),*itPDGPar1,
-                      itPart2->GetMomentum(),*itPDGPar2),
-                      RelativeK,cent);
-            }
-            if (ResultsHist->GetDomTBinning()) {
-              ResultsHist->FillMixedEventmTDist(
-                  HistCounter,
-                  RelativePairmT(
-                      itPart1->GetMomentum(),*itPDGPar1,
-                      itPart2->GetMomentum(),*itPDGPar2),
-                      RelativeK);
-            }
+              itPart2!=ParticlesOfEvent.end();++itPart2,++iPair) {
+            RelativeK=fRelK[iPair];
             if (ResultsHist->GetObtainMomentumResolution()) {
               //It is sufficient to do this in Mixed events, which allows
               //to increase the statistics. The Resolution of the tracks and therefore
@@ -246,6 +261,99 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     ++itPDGPar1;
   }
 }
+
+void AliFemtoDreamZVtxMultContainer::SetEventKinematics(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles)
+{
+  //Momenta of the particles of the current event as contiguous arrays per
+  //species, the storage is kept from event to event
+  fPx.resize(Particles.size());
+  fPy.resize(Particles.size());
+  fPz.resize(Particles.size());
+  for (unsigned int iSpec=0;iSpec<Particles.size();++iSpec) {
+    fPx[iSpec].clear();
+    fPy[iSpec].clear();
+    fPz[iSpec].clear();
+    for (auto itPart=Particles[iSpec].begin();itPart!=Particles[iSpec].end();
+        ++itPart) {
+      TVector3 P(itPart->GetMomentum());
+      fPx[iSpec].push_back(P.X());
+      fPy[iSpec].push_back(P.Y());
+      fPz[iSpec].push_back(P.Z());
+    }
+  }
+}
+
+void AliFemtoDreamZVtxMultContainer::PairKinematics(
+    const std::vector<float> &Px1,const std::vector<float> &Py1,
+    const std::vector<float> &Pz1,float Mass1,
+    const std::vector<float> &Px2,const std::vector<float> &Py2,
+    const std::vector<float> &Pz2,float Mass2,bool SameList)
+{
+  //Computes k*, kT and mT of all the pairs between the two lists of momenta,
+  //ordered as particle 1 in the outer and particle 2 in the inner loop. For
+  //the same list only the pairs with index of particle 2 > particle 1 are taken.
+  //k* is the momentum of the particles in the pair rest frame, obtained from
+  //the invariant mass of the pair, which is the same as boosting both
+  //particles to the pair rest frame as in RelativePairMomentum.
+  const int n1=Px1.size();
+  const int n2=Px2.size();
+  const int nPairs=SameList?n1*(n1-1)/2:n1*n2;
+  fRelK.resize(nPairs);
+  fkT.resize(nPairs);
+  fmT.resize(nPairs);
+  const double MassSum2=((double)Mass1+Mass2)*((double)Mass1+Mass2);
+  const double MassDiff2=((double)Mass1-Mass2)*((double)Mass1-Mass2);
+  const float averageMass=0.5*(Mass1+Mass2);
+  const double averageMass2=averageMass*averageMass;
+  double *RelK=fRelK.data();
+  double *kT=fkT.data();
+  double *mT=fmT.data();
+  int iPair=0;
+  for (int i1=0;i1<n1;++i1) {
+    const double px1=Px1[i1];
+    const double py1=Py1[i1];
+    const double pz1=Pz1[i1];
+    const double E1=TMath::Sqrt(px1*px1+py1*py1+pz1*pz1+(double)Mass1*Mass1);
+    const int first=SameList?i1+1:0;
+    //The inner loop has no branches and runs over contiguous arrays
+    for (int i2=first;i2<n2;++i2) {
+      const double px=px1+Px2[i2];
+      const double py=py1+Py2[i2];
+      const double pz=pz1+Pz2[i2];
+      const double E=E1+TMath::Sqrt((double)Px2[i2]*Px2[i2]+
+                                    (double)Py2[i2]*Py2[i2]+
+                                    (double)Pz2[i2]*Pz2[i2]+
+                                    (double)Mass2*Mass2);
+      const double s=E*E-px*px-py*py-pz*pz;
+      const double k2=(s-MassSum2)*(s-MassDiff2)/(4.*s);
+      const float pairkT=0.5*TMath::Sqrt(px*px+py*py);
+      RelK[iPair+i2-first]=(float)TMath::Sqrt(k2>0?k2:0);
+      kT[iPair+i2-first]=pairkT;
+      mT[iPair+i2-first]=(float)TMath::Sqrt(pairkT*pairkT+averageMass2);
+    }
+    iPair+=n2-first;
+  }
+}
+
+float AliFemtoDreamZVtxMultContainer::GetMass(int iSpec)
+{
+  //The masses are looked up once, also after reading the container from file
+  if (fMassParticleSpecies.size()!=fPDGParticleSpecies.size()) {
+    fMassParticleSpecies.clear();
+    for (auto itPDG=fPDGParticleSpecies.begin();
+        itPDG!=fPDGParticleSpecies.end();++itPDG) {
+      float Mass=0.;
+      if (*itPDG == 0 || !TDatabasePDG::Instance()->GetParticle(*itPDG)) {
+        AliError("Invalid PDG Code");
+      } else {
+        Mass=TDatabasePDG::Instance()->GetParticle(*itPDG)->Mass();
+      }
+      fMassParticleSpecies.push_back(Mass);
+    }
+  }
+  return fMassParticleSpecies[iSpec];
+}
 float AliFemtoDreamZVtxMultContainer::RelativePairMomentum(TVector3 Part1Momentum,
                                                            int PDGPart1,
                                                            TVector3 Part2Momentum,
@@ -281,48 +389,6 @@ float AliFemtoDreamZVtxMultContainer::RelativePairMomentum(TVector3 Part1Momentu
   results = 0.5*trackRelK.P();
   return results;
 }
-float AliFemtoDreamZVtxMultContainer::RelativePairkT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if(PDGPart1 == 0 || PDGPart2== 0){
-    AliError("Invalid PDG Code");
-  }
-  float results = 0.;
-  TLorentzVector SPtrack,TPProng,trackSum,SPtrackCMS,TPProngCMS;
-  //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
-  //only looking at the mother mass
-  SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(),Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
-  TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(),Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  trackSum = SPtrack + TPProng;
-
-  results=0.5*trackSum.Pt();
-  return results;
-}
-float AliFemtoDreamZVtxMultContainer::RelativePairmT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if(PDGPart1 == 0 || PDGPart2== 0){
-    AliError("Invalid PDG Code");
-  }
-  float results = 0.;
-  TLorentzVector SPtrack,TPProng,trackSum,SPtrackCMS,TPProngCMS;
-  //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
-  //only looking at the mother mass
-  SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(),Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
-  TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(),Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  trackSum = SPtrack + TPProng;
-  float pairKT=0.5*trackSum.Pt();
-  float averageMass = 0.5*(TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass()
-      + TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
-  results= TMath::Sqrt(pow(pairKT,2.) + pow(averageMass,2.));
-  return results;
-}
 
 void AliFemtoDreamZVtxMultContainer::DeltaEtaDeltaPhi(
     int Hist,AliFemtoDreamBasePart *part1, AliFemtoDreamBasePart *part2,
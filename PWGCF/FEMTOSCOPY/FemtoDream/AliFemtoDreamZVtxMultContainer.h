@@ -35,15 +35,26 @@ class AliFemtoDreamZVtxMultContainer {
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   TString ClassName() {return "zVtxMult Container";};
  private:
+  void SetEventKinematics(
+      std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
+  void PairKinematics(
+      const std::vector<float> &Px1,const std::vector<float> &Py1,
+      const std::vector<float> &Pz1,float Mass1,
+      const std::vector<float> &Px2,const std::vector<float> &Py2,
+      const std::vector<float> &Pz2,float Mass2,bool SameList);
+  float GetMass(int iSpec);
   float RelativePairMomentum(TVector3 Part1Momentum,int PDGPart1,
                               TVector3 Part2Momentum,int PDGPart2);
-  float RelativePairkT(TVector3 Part1Momentum,int PDGPart1,
-                       TVector3 Part2Momentum,int PDGPart2);
-  float RelativePairmT(TVector3 Part1Momentum,int PDGPart1,
-                              TVector3 Part2Momentum,int PDGPart2);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
-  ClassDef(AliFemtoDreamZVtxMultContainer,2);
+  std::vector<float> fMassParticleSpecies;  //! masses of fPDGParticleSpecies
+  std::vector<std::vector<float>> fPx;      //! momenta of the particles of the
+  std::vector<std::vector<float>> fPy;      //! current event, per species
+  std::vector<std::vector<float>> fPz;      //!
+  std::vector<double> fRelK;                //! k* of the pairs of one block
+  std::vector<double> fkT;                  //! kT of the pairs of one block
+  std::vector<double> fmT;                  //! mT of the pairs of one block
+  ClassDef(AliFemtoDreamZVtxMultContainer,3);
 };
 
 #endif /* ALIFEMTODREAMZVTXMULTCONTAINER_H_ */
@@ -42,6 +42,10 @@ The names are available via the function PairClassName(Int_t i)
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
+#include <TBits.h>
+#include <TLorentzVector.h>
 #include <TString.h>
 #include <TList.h>
 #include <TMath.h>
@@ -58,11 +62,13 @@ The names are available via the function PairClassName(Int_t i)
 #include <AliVParticle.h>
 #include <AliVTrack.h>
 #include <AliLog.h>
+#include <AliPID.h>
 #include "AliDielectronPair.h"
 #include "AliDielectronHistos.h"
 #include "AliDielectronCF.h"
 #include "AliDielectronMC.h"
 #include "AliDielectronVarManager.h"
+#include "AliDielectronVarCuts.h"
 #include "AliDielectronTrackRotator.h"
 #include "AliDielectronDebugTree.h"
 #include "AliDielectronSignalMC.h"
@@ -1421,10 +1427,41 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  //kinematic pre-selection from the packed legs, the pair object and the MC
+  //information are then only built for the pairs which can pass the pair cuts.
+  //Not possible if the rejected pairs are needed (CF container, cut QA) or
+  //if the pair kinematics is not the one of the legs (KF pairing)
+  TBits preSelVars(AliDielectronVarManager::kNMaxValues);
+  TObjArray preSelCuts;
+  Bool_t preSelect=!fUseKF && !fCfManagerPair && !(pairIndex==kEv1PM && fCutQA) &&
+                   !AliDielectronPair::GetRandomizeDaughters() && InitPairPreSelection(preSelVars,preSelCuts);
+  Double_t preSelValues[AliDielectronVarManager::kNMaxValues];
+  std::vector<Double_t> legs1, legs2;
+  if (preSelect){
+    static const Double_t mElectron=AliPID::ParticleMass(AliPID::kElectron);
+    TObjArray *arrTracks[2]={&arrTracks1,&arrTracks2};
+    std::vector<Double_t> *legs[2]={&legs1,&legs2};
+    for (Int_t iarr=0; iarr<2; ++iarr){
+      Int_t ntrack=arrTracks[iarr]->GetEntriesFast();
+      legs[iarr]->resize(6*ntrack);
+      for (Int_t itrack=0; itrack<ntrack; ++itrack){
+        // px, py, pz as in the KF daughters, E, pt (for the ordering) and charge
+        AliVTrack *track=static_cast<AliVTrack*>(arrTracks[iarr]->UncheckedAt(itrack));
+        Double_t *leg=&(*legs[iarr])[6*itrack];
+        track->PxPyPz(leg);
+        leg[3]=TMath::Sqrt(mElectron*mElectron+leg[0]*leg[0]+leg[1]*leg[1]+leg[2]*leg[2]);
+        leg[4]=track->Pt();
+        leg[5]=track->Charge();
+      }
+    }
+  }
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
+      if (preSelect && !IsPairPreSelected(&legs1[6*itrack1],&legs2[6*itrack2],preSelVars,preSelCuts,preSelValues)) continue;
+
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
       candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
                            &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
@@ -1472,6 +1509,65 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   delete candidate;
 }
 
+//________________________________________________________________
+Bool_t AliDielectron::InitPairPreSelection(TBits &vars, TObjArray &cuts) const
+{
+  //
+  // collect the pair variable cuts and the variables which can be
+  // evaluated from the legs only: mass, pt, opening angle and phiV
+  //
+  const Int_t kLegVars[4]={AliDielectronVarManager::kM, AliDielectronVarManager::kPt,
+                           AliDielectronVarManager::kOpeningAngle, AliDielectronVarManager::kPhivPair};
+  TIter next(fPairFilter.GetCuts());
+  while (TObject *obj=next()){
+    AliDielectronVarCuts *varCuts=dynamic_cast<AliDielectronVarCuts*>(obj);
+    if (!varCuts || varCuts->GetCutType()!=AliDielectronVarCuts::kAll || varCuts->GetCutOnMCtruth()) continue;
+    Bool_t used=kFALSE;
+    for (Int_t iCut=0; iCut<varCuts->GetNCuts(); ++iCut){
+      for (Int_t ivar=0; ivar<4; ++ivar){
+        if (!varCuts->IsCutOnVariableX(iCut,kLegVars[ivar])) continue;
+        vars.SetBitNumber(kLegVars[ivar]);
+        used=kTRUE;
+      }
+    }
+    if (used) cuts.Add(varCuts);
+  }
+  return cuts.GetEntriesFast()>0;
+}
+
+//________________________________________________________________
+Bool_t AliDielectron::IsPairPreSelected(const Double_t *leg1, const Double_t *leg2, const TBits &vars, const TObjArray &cuts, Double_t * const values) const
+{
+  //
+  // evaluate the pair variables in vars from the packed legs, in the same way
+  // as AliDielectronVarManager does without KF pairing, and check the cuts.
+  // Returns kFALSE only if the pair would be rejected by the pair filter
+  //
+
+  // order the legs as the daughters in AliDielectronPair::SetTracks
+  const Double_t *d1=leg1;
+  const Double_t *d2=leg2;
+  if (!(leg1[4]>leg2[4])){
+    d1=leg2;
+    d2=leg1;
+  }
+  TLorentzVector lv1(d1[0],d1[1],d1[2],d1[3]);
+  TLorentzVector lv2(d2[0],d2[1],d2[2],d2[3]);
+
+  if (vars.TestBitNumber(AliDielectronVarManager::kM))  values[AliDielectronVarManager::kM] =(lv1+lv2).M();
+  if (vars.TestBitNumber(AliDielectronVarManager::kPt)) values[AliDielectronVarManager::kPt]=(lv1+lv2).Pt();
+  if (vars.TestBitNumber(AliDielectronVarManager::kOpeningAngle)) values[AliDielectronVarManager::kOpeningAngle]=lv1.Angle(lv2.Vect());
+  if (vars.TestBitNumber(AliDielectronVarManager::kPhivPair)){
+    AliVEvent *ev=AliDielectronVarManager::GetCurrentEvent();
+    values[AliDielectronVarManager::kPhivPair]=ev ? AliDielectronPair::PhivPair(ev->GetMagneticField(),(Int_t)d1[5],d1,(Int_t)d2[5],d2) : -5;
+  }
+
+  for (Int_t icut=0; icut<cuts.GetEntriesFast(); ++icut){
+    if (!static_cast<AliDielectronVarCuts*>(cuts.UncheckedAt(icut))->IsSelectedOnFilledVars(values,vars)) return kFALSE;
+  }
+  return kTRUE;
+}
+
 //________________________________________________________________
 void AliDielectron::FillPairArrayTR()
 {
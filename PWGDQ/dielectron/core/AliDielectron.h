@@ -29,6 +29,7 @@
 #include "AliDielectronCutQA.h"
 #include "AliDielectronEvtVsTrkHist.h"
 
+class TBits;
 class AliEventplane;
 class AliVEvent;
 class AliMCEvent;
@@ -278,6 +279,8 @@ private:
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
   void PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1, TObjArray &arrTracks2, const AliVEvent *ev, Int_t prefilterN);
   void FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev = 0x0);
+  Bool_t InitPairPreSelection(TBits &vars, TObjArray &cuts) const;
+  Bool_t IsPairPreSelected(const Double_t *leg1, const Double_t *leg2, const TBits &vars, const TObjArray &cuts, Double_t * const values) const;
   void FillPairArrayTR();
 
   Int_t GetPairIndex(Int_t arr1, Int_t arr2) const {return arr1>=arr2?arr1*(arr1+1)/2+arr2:arr2*(arr2+1)/2+arr1;}
@@ -588,65 +588,78 @@ Double_t AliDielectronPair::PhivPair(Double_t MagField) const
   /// This expected ambiguity is not seen due to sorting of track arrays in this framework. 
   /// To reach the same result as for ULS (~pi), the legs are flipped for LS.
 
+  Double_t p1[3]={fD1.GetPx(),fD1.GetPy(),fD1.GetPz()};
+  Double_t p2[3]={fD2.GetPx(),fD2.GetPy(),fD2.GetPz()};
+  return PhivPair(MagField,fD1.GetQ(),p1,fD2.GetQ(),p2);
+}
+
+//______________________________________________
+Double_t AliDielectronPair::PhivPair(Double_t MagField, Int_t q1, const Double_t p1[3], Int_t q2, const Double_t p2[3])
+{
+  //
+  // PhivPair from the charges and momenta of the first and second daughter,
+  // to evaluate it from the legs without building the pair
+  //
+
   //Define local buffer variables for leg properties
   Double_t px1=-9999.,py1=-9999.,pz1=-9999.;
   Double_t px2=-9999.,py2=-9999.,pz2=-9999.;
 
-  if (fD1.GetQ()*fD2.GetQ() > 0.) { // Like Sign
+  if (q1*q2 > 0.) { // Like Sign
     if(MagField<0){ // inverted behaviour
-      if(fD1.GetQ()>0){
-        px1 = fD1.GetPx();   py1 = fD1.GetPy();   pz1 = fD1.GetPz();
-        px2 = fD2.GetPx();   py2 = fD2.GetPy();   pz2 = fD2.GetPz();
+      if(q1>0){
+        px1 = p1[0];   py1 = p1[1];   pz1 = p1[2];
+        px2 = p2[0];   py2 = p2[1];   pz2 = p2[2];
       }else{
-        px1 = fD2.GetPx();   py1 = fD2.GetPy();   pz1 = fD2.GetPz();
-        px2 = fD1.GetPx();   py2 = fD1.GetPy();   pz2 = fD1.GetPz();
+        px1 = p2[0];   py1 = p2[1];   pz1 = p2[2];
+        px2 = p1[0];   py2 = p1[1];   pz2 = p1[2];
       }
     }else{
-      if(fD1.GetQ()>0){
-        px1 = fD2.GetPx();   py1 = fD2.GetPy();   pz1 = fD2.GetPz();
-        px2 = fD1.GetPx();   py2 = fD1.GetPy();   pz2 = fD1.GetPz();
+      if(q1>0){
+        px1 = p2[0];   py1 = p2[1];   pz1 = p2[2];
+        px2 = p1[0];   py2 = p1[1];   pz2 = p1[2];
       }else{
-        px1 = fD1.GetPx();   py1 = fD1.GetPy();   pz1 = fD1.GetPz();
-        px2 = fD2.GetPx();   py2 = fD2.GetPy();   pz2 = fD2.GetPz();
+        px1 = p1[0];   py1 = p1[1];   pz1 = p1[2];
+        px2 = p2[0];   py2 = p2[1];   pz2 = p2[2];
       }
     }
   }
   else { // Unlike Sign
   if(MagField>0){ // regular behaviour
-    if(fD1.GetQ()>0){
-      px1 = fD1.GetPx();
-      py1 = fD1.GetPy();
-      pz1 = fD1.GetPz();
-
-      px2 = fD2.GetPx();
-      py2 = fD2.GetPy();
-      pz2 = fD2.GetPz();
+    if(q1>0){
+      px1 = p1[0];
+      py1 = p1[1];
+      pz1 = p1[2];
+
+      px2 = p2[0];
+      py2 = p2[1];
+      pz2 = p2[2];
     }else{
-      px1 = fD2.GetPx();
-      py1 = fD2.GetPy();
-      pz1 = fD2.GetPz();
+      px1 = p2[0];
+      py1 = p2[1];
+      pz1 = p2[2];
 
-      px2 = fD1.GetPx();
-      py2 = fD1.GetPy();
-      pz2 = fD1.GetPz();
+      px2 = p1[0];
+      py2 = p1[1];
+      pz2 = p1[2];
     }
   }else{
-    if(fD1.GetQ()>0){
-      px1 = fD2.GetPx();
-      py1 = fD2.GetPy();
-      pz1 = fD2.GetPz();
-
-      px2 = fD1.GetPx();
-      py2 = fD1.GetPy();
-      pz2 = fD1.GetPz();
+    if(q1>0){
+      px1 = p2[0];
+      py1 = p2[1];
+      pz1 = p2[2];
+
+      px2 = p1[0];
+      py2 = p1[1];
+      pz2 = p1[2];
     }else{
-      px1 = fD1.GetPx();
-      py1 = fD1.GetPy();
-      pz1 = fD1.GetPz();
+      px1 = p1[0];
+      py1 = p1[1];
+      pz1 = p1[2];
 
-      px2 = fD2.GetPx();
-      py2 = fD2.GetPy();
-      pz2 = fD2.GetPz();
+      px2 = p2[0];
+      py2 = p2[1];
+      pz2 = p2[2];
     }
    }
   }
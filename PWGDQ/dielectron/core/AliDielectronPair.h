@@ -63,7 +63,7 @@ public:
                  AliVTrack * const refParticle2);
 
   static void SetRandomizeDaughters(Bool_t random=kTRUE) { fRandomizeDaughters=random; }
-  //static Bool_t GetRandomizeDaughters() { return fRandomizeDaughters; }
+  static Bool_t GetRandomizeDaughters() { return fRandomizeDaughters; }
 
   //AliVParticle interface
   // kinematics
@@ -140,6 +140,7 @@ public:
 
   Double_t PsiPair(Double_t MagField)const; //Angle cut w.r.t. to magnetic field
   Double_t PhivPair(Double_t MagField)const; //Angle of ee plane w.r.t. to magnetic field
+  static Double_t PhivPair(Double_t MagField, Int_t q1, const Double_t p1[3], Int_t q2, const Double_t p2[3]);
 
   //Calculate the angle between ee decay plane and variables
   Double_t GetPairPlaneAngle(Double_t kv0CrpH2, Int_t VariNum) const;
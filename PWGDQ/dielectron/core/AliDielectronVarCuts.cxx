@@ -183,6 +183,27 @@ Bool_t AliDielectronVarCuts::IsSelected(TObject* track)
   return isSelected;
 }
 
+//________________________________________________________________________
+Bool_t AliDielectronVarCuts::IsSelectedOnFilledVars(const Double_t * const values, const TBits &filledVars) const
+{
+  //
+  // Cut decision using only the variables in filledVars, taken from values.
+  // Returns kFALSE only if IsSelected would fail for sure, i.e. a standard
+  // cut on a filled variable fails and the cut type is kAll. Any other cut
+  // is assumed to pass.
+  //
+  if (fCutType!=kAll || fCutOnMCtruth) return kTRUE;
+
+  for (Int_t iCut=0; iCut<fNActiveCuts; ++iCut){
+    Int_t cut=fActiveCuts[iCut];
+    // skip cuts combining two variables, together with their second variable
+    if (fVarOperation[iCut]!=AliDielectronVarCuts::kNone) { ++iCut; continue; }
+    if (fBitCut[iCut] || fUpperCut[iCut] || !filledVars.TestBitNumber(cut)) continue;
+    if ( ((values[cut]<fCutMin[iCut]) || (values[cut]>fCutMax[iCut]))^fCutExclude[iCut] ) return kFALSE;
+  }
+  return kTRUE;
+}
+
 //________________________________________________________________________
 void AliDielectronVarCuts::AddCut(AliDielectronVarManager::ValueTypes type, Double_t min, Double_t max, Bool_t excludeRange)
 {
@@ -65,6 +65,7 @@ public:
   //
   virtual Bool_t IsSelected(TObject* track);
   virtual Bool_t IsSelected(TList*   /* list */ ) {return kFALSE;}
+  Bool_t IsSelectedOnFilledVars(const Double_t * const values, const TBits &filledVars) const;
 
 //   virtual Bool_t IsSelected(TObject* track, TObject */*event*/=0);
 //   virtual Long64_t Merge(TCollection* /* list */)      { return 0; }
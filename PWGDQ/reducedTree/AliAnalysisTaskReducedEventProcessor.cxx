@@ -12,6 +12,7 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include <AliAnalysisTaskReducedEventProcessor.h>
 
 #include <iostream>
+#include <vector>
 
 #include <TROOT.h>
 #include <TTimeStamp.h>
@@ -30,6 +31,8 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include "AliHistogramManager.h"
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedEventInputHandler.h"
+#include "AliReducedVarCache.h"
+#include "AliMixingHandler.h"
 
 using std::cout;
 using std::endl;
@@ -42,9 +45,13 @@ ClassImp(AliAnalysisTaskReducedEventProcessor);
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
   AliAnalysisTaskSE(),
   fReducedTask(0x0),
+  fReducedTasks(),
   fRunningMode(kUseEventsFromTree),
   fReducedEvent(),
-  fWriteFilteredTree(kFALSE)
+  fWriteFilteredTree(kFALSE),
+  fVarCache(0x0),
+  fShareEventMixing(kTRUE),
+  fSharedMixingHandlers()
 {
   //
   // Default constructor
@@ -55,9 +62,13 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const char* name, Int_t runningMode, Bool_t writeFilteredTree) :
   AliAnalysisTaskSE(name),
   fReducedTask(0x0),
+  fReducedTasks(),
   fRunningMode(runningMode),
   fReducedEvent(),
-  fWriteFilteredTree(writeFilteredTree)
+  fWriteFilteredTree(writeFilteredTree),
+  fVarCache(0x0),
+  fShareEventMixing(kTRUE),
+  fSharedMixingHandlers()
 {
   //
   // Constructor
@@ -73,6 +84,47 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const
 }
 
 
+//_________________________________________________________________________________
+AliAnalysisTaskReducedEventProcessor::~AliAnalysisTaskReducedEventProcessor()
+{
+  //
+  // Destructor
+  //
+  if(fVarCache) delete fVarCache;
+}
+
+
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::AddTask(AliReducedAnalysisTaskSE* task)
+{
+  //
+  // Add an analysis task. All the tasks process the same events; if there is more than one,
+  // the event, track and pair variables are computed once per event and shared among the tasks.
+  // The histogram list of the first task goes to output slot 1, the ones of the other tasks
+  // go to the following output slots (see GetOutputSlot())
+  //
+  if(!task) return;
+  fReducedTasks.Add(task);
+  if(fReducedTasks.GetEntries()==1) {
+    fReducedTask = task;
+    return;
+  }
+  DefineOutput(GetOutputSlot(fReducedTasks.GetEntries()-1), THashList::Class());
+}
+
+
+//_________________________________________________________________________________
+Int_t AliAnalysisTaskReducedEventProcessor::GetOutputSlot(Int_t i) const
+{
+  //
+  // Output slot of the histogram list of task i
+  // Slot 2 is reserved for the filtered tree (written by the first task only) if requested
+  //
+  if(i==0) return 1;
+  return (fWriteFilteredTree ? 2 : 1) + i;
+}
+
+
 //______________________________________________________________________________
 void AliAnalysisTaskReducedEventProcessor::ConnectInputData(Option_t* /*option*/)
 {
@@ -105,8 +157,21 @@ void AliAnalysisTaskReducedEventProcessor::UserCreateOutputObjects()
   //
   // Add all histogram manager histogram lists to the output TList
   //
-  fReducedTask->GetHistogramManager()->AddHistogramsToOutputList();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  // tasks configured with an older version of this class only have fReducedTask set
+  if(fReducedTasks.GetEntries()==0 && fReducedTask) fReducedTasks.Add(fReducedTask);
+  
+  for(Int_t i=0; i<fReducedTasks.GetEntries(); ++i) {
+    AliReducedAnalysisTaskSE* task = (AliReducedAnalysisTaskSE*)fReducedTasks.At(i);
+    task->GetHistogramManager()->AddHistogramsToOutputList();
+    PostData(GetOutputSlot(i), task->GetHistogramManager()->GetHistogramOutputList());
+  }
+  
+  if(fReducedTasks.GetEntries()>1 && !fVarCache) {
+    fVarCache = new AliReducedVarCache();
+    for(Int_t i=0; i<fReducedTasks.GetEntries(); ++i)
+      ((AliReducedAnalysisTaskSE*)fReducedTasks.At(i))->SetVarCache(fVarCache);
+    if(fShareEventMixing) ShareEventMixing();
+  }
   
   if(fWriteFilteredTree) {
      OpenFile(2);
@@ -140,9 +205,14 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
   
   if(!event) return;
     
-  fReducedTask->SetEvent(event);
-  fReducedTask->Process();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  if(fVarCache) ProcessEvent(event);
+  else {
+    fReducedTask->SetEvent(event);
+    fReducedTask->Process();
+  }
+  
+  for(Int_t i=0; i<fReducedTasks.GetEntries(); ++i)
+    PostData(GetOutputSlot(i), ((AliReducedAnalysisTaskSE*)fReducedTasks.At(i))->GetHistogramManager()->GetHistogramOutputList());
   
   if(fWriteFilteredTree)  {
      PostData(2, fReducedTask->GetFilteredTree());
@@ -150,14 +220,82 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
 } 
 
 
+//________________________________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::ShareEventMixing() {
+  //
+  // Let the mixing handlers of the tasks share their event pools whenever their mixing settings are identical.
+  // The tracks selected by several tasks are then pooled once and each mixed pair is computed once;
+  // every task keeps its own cut bits, pair cuts and histograms
+  //
+  fSharedMixingHandlers.Clear();
+  for(Int_t i=0; i<fReducedTasks.GetEntries(); ++i) {
+    AliMixingHandler* handler = ((AliReducedAnalysisTaskSE*)fReducedTasks.At(i))->GetMixingHandler();
+    if(!handler) continue;
+    Bool_t shared = kFALSE;
+    for(Int_t j=0; j<fSharedMixingHandlers.GetEntries() && !shared; ++j)
+      shared = ((AliMixingHandler*)fSharedMixingHandlers.At(j))->ShareEventPools(handler);
+    if(!shared) fSharedMixingHandlers.Add(handler);
+  }
+  // handlers not sharing their pools keep filling them directly
+  for(Int_t j=fSharedMixingHandlers.GetEntries()-1; j>=0; --j) {
+    AliMixingHandler* handler = (AliMixingHandler*)fSharedMixingHandlers.At(j);
+    if(!handler->IsSharingEventPools()) fSharedMixingHandlers.RemoveAt(j);
+  }
+  fSharedMixingHandlers.Compress();
+  if(fSharedMixingHandlers.GetEntries())
+    AliInfo(Form("%d mixing handler(s) shared between the reduced tasks", fSharedMixingHandlers.GetEntries()));
+}
+
+
+//________________________________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::ProcessEvent(AliReducedBaseEvent* event) {
+  //
+  // Run all the tasks over the event with a single loop over the tracks.
+  // The event, track and pair variables are computed once in the shared cache.
+  // Tasks supporting staged processing (see AliReducedAnalysisTaskSE::IsStaged()) select their tracks
+  // in the common loop, each with its own cuts; the other tasks process the event on their own
+  //
+  fVarCache->SetEvent(event);
+  
+  const Int_t nTasks = fReducedTasks.GetEntries();
+  std::vector<AliReducedAnalysisTaskSE*> staged;
+  staged.reserve(nTasks);
+  for(Int_t i=0; i<nTasks; ++i) {
+    AliReducedAnalysisTaskSE* task = (AliReducedAnalysisTaskSE*)fReducedTasks.At(i);
+    task->SetEvent(event);
+    if(!task->IsStaged()) {
+      task->Process();
+      continue;
+    }
+    if(task->BeginEvent()) staged.push_back(task);
+  }
+  
+  if(!staged.empty()) {
+    for(Int_t it=0; it<fVarCache->GetNTracks(); ++it) {
+      AliReducedBaseTrack* track = fVarCache->GetTrack(it);
+      for(UInt_t i=0; i<staged.size(); ++i) staged[i]->ProcessTrack(track);
+    }
+    for(UInt_t i=0; i<staged.size(); ++i) staged[i]->EndEvent();
+  }
+  
+  // pool the tracks of the tasks sharing event mixing, once for all of them
+  for(Int_t i=0; i<fSharedMixingHandlers.GetEntries(); ++i)
+    ((AliMixingHandler*)fSharedMixingHandlers.At(i))->FillSharedEvent();
+}
+
+
 //__________________________________________________________________
 void AliAnalysisTaskReducedEventProcessor::FinishTaskOutput()
 {
     //
     // Finish Task 
     //
-  fReducedTask->Finish();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  for(Int_t i=0; i<fReducedTasks.GetEntries(); ++i) {
+    AliReducedAnalysisTaskSE* task = (AliReducedAnalysisTaskSE*)fReducedTasks.At(i);
+    task->Finish();
+    PostData(GetOutputSlot(i), task->GetHistogramManager()->GetHistogramOutputList());
+  }
+  if(fVarCache) fVarCache->Clear();
   if(fWriteFilteredTree)
      PostData(2, fReducedTask->GetFilteredTree());
   
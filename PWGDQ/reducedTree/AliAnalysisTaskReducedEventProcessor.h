@@ -11,12 +11,15 @@
 #ifndef ALIANALYSISTASKREDUCEDEVENTPROCESSOR_H
 #define ALIANALYSISTASKREDUCEDEVENTPROCESSOR_H
 
+#include <TList.h>
+
 #include "AliAnalysisTaskSE.h"
 #include "AliReducedBaseEvent.h"
 
 class TObject;
 class AliAnalysis;
 class AliReducedAnalysisTaskSE;
+class AliReducedVarCache;
 
 //_________________________________________________________
 class AliAnalysisTaskReducedEventProcessor : public AliAnalysisTaskSE {
@@ -30,9 +33,9 @@ public:
  public:
   AliAnalysisTaskReducedEventProcessor();
   AliAnalysisTaskReducedEventProcessor(const char *name, Int_t runningMode=kUseEventsFromTree, Bool_t writeFilteredTree=kFALSE);
-  virtual ~AliAnalysisTaskReducedEventProcessor(){}
+  virtual ~AliAnalysisTaskReducedEventProcessor();
 
-  void AddTask(AliReducedAnalysisTaskSE* task) {fReducedTask=task;}
+  void AddTask(AliReducedAnalysisTaskSE* task);
 
   virtual void UserExec(Option_t *);
   virtual void UserCreateOutputObjects();
@@ -42,11 +45,16 @@ public:
 
   Int_t GetRunningMode() const {return fRunningMode;}  
   AliReducedAnalysisTaskSE* GetReducedTask() const {return fReducedTask;}
+  AliReducedAnalysisTaskSE* GetReducedTask(Int_t i) const {return (i<fReducedTasks.GetEntries() ? (AliReducedAnalysisTaskSE*)fReducedTasks.At(i) : 0x0);}
+  Int_t GetNReducedTasks() const {return fReducedTasks.GetEntries();}
+  Int_t GetOutputSlot(Int_t i) const;
+  void SetShareEventMixing(Bool_t flag=kTRUE) {fShareEventMixing = flag;}
   
   Bool_t GetWriteFilteredTree() const {return fWriteFilteredTree;}
   
  protected:
   AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the analysis task which will process the reduced events
+  TList fReducedTasks;                              // All the analysis tasks processing the reduced events (fReducedTask is the first one)
   
   Int_t fRunningMode;                               // Running mode, as specified in options 1 and 2 from Constants
   
@@ -54,10 +62,17 @@ public:
   
   Bool_t fWriteFilteredTree;                   // if kTRUE, the reduced task will produce filtered reduced trees
   
+  AliReducedVarCache* fVarCache;        //! variables shared by the analysis tasks (only used with more than one task)
+  Bool_t fShareEventMixing;                  // if kTRUE, compatible mixing handlers of the tasks share their event pools
+  TList fSharedMixingHandlers;               //! mixing handlers holding pools shared with other tasks
+  
+  void ProcessEvent(AliReducedBaseEvent* event);
+  void ShareEventMixing();
+  
   AliAnalysisTaskReducedEventProcessor(const AliAnalysisTaskReducedEventProcessor &c);
   AliAnalysisTaskReducedEventProcessor& operator= (const AliAnalysisTaskReducedEventProcessor &c);
 
-  ClassDef(AliAnalysisTaskReducedEventProcessor, 4);
+  ClassDef(AliAnalysisTaskReducedEventProcessor, 6);
 };
 
 #endif
@@ -16,6 +16,7 @@ using std::endl;
 using std::flush;
 
 #include <TMath.h>
+#include <TObjArray.h>
 #include <TTimeStamp.h>
 #include <TRandom.h>
 
@@ -45,7 +46,17 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   fHistos(0x0),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
-  fLikePairsLeg2Cuts()
+  fLikePairsLeg2Cuts(),
+  fSharedPools(0x0),
+  fSharingHandlers(),
+  fSharingOffsets(),
+  fNSharedCuts(0),
+  fStagedLeg1(),
+  fStagedLeg2(),
+  fStagedFlags1(),
+  fStagedFlags2(),
+  fStagedValues(0x0),
+  fStagedType(-1)
 {
   // 
   // default constructor
@@ -84,7 +95,17 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   fHistos(0x0),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
-  fLikePairsLeg2Cuts()
+  fLikePairsLeg2Cuts(),
+  fSharedPools(0x0),
+  fSharingHandlers(),
+  fSharingOffsets(),
+  fNSharedCuts(0),
+  fStagedLeg1(),
+  fStagedLeg2(),
+  fStagedFlags1(),
+  fStagedFlags2(),
+  fStagedValues(0x0),
+  fStagedType(-1)
 {
   //
   // Named constructor
@@ -166,13 +187,30 @@ void AliMixingHandler::Init() {
     return;
   }
 
+  delete histClassArr;
+  
+  // cut bits of the handlers sharing the pools: the bits of each handler follow the ones of the previous handler
+  if(!fSharedPools && fSharingHandlers.GetEntries()==0) fSharingHandlers.Add(this);
+  fSharingOffsets.Set(fSharingHandlers.GetEntries());
+  fNSharedCuts = 0;
+  for(Int_t ih=0; ih<fSharingHandlers.GetEntries(); ++ih) {
+    AliMixingHandler* handler = (AliMixingHandler*)fSharingHandlers.At(ih);
+    if(handler!=this && !handler->fIsInitialized) handler->Init();
+    fSharingOffsets[ih] = fNSharedCuts;
+    fNSharedCuts += handler->fNParallelCuts;
+  }
+  if(fNSharedCuts>Int_t(8*sizeof(ULong_t))) {
+    cout << "AliMixingHandler::Init(): ERROR Too many cuts in the handlers sharing the pools: " << fNSharedCuts << endl;
+    return;
+  }
+  
   Int_t size = 1;
   for(Int_t iVar = 0; iVar<fNMixingVariables; ++iVar) size *= (fVariableLimits[iVar].GetSize()-1);
   fPoolsLeg1.Expand(size); fPoolsLeg1.SetOwner(kTRUE);
   fPoolsLeg2.Expand(size); fPoolsLeg2.SetOwner(kTRUE);
   
-  fPoolSize.Set(fNParallelCuts*size);
-  for(Int_t i=0;i<fNParallelCuts*size;++i) fPoolSize[i] = 0;
+  fPoolSize.Set(fNSharedCuts*size);
+  for(Int_t i=0;i<fNSharedCuts*size;++i) fPoolSize[i] = 0;
     
   // Initialize the random number generator for event/track downscaling
   TTimeStamp time;
@@ -197,8 +235,145 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   //
   // Fill the leg1 and leg2 lists in the appropriate category, based on the event 
   // characteristics (centrality, vtxz, ep)
+  // NOTE: if the pools are shared with other handlers, the tracks are only collected here;
+  //       they are added to the pools by FillSharedEvent()
   //
+  if(fSharedPools) {
+    fSharedPools->StageEvent(this, leg1List, leg2List, values, type);
+    return;
+  }
   if(!fIsInitialized) Init();
+  if(fSharingHandlers.GetEntries()>1) {
+    StageEvent(this, leg1List, leg2List, values, type);
+    return;
+  }
+  AddEventToPools(leg1List, leg2List, values, type);
+}
+
+
+//_________________________________________________________________________
+Bool_t AliMixingHandler::IsCompatible(const AliMixingHandler* handler) const {
+  //
+  // Check whether the handler mixes the same event categories with the same pool settings,
+  // such that it can share the pools of this handler
+  //
+  if(fMixingSetup!=kMixResonanceLegs || handler->fMixingSetup!=fMixingSetup) return kFALSE;
+  if(handler->fPoolDepth!=fPoolDepth || handler->fMixingThreshold!=fMixingThreshold) return kFALSE;
+  if(handler->fDownscaleEvents!=fDownscaleEvents || handler->fDownscaleTracks!=fDownscaleTracks) return kFALSE;
+  if(handler->fMixLikeSign!=fMixLikeSign) return kFALSE;
+  if(handler->fNMixingVariables!=fNMixingVariables) return kFALSE;
+  for(Int_t iVar=0; iVar<fNMixingVariables; ++iVar) {
+    if(handler->fVariables[iVar]!=fVariables[iVar]) return kFALSE;
+    if(handler->fVariableLimits[iVar].GetSize()!=fVariableLimits[iVar].GetSize()) return kFALSE;
+    for(Int_t i=0; i<fVariableLimits[iVar].GetSize(); ++i)
+      if(handler->fVariableLimits[iVar][i]!=fVariableLimits[iVar][i]) return kFALSE;
+  }
+  return kTRUE;
+}
+
+
+//_________________________________________________________________________
+Bool_t AliMixingHandler::ShareEventPools(AliMixingHandler* handler) {
+  //
+  // Let the handler use the pools of this handler. Each pooled track is stored once, with the cut bits
+  // of all the handlers which selected it, and each mixed pair is computed once for all of them.
+  // The histograms and the pair cuts stay with each handler.
+  // Must be called before the first event; returns kFALSE if the pools cannot be shared
+  //
+  if(!handler || handler==this) return kFALSE;
+  if(fSharedPools || handler->fSharedPools || handler->fSharingHandlers.GetEntries()>1) return kFALSE;
+  if(fIsInitialized || handler->fIsInitialized) return kFALSE;
+  if(!IsCompatible(handler)) return kFALSE;
+  
+  Int_t nCuts = handler->fNParallelCuts;
+  if(fSharingHandlers.GetEntries()==0) fSharingHandlers.Add(this);
+  for(Int_t ih=0; ih<fSharingHandlers.GetEntries(); ++ih)
+    nCuts += ((AliMixingHandler*)fSharingHandlers.At(ih))->fNParallelCuts;
+  if(nCuts>Int_t(8*sizeof(ULong_t))) return kFALSE;
+  
+  fSharingHandlers.Add(handler);
+  handler->fSharedPools = this;
+  return kTRUE;
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::StageEvent(AliMixingHandler* handler, TList* leg1List, TList* leg2List, Float_t* values, Int_t type) {
+  //
+  // Collect the tracks selected by one of the handlers sharing the pools
+  // The cut bits of each handler are moved to the bit range of that handler
+  //
+  if(!fIsInitialized) Init();
+  Int_t ih = fSharingHandlers.IndexOf(handler);
+  if(ih<0 || ih>=fSharingOffsets.GetSize()) return;
+  if(!fStagedValues) {
+    fStagedValues = values;
+    fStagedType = type;
+  }
+  ULong_t mask = (handler->fNParallelCuts<Int_t(8*sizeof(ULong_t)) ? (ULong_t(1)<<handler->fNParallelCuts)-1 : ~ULong_t(0));
+  StageTracks(leg1List, mask, fSharingOffsets[ih], fStagedLeg1, fStagedFlags1);
+  StageTracks(leg2List, mask, fSharingOffsets[ih], fStagedLeg2, fStagedFlags2);
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::StageTracks(TList* list, ULong_t mask, Int_t offset,
+                                   std::vector<AliReducedBaseTrack*>& tracks, std::vector<ULong_t>& flags) {
+  //
+  // Add the tracks of the list to the staged tracks, merging the cut bits of tracks selected by several handlers
+  //
+  TIter nextTrack(list);
+  AliReducedBaseTrack* track = 0x0;
+  while((track=(AliReducedBaseTrack*)nextTrack())) {
+    ULong_t trackFlags = (track->GetFlags() & mask) << offset;
+    UInt_t i = 0;
+    while(i<tracks.size() && tracks[i]!=track) ++i;     // the lists of selected legs are short
+    if(i==tracks.size()) {
+      tracks.push_back(track);
+      flags.push_back(trackFlags);
+    }
+    else flags[i] |= trackFlags;
+  }
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::FillSharedEvent() {
+  //
+  // Add the tracks collected from all the handlers sharing the pools to the pools, once per event
+  // NOTE: to be called after all the analyses have processed the event
+  //
+  if(!fStagedValues) return;
+  
+  // the tracks carry the cut bits of all the handlers while they are cloned into the pools
+  TList leg1List, leg2List;
+  std::vector<ULong_t> flags1(fStagedLeg1.size()), flags2(fStagedLeg2.size());
+  for(UInt_t i=0; i<fStagedLeg1.size(); ++i) {
+    flags1[i] = fStagedLeg1[i]->GetFlags();
+    fStagedLeg1[i]->SetFlags(fStagedFlags1[i]);
+    leg1List.Add(fStagedLeg1[i]);
+  }
+  for(UInt_t i=0; i<fStagedLeg2.size(); ++i) {
+    flags2[i] = fStagedLeg2[i]->GetFlags();
+    fStagedLeg2[i]->SetFlags(fStagedFlags2[i]);
+    leg2List.Add(fStagedLeg2[i]);
+  }
+  
+  AddEventToPools(&leg1List, &leg2List, fStagedValues, fStagedType);
+  
+  for(UInt_t i=0; i<fStagedLeg1.size(); ++i) fStagedLeg1[i]->SetFlags(flags1[i]);
+  for(UInt_t i=0; i<fStagedLeg2.size(); ++i) fStagedLeg2[i]->SetFlags(flags2[i]);
+  fStagedLeg1.clear(); fStagedFlags1.clear();
+  fStagedLeg2.clear(); fStagedFlags2.clear();
+  fStagedValues = 0x0;
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::AddEventToPools(TList* leg1List, TList* leg2List, Float_t* values, Int_t type) {
+  //
+  // Add the leg1 and leg2 lists to the pools of the event category and run the mixing on full pools
+  //
   if(leg1List->GetEntries()==0 && leg2List->GetEntries()==0) return;
   
   // randomly accept/reject this event in case fDownscaleEvents is used
@@ -284,7 +459,8 @@ Int_t AliMixingHandler::GetPoolSize(Int_t cutNumber, Float_t* values) {
    //
    // Get the pool size for a given set of (cut,centrality,z,ep)
    //
-   if(cutNumber<0 || cutNumber>fNParallelCuts) return -1;
+   if(fSharedPools) return fSharedPools->GetPoolSize(cutNumber+fSharedPools->fSharingOffsets[fSharedPools->fSharingHandlers.IndexOf(this)], values);
+   if(cutNumber<0 || cutNumber>fNSharedCuts) return -1;
    Int_t eventCategory = FindEventCategory(values);
    return GetPoolSize(cutNumber, eventCategory);
 }
@@ -295,7 +471,8 @@ Int_t AliMixingHandler::GetPoolSize(Int_t cutNumber, Int_t eventCategory) const
   //
   // Get the pool size for a given set of (cut,centrality,z,ep)
   //
-  if(cutNumber<0 || cutNumber>fNParallelCuts) return -1;
+  if(fSharedPools) return fSharedPools->GetPoolSize(cutNumber+fSharedPools->fSharingOffsets[fSharedPools->fSharingHandlers.IndexOf(this)], eventCategory);
+  if(cutNumber<0 || cutNumber>fNSharedCuts) return -1;
   if(eventCategory<0) return -1;
   
   Int_t pool = cutNumber;
@@ -314,7 +491,7 @@ void AliMixingHandler::ResetPoolSizes(ULong_t mixingMask, Int_t category) {
   Int_t nCategories = 1;
   for(Int_t iVar=0; iVar<fNMixingVariables; ++iVar) nCategories *= (fVariableLimits[iVar].GetSize() - 1);
   
-  for(Int_t icut=0; icut<fNParallelCuts; ++icut) {
+  for(Int_t icut=0; icut<fNSharedCuts; ++icut) {
     if(mixingMask&(ULong_t(1)<<icut))
 	fPoolSize[icut*nCategories+category] = 0;
   }
@@ -333,13 +510,13 @@ ULong_t AliMixingHandler::IncrementPoolSizes(TList* list1, TList* list2, Int_t e
   TIter trackIter1(list1);
   for(Int_t i=0; i<list1->GetEntries();++i) {
     track=(AliReducedBaseTrack*)trackIter1();
-    for(UShort_t icut=0;icut<fNParallelCuts;++icut)
+    for(UShort_t icut=0;icut<fNSharedCuts;++icut)
       if(track->TestFlag(icut)) cutsMask |= (ULong_t(1)<<icut);
   }
   TIter trackIter2(list2);
   for(Int_t i=0; i<list2->GetEntries();++i) {
     track=(AliReducedBaseTrack*)trackIter2();
-    for(UShort_t icut=0;icut<fNParallelCuts;++icut)
+    for(UShort_t icut=0;icut<fNSharedCuts;++icut)
       if(track->TestFlag(icut)) cutsMask |= (ULong_t(1)<<icut);
   }
     
@@ -347,7 +524,7 @@ ULong_t AliMixingHandler::IncrementPoolSizes(TList* list1, TList* list2, Int_t e
   Int_t nCategories = 1;
   for(Int_t iVar=0; iVar<fNMixingVariables; ++iVar) nCategories *= (fVariableLimits[iVar].GetSize() - 1);
   Bool_t fullPoolFound = kFALSE;
-  for(Int_t icut=0;icut<fNParallelCuts;++icut) {
+  for(Int_t icut=0;icut<fNSharedCuts;++icut) {
     if(cutsMask & (ULong_t(1)<<icut))
       fPoolSize[icut*nCategories+eventCategory] += 1;
     if(fPoolSize[icut*nCategories+eventCategory]==fPoolDepth) 
@@ -358,7 +535,7 @@ ULong_t AliMixingHandler::IncrementPoolSizes(TList* list1, TList* list2, Int_t e
   // If a completely filled pool is found, then look for the other cuts in this event category
   // to see if any of them is above the mixing threshold (fMixingThreshold)
   ULong_t mixingMask = 0;
-  for(Int_t icut=0;icut<fNParallelCuts;++icut) {
+  for(Int_t icut=0;icut<fNSharedCuts;++icut) {
     if(fPoolSize[icut*nCategories+eventCategory]>=Int_t(fMixingThreshold*fPoolDepth)) 
       mixingMask |= (ULong_t(1)<<icut);
   }
@@ -370,14 +547,19 @@ ULong_t AliMixingHandler::IncrementPoolSizes(TList* list1, TList* list2, Int_t e
 void AliMixingHandler::RunLeftoverMixing(Int_t type) {
   //
   // Run event mixing over all event categories
+  // NOTE: for shared pools, the leftover mixing is run for all the sharing handlers by the first call
   //
+  if(fSharedPools) {
+    fSharedPools->RunLeftoverMixing(type);
+    return;
+  }
   cout << "========================================================================" << endl;
   cout << "      Leftover mixing for Mixing Handler " << GetName() << endl;
   cout << "========================================================================" << endl;
   
   // create a mixing mask which enables all cuts
   ULong_t mixingMask = 0;
-  for(Int_t i=0; i<fNParallelCuts; ++i) mixingMask |= (ULong_t(1)<<i);
+  for(Int_t i=0; i<fNSharedCuts; ++i) mixingMask |= (ULong_t(1)<<i);
   Float_t values[AliReducedVarManager::kNVars];
   
   for(Int_t icateg=0; icateg<fPoolsLeg1.GetEntries(); ++icateg) {
@@ -408,7 +590,11 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  // histogram class names of each handler using these pools
+  TObjArray histClassArrays(fSharingHandlers.GetEntries());
+  histClassArrays.SetOwner(kTRUE);
+  for(Int_t ih=0; ih<fSharingHandlers.GetEntries(); ++ih)
+    histClassArrays.AddAt(((AliMixingHandler*)fSharingHandlers.At(ih))->fHistClassNames.Tokenize(";"), ih);
   
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
@@ -445,16 +631,11 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           // fill cross-pairs (leg1 - leg2) for the enabled bits
           if(fMixingSetup==kMixResonanceLegs) AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg2, type, values);
           if(fMixingSetup==kMixCorrelation)   AliReducedVarManager::FillCorrelationInfo(ev1Leg1, ev2Leg2, values);
-          if(!IsPairSelected(values, 1)) continue;   // fill histograms only if pair cuts are fulfilled
-          for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) { 
-              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
-              if(fMixingSetup==kMixCorrelation) {
-                Int_t pairType = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->PairType();
-                fHistos->FillHistClass(histClassArr->At(ibit*3+pairType)->GetName(), values);
-              }
-            }
-          }  
+          if(fMixingSetup==kMixResonanceLegs) FillHistograms(testFlags2, 1, 1, values, &histClassArrays);
+          if(fMixingSetup==kMixCorrelation) {
+            Int_t pairType = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->PairType();
+            FillHistograms(testFlags2, 1, pairType, values, &histClassArrays);
+          }
 	}  // end loop over the ev2-leg2 list
 	
 	if(fMixingSetup==kMixCorrelation) continue;
@@ -469,11 +650,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
 	  
 	  // fill like-pairs (leg1 - leg1) for the enabled bits
 	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg1, type, values);
-          if(!IsPairSelected(values, 0)) continue;   // fill histograms only if pair cuts are fulfilled
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
-          }  
+          FillHistograms(testFlags2, 0, 0, values, &histClassArrays);
 	}  // end loop over the ev2-leg1 list
       }  // end loop over the ev1-leg1 list
       
@@ -497,11 +674,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
 	  
 	  // fill like-pairs (leg2 - leg2) for the enabled bits
 	  AliReducedVarManager::FillPairInfoME(ev1Leg2, ev2Leg2, type, values);
-          if(!IsPairSelected(values, 2)) continue;   // fill histograms only if pair cuts are fulfilled
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
-          }  
+          FillHistograms(testFlags2, 2, 2, values, &histClassArrays);
 	}  // end loop over the ev2-leg2 list
       }  // end loop over the ev1-leg2 list
     }  // end second event loop
@@ -518,7 +691,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
       testFlags1 = mixingMask & track->GetFlags();
       if(!testFlags1) continue;
       
-      for(UShort_t ibit=0; ibit<fNParallelCuts; ++ibit) {
+      for(UShort_t ibit=0; ibit<fNSharedCuts; ++ibit) {
 	if((testFlags1)&(ULong_t(1)<<ibit)) 
 	  track->UnsetFlag(ibit);
       }
@@ -530,7 +703,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
       testFlags1 = mixingMask & track->GetFlags();
       if(!testFlags1) continue;
 
-      for(UShort_t ibit=0; ibit<fNParallelCuts; ++ibit) {
+      for(UShort_t ibit=0; ibit<fNSharedCuts; ++ibit) {
 	if((testFlags1)&(ULong_t(1)<<ibit)) 
 	  track->UnsetFlag(ibit);
       }
@@ -573,6 +746,28 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
 }
 
 
+//_________________________________________________________________________
+void AliMixingHandler::FillHistograms(ULong_t flags, Int_t pairType, Int_t histClass, Float_t* values, TObjArray* histClassArrays) {
+  //
+  // Fill the histograms of the mixed pair for the cut bits toggled in flags
+  // Each handler sharing the pools applies its own pair cuts and fills its own histograms
+  // pairType is used for the pair cuts (see IsPairSelected()), histClass is the class index within a cut
+  //
+  for(Int_t ih=0; ih<fSharingHandlers.GetEntries(); ++ih) {
+    AliMixingHandler* handler = (AliMixingHandler*)fSharingHandlers.At(ih);
+    ULong_t handlerFlags = flags >> fSharingOffsets[ih];
+    if(handler->fNParallelCuts<Int_t(8*sizeof(ULong_t))) handlerFlags &= ((ULong_t(1)<<handler->fNParallelCuts)-1);
+    if(!handlerFlags) continue;
+    if(!handler->IsPairSelected(values, pairType)) continue;   // fill histograms only if pair cuts are fulfilled
+    TObjArray* histClassArr = (TObjArray*)histClassArrays->At(ih);
+    for(Int_t ibit=0; ibit<handler->fNParallelCuts; ++ibit) {
+      if(handlerFlags&(ULong_t(1)<<ibit))
+        handler->fHistos->FillHistClass(histClassArr->At(ibit*3+histClass)->GetName(), values);
+    }
+  }
+}
+
+
 //_________________________________________________________________________
 Bool_t AliMixingHandler::IsPairSelected(Float_t* values, Int_t pairType) {
    //
@@ -644,8 +839,8 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
          cout << "[" << fVariableLimits[iVar][GetBinFromCategory(iVar, iCateg)] << ";" << fVariableLimits[iVar][GetBinFromCategory(iVar, iCateg)+1] << "]" << (iVar<fNMixingVariables-1 ? " -- " : "") << flush;
       cout << endl;
       cout << "====================================================================================" << endl;     
-      for(Int_t icut=0;icut<fNParallelCuts;++icut) 
-         cout << fPoolSize[icut*nCategories+iCateg] << (icut<fNParallelCuts-1 ? " -- " : "") << flush;
+      for(Int_t icut=0;icut<fNSharedCuts;++icut) 
+         cout << fPoolSize[icut*nCategories+iCateg] << (icut<fNSharedCuts-1 ? " -- " : "") << flush;
       cout << endl;
       if(debugLevel<2) continue;
       
@@ -670,7 +865,7 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
             cout << "		track #" << itrack << " (p/px/py/pz/charge/flags) :: "
             << track->P() << " / " << track->Px() << " / " 
             << track->Py() << " / " << track->Pz() << "/" << track->Charge() << " / " << flush;
-            AliReducedVarManager::PrintBits(track->GetFlags(), fNParallelCuts);	 
+            AliReducedVarManager::PrintBits(track->GetFlags(), fNSharedCuts);	 
             cout << endl;
          }  // end loop over tracks
          
@@ -681,7 +876,7 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
             cout << "		track #" << itrack << " (p/px/py/pz/charge/flags) :: "
             << track->P() << " / " << track->Px() << " / " 
             << track->Py() << " / " << track->Pz() << "/" << track->Charge() << " / " << flush;
-            AliReducedVarManager::PrintBits(track->GetFlags(), fNParallelCuts);	 
+            AliReducedVarManager::PrintBits(track->GetFlags(), fNSharedCuts);	 
             cout << endl;
          }  // end loop over tracks
       }  // end loop over events
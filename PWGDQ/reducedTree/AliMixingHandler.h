@@ -7,6 +7,8 @@
 #ifndef ALIMIXINGHANDLER_H
 #define ALIMIXINGHANDLER_H
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TArrayF.h>
 #include <TArrayI.h>
@@ -18,6 +20,8 @@
 #include "AliReducedVarManager.h"
 #include "AliReducedInfoCut.h"
 
+class AliReducedBaseTrack;
+
 class AliMixingHandler : public TNamed {
    
 public:
@@ -72,6 +76,14 @@ public:
   Int_t FindEventCategory(Float_t* values);
   Int_t GetBinFromCategory(Int_t iVar, Int_t category) const;
   void FillEvent(TList* leg1List, TList* leg2List, Float_t* values, Int_t type=-1);
+  
+  // pools shared between the handlers of several analyses processing the same events
+  // NOTE: the handler calling ShareEventPools() keeps the pools; FillEvent() of any of the sharing handlers
+  //       only collects the tracks, which are added to the pools by FillSharedEvent() once per event
+  Bool_t IsCompatible(const AliMixingHandler* handler) const;
+  Bool_t ShareEventPools(AliMixingHandler* handler);
+  Bool_t IsSharingEventPools() const {return (fSharedPools!=0x0 || fSharingHandlers.GetEntries()>1);}
+  void FillSharedEvent();
   Bool_t AcceptTrack();    // randomly accept/reject a track for mixing
   void RunLeftoverMixing(Int_t type=-1);
   void PrintMixingLists(Int_t debug);  
@@ -108,11 +120,26 @@ private:
   TList fLikePairsLeg1Cuts;    // cut object for LEG1 like pairs
   TList fLikePairsLeg2Cuts;    // cut object for LEG2 like pairs
   
+  AliMixingHandler* fSharedPools;     //! handler holding the pools used by this handler, if not this one
+  TList fSharingHandlers;             //! handlers using the pools of this handler (this one included), in the order of their cut bits
+  TArrayI fSharingOffsets;            //! first cut bit of each handler in fSharingHandlers
+  Int_t fNSharedCuts;                 //! number of cut bits in the pools, summed over fSharingHandlers
+  std::vector<AliReducedBaseTrack*> fStagedLeg1;   //! leg1 tracks of the current event, collected from the sharing handlers
+  std::vector<AliReducedBaseTrack*> fStagedLeg2;   //! leg2 tracks of the current event, collected from the sharing handlers
+  std::vector<ULong_t> fStagedFlags1;              //! cut bits of the staged leg1 tracks, in the bit range of each handler
+  std::vector<ULong_t> fStagedFlags2;              //! cut bits of the staged leg2 tracks, in the bit range of each handler
+  Float_t* fStagedValues;             //! values of the first handler which staged the current event
+  Int_t fStagedType;                  //! pair type of the staged event
+  
+  void AddEventToPools(TList* leg1List, TList* leg2List, Float_t* values, Int_t type);
+  void StageEvent(AliMixingHandler* handler, TList* leg1List, TList* leg2List, Float_t* values, Int_t type);
+  void StageTracks(TList* list, ULong_t mask, Int_t offset, std::vector<AliReducedBaseTrack*>& tracks, std::vector<ULong_t>& flags);
+  void FillHistograms(ULong_t flags, Int_t pairType, Int_t histClass, Float_t* values, TObjArray* histClassArrays);
   void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
   
-  ClassDef(AliMixingHandler,3);
+  ClassDef(AliMixingHandler,4);
 };
 
 #endif
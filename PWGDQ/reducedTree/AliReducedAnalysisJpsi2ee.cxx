@@ -44,6 +44,8 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
+  fPosTrackFlags(),
+  fNegTrackFlags(),
   fJpsiCandidates(),
   fLegCandidatesMCcuts(),
   fJpsiMotherMCcuts(),
@@ -76,6 +78,8 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
+  fPosTrackFlags(),
+  fNegTrackFlags(),
   fJpsiCandidates(),
   fLegCandidatesMCcuts(),
   fJpsiMotherMCcuts(),
@@ -230,12 +234,27 @@ void AliReducedAnalysisJpsi2ee::Process() {
   //
   // process the current event
   //  
-  if(!fEvent) return;
+  if(!BeginEvent()) return;
+  
+  // select tracks
+  if(fOptionLoopOverTracks)
+    RunTrackSelection();
+  
+  EndEvent();
+}
+
+
+//___________________________________________________________________________
+Bool_t AliReducedAnalysisJpsi2ee::BeginEvent() {
+  //
+  // fill the event variables and apply the event selection
+  //  
+  if(!fEvent) return kFALSE;
   AliReducedEventInfo* eventInfo = NULL;
   if(fEvent->IsA()==AliReducedEventInfo::Class()) eventInfo = (AliReducedEventInfo*)fEvent;
   else {
      cout << "ERROR: AliReducedAnalysisJpsi2ee::Process() needs AliReducedEventInfo events" << endl;
-     return;
+     return kFALSE;
   }
   if(fOptionRunOverMC) {
      if(fEventCounter%10000==0) 
@@ -251,10 +270,8 @@ void AliReducedAnalysisJpsi2ee::Process() {
   
   // reset the values array, keep only the run wise data (LHC and ALICE GRP information)
   // NOTE: the run wise data will be updated automatically in the VarManager in case a run change is detected
-  for(Int_t i=AliReducedVarManager::kNRunWiseVariables; i<AliReducedVarManager::kNVars; ++i) fValues[i]=-9999.;
-  
-  // fill event information before event cuts
-  AliReducedVarManager::FillEventInfo(fEvent, fValues);
+  // fill event information before event cuts (taken from the shared variable cache if the event is processed by several analyses)
+  FillEventInfo(fValues);
   fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
@@ -267,14 +284,37 @@ void AliReducedAnalysisJpsi2ee::Process() {
   
   
   // apply event selection
-  if(!IsEventSelected(fEvent)) return;
+  if(!IsEventSelected(fEvent)) return kFALSE;
   
   if(fOptionRunOverMC) FillMCTruthHistograms();
   
-  // select tracks
-  if(fOptionLoopOverTracks)
-    RunTrackSelection();
-    
+  // use the track and pair variables shared with the other analyses of this event, if any
+  SynchronizeVarCache(fValues);
+  
+  // clear the track arrays
+  if(fOptionLoopOverTracks) {
+     fPosTracks.Clear("C"); fNegTracks.Clear("C"); fPrefilterPosTracks.Clear("C"); fPrefilterNegTracks.Clear("C");
+     fPosTrackFlags.clear(); fNegTrackFlags.clear();
+     fValues[AliReducedVarManager::kEvAverageTPCchi2] = 0.0;
+  }
+  return kTRUE;
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::EndEvent() {
+  //
+  // run the prefilter, pairing and mixing on the selected tracks
+  //  
+  // restore the track cut decisions of this analysis, the tracks may have been
+  // evaluated by other analyses since (see AliAnalysisTaskReducedEventProcessor)
+  if(fOptionLoopOverTracks) {
+     TIter nextPosTrack(&fPosTracks);
+     for(UInt_t i=0; i<fPosTrackFlags.size(); ++i) ((AliReducedBaseTrack*)nextPosTrack())->SetFlags(fPosTrackFlags[i]);
+     TIter nextNegTrack(&fNegTracks);
+     for(UInt_t i=0; i<fNegTrackFlags.size(); ++i) ((AliReducedBaseTrack*)nextNegTrack())->SetFlags(fNegTrackFlags[i]);
+  }
+  
   // Run the prefilter  
   // NOTE: Pair each track from the selected tracks list with all selected tracks in the prefilter track list
   //         If the created pair fails the pair prefilter criteria, then the selected trak is removed from the track list
@@ -331,7 +371,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       // reset track variables
       for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
       
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       FillTrackHistograms(track, trackClass);
    }
    TIter nextNegTrack(&fNegTracks);
@@ -342,7 +382,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       // reset track variables
       for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
       
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       FillTrackHistograms(track, trackClass);
    }
 }
@@ -434,11 +474,8 @@ void AliReducedAnalysisJpsi2ee::FillPairHistograms(ULong_t mask, Int_t pairType,
 void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
    //
    // select electron candidates and prefilter tracks
+   // NOTE: the track arrays are cleared in BeginEvent()
    //
-   // clear the track arrays
-   fPosTracks.Clear("C"); fNegTracks.Clear("C"); fPrefilterPosTracks.Clear("C"); fPrefilterNegTracks.Clear("C");
-   fValues[AliReducedVarManager::kEvAverageTPCchi2] = 0.0;
-   
    // loop over the track list(s) and evaluate all the track cuts
    LoopOverTracks(1);      // first array
    LoopOverTracks(2);      // second array (if used)
@@ -449,52 +486,60 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
    //
    // Loop over a given track array, apply cuts and add selected tracks to arrays
    //
-   AliReducedBaseTrack* track = 0x0;
    TClonesArray* trackList = (arrayOption==1 ? fEvent->GetTracks() : fEvent->GetTracks2());
    if (!trackList) return;
 
    TIter nextTrack(trackList);
-   for(Int_t it=0; it<trackList->GetEntries(); ++it) {
-      track = (AliReducedBaseTrack*)nextTrack();
-      // do not loop over pure MC truth tracks 
-      // NOTE: this can be also handled via AliReducedTrackCut::SetRejectPureMC()
-      if(fOptionRunOverMC && track->IsMCTruth()) continue;     
-      // reset track variables
-      for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
+   for(Int_t it=0; it<trackList->GetEntries(); ++it)
+      ProcessTrack((AliReducedBaseTrack*)nextTrack());
+}
 
-      AliReducedVarManager::FillTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
-      
-      if(track->IsA() == AliReducedTrackInfo::Class()) {
-         AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
-         if(trackInfo) {
-            for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
-               AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-               fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
-            }
-            for(Int_t iLayer=0; iLayer<6; ++iLayer) {
-               AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
-            }
-            for(Int_t iLayer=0; iLayer<8; ++iLayer) {
-               AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
-            }
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::ProcessTrack(AliReducedBaseTrack* track) {
+   //
+   // Apply the track cuts on a track and add it to the selected track arrays
+   // NOTE: the cut decisions are kept in fPosTrackFlags and fNegTrackFlags, since the track flags
+   //       may be overwritten by other analyses evaluating the same track before EndEvent()
+   //
+   if(!fOptionLoopOverTracks) return;
+   // do not loop over pure MC truth tracks 
+   // NOTE: this can be also handled via AliReducedTrackCut::SetRejectPureMC()
+   if(fOptionRunOverMC && track->IsMCTruth()) return;
+   // reset track variables
+   for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
+
+   FillTrackInfo(track, fValues);
+   fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+   
+   if(track->IsA() == AliReducedTrackInfo::Class()) {
+      AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
+      if(trackInfo) {
+         for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
+            AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
+            fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+         }
+         for(Int_t iLayer=0; iLayer<6; ++iLayer) {
+            AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
+            fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+         }
+         for(Int_t iLayer=0; iLayer<8; ++iLayer) {
+            AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
+            fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
          }
       }
+   }
+   
+   if(IsTrackSelected(track, fValues)) {
+      if(track->Charge()>0) {fPosTracks.Add(track); fPosTrackFlags.push_back(track->GetFlags());}
+      if(track->Charge()<0) {fNegTracks.Add(track); fNegTrackFlags.push_back(track->GetFlags());}
       
-      if(IsTrackSelected(track, fValues)) {
-         if(track->Charge()>0) fPosTracks.Add(track);
-         if(track->Charge()<0) fNegTracks.Add(track);
-         
-         if(track->IsA() == AliReducedTrackInfo::Class())
-            fValues[AliReducedVarManager::kEvAverageTPCchi2] += ((AliReducedTrackInfo*)track)->TPCchi2();
-      }
-      if(IsTrackPrefilterSelected(track, fValues)) {
-         if(track->Charge()>0) fPrefilterPosTracks.Add(track);
-         if(track->Charge()<0) fPrefilterNegTracks.Add(track);
-      }
-   }   // end loop over tracks
+      if(track->IsA() == AliReducedTrackInfo::Class())
+         fValues[AliReducedVarManager::kEvAverageTPCchi2] += ((AliReducedTrackInfo*)track)->TPCchi2();
+   }
+   if(IsTrackPrefilterSelected(track, fValues)) {
+      if(track->Charge()>0) fPrefilterPosTracks.Add(track);
+      if(track->Charge()<0) fPrefilterNegTracks.Add(track);
+   }
 }
 
 //___________________________________________________________________________
@@ -521,7 +566,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
          
          // verify that the two current tracks have at least 1 common bit
          if(!(pTrack->GetFlags() & nTrack->GetFlags())) continue;
-         AliReducedVarManager::FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
          if(IsPairSelected(fValues)) {
             FillPairHistograms(pTrack->GetFlags() & nTrack->GetFlags(), 1, pairClass, (fOptionRunOverMC ? CheckReconstructedLegMCTruth(pTrack, nTrack) : 0));    // 1 is for +- pairs 
             fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -544,7 +589,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
          
             // verify that the two current tracks have at least 1 common bit
             if(!(pTrack->GetFlags() & pTrack2->GetFlags())) continue;
-            AliReducedVarManager::FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
                FillPairHistograms(pTrack->GetFlags() & pTrack2->GetFlags(), 0, pairClass);       // 0 is for ++ pairs 
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -573,7 +618,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
          
             // verify that the two current tracks have at least 1 common bit
             if(!(nTrack->GetFlags() & nTrack2->GetFlags())) continue;
-            AliReducedVarManager::FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
                FillPairHistograms(nTrack->GetFlags() & nTrack2->GetFlags(), 2, pairClass);      // 2 is for -- pairs
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -616,7 +661,7 @@ void AliReducedAnalysisJpsi2ee::RunPrefilter() {
          trackPref = (AliReducedBaseTrack*)nextPosPrefilterTrack();
          
          if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -627,7 +672,7 @@ void AliReducedAnalysisJpsi2ee::RunPrefilter() {
       for(Int_t ipn = 0; ipn<fPrefilterNegTracks.GetEntries(); ++ipn) {
          trackPref = (AliReducedBaseTrack*)nextNegPrefilterTrack();
          
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -642,7 +687,7 @@ void AliReducedAnalysisJpsi2ee::RunPrefilter() {
       for(Int_t ipp = 0; ipp<fPrefilterPosTracks.GetEntries(); ++ipp) {
          trackPref = (AliReducedBaseTrack*)nextPosPrefilterTrack();
          
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -654,7 +699,7 @@ void AliReducedAnalysisJpsi2ee::RunPrefilter() {
          trackPref = (AliReducedBaseTrack*)nextNegPrefilterTrack();
          
          if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -5,6 +5,8 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EE_H
 #define ALIREDUCEDANALYSISJPSI2EE_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -30,6 +32,11 @@ public:
   virtual void Process();
   // finish, to be executed after all events were processed
   virtual void Finish();
+  // staged processing, see AliReducedAnalysisTaskSE
+  virtual Bool_t IsStaged() const {return kTRUE;}
+  virtual Bool_t BeginEvent();
+  virtual void ProcessTrack(AliReducedBaseTrack* track);
+  virtual void EndEvent();
   
   // setters
   void AddEventCut(AliReducedInfoCut* cut) {fEventCuts.Add(cut);}
@@ -97,6 +104,8 @@ protected:
    TList fNegTracks;              // list of selected negative tracks in the current event
    TList fPrefilterPosTracks;  // list of prefilter selected positive tracks in the current event
    TList fPrefilterNegTracks; // list of prefilter selected negative tracks in the current event
+   std::vector<ULong_t> fPosTrackFlags;   //! track cut decisions of the selected positive tracks
+   std::vector<ULong_t> fNegTrackFlags;   //! track cut decisions of the selected negative tracks
    TList fJpsiCandidates;       // list of Jpsi candidates --> to be used in analyses inheriting from this 
    
    // selection based on the MC truth information of the reconstructed leg candidates
@@ -140,7 +149,7 @@ protected:
   void FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass = "PairSE", UInt_t mcDecisions = 0);
   void FillMCTruthHistograms();
   
-  ClassDef(AliReducedAnalysisJpsi2ee,5);
+  ClassDef(AliReducedAnalysisJpsi2ee,6);
 };
 
 #endif
@@ -180,7 +180,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::LoopOverAssociatedTracks(Int_t array
    for (Int_t itr=0; itr<trackList->GetEntries(); ++itr) {
       track = (AliReducedTrackInfo*)nextTrack();
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       fHistosManager->FillHistClass("AssociatedTrack_BeforeCuts", fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
@@ -249,7 +249,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::FillAssociatedTrackHistograms(TStrin
   TIter nextAssocTrack(&fAssociatedTracks);
   for(Int_t i=0;i<fAssociatedTracks.GetEntries();++i) {
     track = (AliReducedTrackInfo*)nextAssocTrack();
-    AliReducedVarManager::FillTrackInfo(track, fValues);
+    FillTrackInfo(track, fValues);
     FillAssociatedTrackHistograms(track, trackClass);
   }
 }
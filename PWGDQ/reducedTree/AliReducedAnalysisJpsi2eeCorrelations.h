@@ -38,6 +38,8 @@ public:
   virtual void Process();
   // finish, to be executed after all events were processed
   virtual void Finish();
+  // Process() is extended with the correlation stage, so this analysis is not processed in stages
+  virtual Bool_t IsStaged() const {return kFALSE;}
 
   // setters
   void AddAssociatedTrackCut(AliReducedInfoCut* cut);
@@ -231,10 +231,8 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
   
   // reset the values array, keep only the run wise data (LHC and ALICE GRP information)
   // NOTE: the run wise data will be updated automatically in the VarManager in case a run change is detected
-  for(Int_t i=AliReducedVarManager::kNRunWiseVariables; i<AliReducedVarManager::kNVars; ++i) fValues[i]=-9999.;
-  
-  // fill event information before event cuts
-  AliReducedVarManager::FillEventInfo(fEvent, fValues);
+  // fill event information before event cuts (taken from the shared variable cache if the event is processed by several analyses)
+  FillEventInfo(fValues);
   fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
@@ -251,6 +249,9 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
   
   if(fOptionRunOverMC) FillMCTruthHistograms();
   
+  // use the track and pair variables shared with the other analyses of this event, if any
+  SynchronizeVarCache(fValues);
+  
   // select tracks
   if(fOptionLoopOverTracks)
     RunTrackSelection();
@@ -308,7 +309,7 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       track = (AliReducedTrackInfo*)nextPosTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       FillTrackHistograms(track, Form("%s+", trackClass.Data()) );
       FillTrackHistograms(track, Form("%s", trackClass.Data()) );
    }
@@ -317,7 +318,7 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       track = (AliReducedTrackInfo*)nextNegTrack();
       //Int_t tpcSector = TMath::FloorNint(18.*track->Phi()/TMath::TwoPi());
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       FillTrackHistograms(track, Form("%s-", trackClass.Data()) );
       FillTrackHistograms(track, Form("%s", trackClass.Data()) );
       //cout << "Neg track " << i << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
@@ -388,7 +389,7 @@ void AliReducedAnalysisJpsi2eeMult::RunTrackSelection() {
       track = (AliReducedTrackInfo*)nextTrack();
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
       //cout << "track " << it << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
-      AliReducedVarManager::FillTrackInfo(track, fValues);
+      FillTrackInfo(track, fValues);
       fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          //cout << "track / tracking flags :: " << track << " / "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
@@ -446,7 +447,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
                RunTrackRotation(pTrackCopy, nTrackCopy, 1);
              }
          }
-         AliReducedVarManager::FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
          if(IsPairSelected(fValues)) {
             FillPairHistograms(pTrack->GetFlags() & nTrack->GetFlags(), 1, pairClass, fOptionRunOverMC && IsMCTruth(pTrack, nTrack));    // 1 is for +- pairs 
             fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -466,7 +467,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
                 RunTrackRotation(pTrackCopy, pTrack2Copy, 0);
               }
             }
-            AliReducedVarManager::FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
                FillPairHistograms(pTrack->GetFlags() & pTrack2->GetFlags(), 0, pairClass);       // 0 is for ++ pairs 
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -492,7 +493,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
                 RunTrackRotation(nTrack2Copy, nTrackCopy, 2);
               }
             }
-            AliReducedVarManager::FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
                FillPairHistograms(nTrack->GetFlags() & nTrack2->GetFlags(), 2, pairClass);      // 2 is for -- pairs
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
@@ -525,7 +526,7 @@ void AliReducedAnalysisJpsi2eeMult::RunPrefilter() {
          trackPref = (AliReducedTrackInfo*)nextPosPrefilterTrack();
          
          if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -536,7 +537,7 @@ void AliReducedAnalysisJpsi2eeMult::RunPrefilter() {
       for(Int_t ipn = 0; ipn<fPrefilterNegTracks.GetEntries(); ++ipn) {
          trackPref = (AliReducedTrackInfo*)nextNegPrefilterTrack();
          
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -551,7 +552,7 @@ void AliReducedAnalysisJpsi2eeMult::RunPrefilter() {
       for(Int_t ipp = 0; ipp<fPrefilterPosTracks.GetEntries(); ++ipp) {
          trackPref = (AliReducedTrackInfo*)nextPosPrefilterTrack();
          
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
@@ -563,7 +564,7 @@ void AliReducedAnalysisJpsi2eeMult::RunPrefilter() {
          trackPref = (AliReducedTrackInfo*)nextNegPrefilterTrack();
          
          if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
+         FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
          if(!IsPairPreFilterSelected(fValues)) {
             track->ResetFlags(); 
             break;
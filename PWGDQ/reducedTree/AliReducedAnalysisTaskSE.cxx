@@ -9,6 +9,8 @@
 
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedEventInfo.h"
+#include "AliReducedBaseTrack.h"
+#include "AliReducedVarCache.h"
 
 ClassImp(AliReducedAnalysisTaskSE);
 
@@ -25,7 +27,9 @@ AliReducedAnalysisTaskSE::AliReducedAnalysisTaskSE() :
   fFilteredEvent(0x0),
   fFilteredTreeWritingOption(kBaseEventsWithBaseTracks),
   fProcessMCInfo(kFALSE),
-  fEventCounter(0)
+  fEventCounter(0),
+  fVarCache(0x0),
+  fUseVarCache(kFALSE)
 {
   //
   // default constructor
@@ -48,7 +52,9 @@ AliReducedAnalysisTaskSE::AliReducedAnalysisTaskSE(const Char_t* name, const Cha
   fFilteredEvent(0x0),
   fFilteredTreeWritingOption(kBaseEventsWithBaseTracks),
   fProcessMCInfo(kFALSE),
-  fEventCounter(0)
+  fEventCounter(0),
+  fVarCache(0x0),
+  fUseVarCache(kFALSE)
 {
   //
   // named constructor
@@ -127,3 +133,48 @@ void AliReducedAnalysisTaskSE::Finish() {
    // finish, to be executed after all events were processed
    //
 }
+
+//___________________________________________________________________________
+void AliReducedAnalysisTaskSE::FillEventInfo(Float_t* values) {
+   //
+   // reset the non run wise variables and fill the event variables of the current event
+   // If a shared cache is set for this event, the variables are copied from it
+   //
+   fUseVarCache = kFALSE;
+   if(fVarCache && fVarCache->GetEvent()==fEvent) {
+      fVarCache->FillEventInfo(values);
+      return;
+   }
+   AliReducedVarManager::SetEvent(fEvent);
+   for(Int_t i=AliReducedVarManager::kNRunWiseVariables; i<AliReducedVarManager::kNVars; ++i) values[i]=-9999.;
+   AliReducedVarManager::FillEventInfo(fEvent, values);
+}
+
+//___________________________________________________________________________
+Bool_t AliReducedAnalysisTaskSE::SynchronizeVarCache(const Float_t* values) {
+   //
+   // to be called after the event variables were filled and modified by this analysis and before
+   // its track loop; the cache is used in this event only if the event variables match the ones
+   // the shared track and pair variables are computed from
+   //
+   fUseVarCache = (fVarCache && fVarCache->GetEvent()==fEvent && fVarCache->Synchronize(values));
+   return fUseVarCache;
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisTaskSE::FillTrackInfo(AliReducedBaseTrack* track, Float_t* values) {
+   //
+   // fill the track variables, from the shared cache if available
+   //
+   if(fUseVarCache && fVarCache->FillTrackInfo(track, values)) return;
+   AliReducedVarManager::FillTrackInfo(track, values);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisTaskSE::FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values) {
+   //
+   // fill the pair variables, from the shared cache if available
+   //
+   if(fUseVarCache && fVarCache->FillPairInfo(t1, t2, type, values)) return;
+   AliReducedVarManager::FillPairInfo(t1, t2, type, values);
+}
@@ -18,6 +18,10 @@
 #include "AliHistogramManager.h"
 #include "AliReducedBaseEvent.h"
 
+class AliReducedBaseTrack;
+class AliReducedVarCache;
+class AliMixingHandler;
+
 //________________________________________________________________
 class AliReducedAnalysisTaskSE : public TObject {
   
@@ -42,10 +46,22 @@ public:
   virtual void Finish();
   // add output objects;
   
+  // staged processing, used by AliAnalysisTaskReducedEventProcessor to evaluate the track cuts of several
+  // analyses in a single loop over the tracks. Process() is equivalent to BeginEvent(), ProcessTrack() for
+  // all the tracks of the event (both track arrays) if the event is selected, and EndEvent()
+  virtual Bool_t IsStaged() const {return kFALSE;}
+  // event variables and event selection, kFALSE if the event is rejected
+  virtual Bool_t BeginEvent() {return kFALSE;}
+  // track variables and track cuts
+  virtual void ProcessTrack(AliReducedBaseTrack* /*track*/) {}
+  // everything after the track selection (prefilter, pairing, mixing, ...)
+  virtual void EndEvent() {}
+  
   void InitFilteredTree();
   
   // setters
-  void SetEvent(AliReducedBaseEvent* event) {fEvent = event;}
+  void SetEvent(AliReducedBaseEvent* event) {fEvent = event; fUseVarCache = kFALSE;}
+  void SetVarCache(AliReducedVarCache* cache) {fVarCache = cache;}
   
   void SetFilteredTreeWritingOption(Int_t option)         {fFilteredTreeWritingOption = option;}
   void SetFilteredTreeActiveBranch(TString b)   {fActiveBranches+=b+";";}
@@ -54,15 +70,25 @@ public:
   
   // getters
   virtual AliHistogramManager* GetHistogramManager() const = 0;
+  virtual AliMixingHandler* GetMixingHandler() const {return 0x0;}
   AliReducedBaseEvent* GetEvent() const {return fEvent;}
   TTree* GetFilteredTree() {return fFilteredTree;}
   Int_t GetFilteredTreeWritingOption() const {return fFilteredTreeWritingOption;}
   Bool_t ProcessMC() const {return fProcessMCInfo;}
+  AliReducedVarCache* GetVarCache() const {return fVarCache;}
   
 protected:
   AliReducedAnalysisTaskSE(const AliReducedAnalysisTaskSE& task);             
   AliReducedAnalysisTaskSE& operator=(const AliReducedAnalysisTaskSE& task);      
   
+  // fill the variables of the current event, of a track or of a pair, using the shared cache if available
+  // NOTE: the track and pair variables are taken from the cache only after SynchronizeVarCache() was called
+  //       in the current event and found the event variables in values identical to the ones of the cache
+  void FillEventInfo(Float_t* values);
+  Bool_t SynchronizeVarCache(const Float_t* values);
+  void FillTrackInfo(AliReducedBaseTrack* track, Float_t* values);
+  void FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
+  
   TString fName;             // name
   TString fTitle;                // title
     
@@ -78,7 +104,10 @@ protected:
   
   ULong_t fEventCounter;   // event counter
   
-  ClassDef(AliReducedAnalysisTaskSE, 4)
+  AliReducedVarCache* fVarCache;     //! variables shared with other analyses processing the same event (not owned)
+  Bool_t fUseVarCache;               //! track and pair variables taken from fVarCache in the current event
+  
+  ClassDef(AliReducedAnalysisTaskSE, 5)
 };
 
 #endif
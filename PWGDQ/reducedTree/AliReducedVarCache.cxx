@@ -0,0 +1,252 @@
+//
+// Cache of the AliReducedVarManager variables, shared by analyses processing the same event
+//
+
+#include "AliReducedVarCache.h"
+
+#include <cstring>
+
+#include <TClonesArray.h>
+#include <TMath.h>
+
+#include "AliReducedBaseEvent.h"
+#include "AliReducedBaseTrack.h"
+
+ClassImp(AliReducedVarCache);
+
+
+//___________________________________________________________________________
+AliReducedVarCache::AliReducedVarCache() :
+  TObject(),
+  fEvent(0x0),
+  fHasRefValues(kFALSE),
+  fTracks(),
+  fTrackBlocks(),
+  fTrackLegs(),
+  fNLegs(0),
+  fPairTypes(),
+  fPairBlocks(),
+  fBlockOffsets(1, 0),
+  fVarIndices(),
+  fVarValues()
+{
+  //
+  // default constructor
+  //
+  for(Int_t i=0; i<AliReducedVarManager::kNVars; ++i) {
+    fEventValues[i] = -9999.;
+    fScratch[i] = -9999.;
+  }
+  for(Int_t i=0; i<AliReducedVarManager::kNEventVars; ++i) fRefValues[i] = -9999.;
+}
+
+
+//___________________________________________________________________________
+AliReducedVarCache::~AliReducedVarCache()
+{
+  //
+  // destructor
+  //
+}
+
+
+//___________________________________________________________________________
+void AliReducedVarCache::Clear(Option_t* /*option*/)
+{
+  //
+  // drop the cached track and pair variables; the storage is kept for the next event
+  //
+  fEvent = 0x0;
+  fHasRefValues = kFALSE;
+  fTracks.clear();
+  fTrackBlocks.clear();
+  fTrackLegs.clear();
+  fNLegs = 0;
+  for(UInt_t it=0; it<fPairBlocks.size(); ++it)
+    for(UInt_t il=0; il<fPairBlocks[it].size(); ++il) fPairBlocks[it][il].clear();
+  fBlockOffsets.assign(1, 0);
+  fVarIndices.clear();
+  fVarValues.clear();
+}
+
+
+//___________________________________________________________________________
+void AliReducedVarCache::SetEvent(AliReducedBaseEvent* event)
+{
+  //
+  // compute the event variables for a new event and index its tracks
+  // NOTE: the run wise variables are kept, they are updated by the var manager on run change
+  // NOTE: the position of each track in the event is stored in its unique ID
+  //
+  Clear();
+  fEvent = event;
+  if(!fEvent) return;
+
+  AliReducedVarManager::SetEvent(fEvent);
+  for(Int_t i=AliReducedVarManager::kNRunWiseVariables; i<AliReducedVarManager::kNVars; ++i) fEventValues[i]=-9999.;
+  AliReducedVarManager::FillEventInfo(fEvent, fEventValues);
+
+  TClonesArray* trackLists[2] = {fEvent->GetTracks(), fEvent->GetTracks2()};
+  for(Int_t il=0; il<2; ++il) {
+    if(!trackLists[il]) continue;
+    for(Int_t it=0; it<trackLists[il]->GetEntries(); ++it) {
+      AliReducedBaseTrack* track = (AliReducedBaseTrack*)trackLists[il]->At(it);
+      track->SetUniqueID(fTracks.size());
+      fTracks.push_back(track);
+    }
+  }
+  fTrackBlocks.assign(fTracks.size(), -1);
+  fTrackLegs.assign(fTracks.size(), -1);
+}
+
+
+//___________________________________________________________________________
+Bool_t AliReducedVarCache::Synchronize(const Float_t* values)
+{
+  //
+  // called by an analysis before its track loop, with its own values array
+  // The first analysis sets the event variables used to compute the track and pair variables.
+  // Returns kTRUE if the analysis can use the cache, i.e. if its event variables are identical
+  //
+  if(!fEvent) return kFALSE;
+  if(!fHasRefValues) {
+    memcpy(fRefValues, values, AliReducedVarManager::kNEventVars*sizeof(Float_t));
+    fHasRefValues = kTRUE;
+    return kTRUE;
+  }
+  return (memcmp(fRefValues, values, AliReducedVarManager::kNEventVars*sizeof(Float_t))==0);
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedVarCache::GetTrackSlot(const AliReducedBaseTrack* track) const
+{
+  //
+  // position of the track in the event, -1 if the track does not belong to the current event
+  //
+  UInt_t slot = track->GetUniqueID();
+  return (slot<fTracks.size() && fTracks[slot]==track ? Int_t(slot) : -1);
+}
+
+
+//___________________________________________________________________________
+void AliReducedVarCache::FillEventInfo(Float_t* values) const
+{
+  //
+  // copy the event variables, equivalent to resetting the non run wise variables and
+  // calling AliReducedVarManager::FillEventInfo()
+  //
+  memcpy(values, fEventValues, AliReducedVarManager::kNVars*sizeof(Float_t));
+}
+
+
+//___________________________________________________________________________
+Bool_t AliReducedVarCache::FillTrackInfo(AliReducedBaseTrack* track, Float_t* values)
+{
+  //
+  // equivalent of AliReducedVarManager::FillTrackInfo(track, values)
+  // Returns kFALSE if the track does not belong to the current event
+  //
+  Int_t slot = GetTrackSlot(track);
+  if(slot<0) return kFALSE;
+  if(fTrackBlocks[slot]<0) {
+    PrepareScratch();
+    AliReducedVarManager::FillTrackInfo(track, fScratch);
+    fTrackBlocks[slot] = StoreBlock();
+  }
+  ApplyBlock(fTrackBlocks[slot], values);
+  return kTRUE;
+}
+
+
+//___________________________________________________________________________
+Bool_t AliReducedVarCache::FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values)
+{
+  //
+  // equivalent of AliReducedVarManager::FillPairInfo(t1, t2, type, values)
+  // Returns kFALSE if one of the legs does not belong to the current event
+  //
+  Int_t slot1 = GetTrackSlot(t1);
+  Int_t slot2 = GetTrackSlot(t2);
+  if(slot1<0 || slot2<0) return kFALSE;
+
+  UInt_t itype = 0;
+  while(itype<fPairTypes.size() && fPairTypes[itype]!=type) ++itype;
+  if(itype==fPairTypes.size()) {
+    fPairTypes.push_back(type);
+    fPairBlocks.resize(fPairTypes.size());
+  }
+
+  UInt_t leg1 = GetLeg(slot1);
+  UInt_t leg2 = GetLeg(slot2);
+  std::vector<std::vector<Int_t> >& rows = fPairBlocks[itype];
+  if(leg1>=rows.size()) rows.resize(leg1+1);
+  std::vector<Int_t>& row = rows[leg1];
+  if(leg2>=row.size()) row.resize(leg2+1, -1);
+
+  if(row[leg2]<0) {
+    PrepareScratch();
+    AliReducedVarManager::FillPairInfo(t1, t2, type, fScratch);
+    row[leg2] = StoreBlock();
+  }
+  ApplyBlock(row[leg2], values);
+  return kTRUE;
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedVarCache::GetLeg(Int_t slot)
+{
+  //
+  // leg index of the track in the given slot, assigned on the first use in a pair
+  //
+  if(fTrackLegs[slot]<0) fTrackLegs[slot] = fNLegs++;
+  return fTrackLegs[slot];
+}
+
+
+//___________________________________________________________________________
+void AliReducedVarCache::PrepareScratch()
+{
+  //
+  // reference event variables followed by NaN markers for all the other variables,
+  // such that StoreBlock() can find out which variables were filled
+  //
+  memcpy(fScratch, fRefValues, AliReducedVarManager::kNEventVars*sizeof(Float_t));
+  Float_t marker = TMath::QuietNaN();
+  for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kNVars; ++i) fScratch[i] = marker;
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedVarCache::StoreBlock()
+{
+  //
+  // store the variables filled in the scratch array as a new block
+  //
+  for(Int_t i=0; i<AliReducedVarManager::kNEventVars; ++i) {
+    if(fScratch[i]!=fRefValues[i]) {
+      fVarIndices.push_back(i);
+      fVarValues.push_back(fScratch[i]);
+    }
+  }
+  for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kNVars; ++i) {
+    if(!TMath::IsNaN(fScratch[i])) {
+      fVarIndices.push_back(i);
+      fVarValues.push_back(fScratch[i]);
+    }
+  }
+  fBlockOffsets.push_back(fVarIndices.size());
+  return fBlockOffsets.size()-2;
+}
+
+
+//___________________________________________________________________________
+void AliReducedVarCache::ApplyBlock(Int_t block, Float_t* values) const
+{
+  //
+  // copy the variables of a block into the values array
+  //
+  for(Int_t i=fBlockOffsets[block]; i<fBlockOffsets[block+1]; ++i)
+    values[fVarIndices[i]] = fVarValues[i];
+}
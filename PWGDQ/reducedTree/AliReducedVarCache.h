@@ -0,0 +1,79 @@
+//
+// Cache of the AliReducedVarManager variables for the current event,
+// shared by several analyses attached to the same AliAnalysisTaskReducedEventProcessor.
+// The event variables are computed once per event. Track and pair variables are computed
+// on the first request and stored as a sparse list of (variable, value) entries, which are
+// copied into the values array of every subsequent requester.
+// The track and pair variables may depend on event variables (e.g. Q-vectors, map dependencies),
+// so they are computed from the event variables of the first analysis which calls Synchronize()
+// in the current event. Other analyses use the cache only if their event variables are identical.
+// NOTE: the event counters which the analyses accumulate during their track and pair loops
+//       (e.g. kEvAverageTPCchi2, kNpairsSelected) are not inputs of the track and pair variables.
+// Tracks are indexed by their position in the event (stored in the TObject unique ID),
+// pairs by the order in which their legs were first requested, so that all lookups are direct.
+//
+
+#ifndef ALIREDUCEDVARCACHE_H
+#define ALIREDUCEDVARCACHE_H
+
+#include <vector>
+
+#include <TObject.h>
+
+#include "AliReducedVarManager.h"
+
+class AliReducedBaseEvent;
+class AliReducedBaseTrack;
+
+//_____________________________________________________________________
+class AliReducedVarCache : public TObject {
+
+ public:
+  AliReducedVarCache();
+  virtual ~AliReducedVarCache();
+
+  void SetEvent(AliReducedBaseEvent* event);
+  virtual void Clear(Option_t* option="");
+  Bool_t Synchronize(const Float_t* values);
+
+  AliReducedBaseEvent* GetEvent() const {return fEvent;}
+  const Float_t* GetEventValues() const {return fEventValues;}
+  Int_t GetNTracks() const {return fTracks.size();}
+  AliReducedBaseTrack* GetTrack(Int_t i) const {return fTracks[i];}
+  Int_t GetTrackSlot(const AliReducedBaseTrack* track) const;
+
+  void FillEventInfo(Float_t* values) const;
+  Bool_t FillTrackInfo(AliReducedBaseTrack* track, Float_t* values);
+  Bool_t FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
+
+  Int_t GetNBlocks() const {return fBlockOffsets.size()-1;}
+
+ private:
+  AliReducedVarCache(const AliReducedVarCache &c);
+  AliReducedVarCache& operator= (const AliReducedVarCache &c);
+
+  Int_t GetLeg(Int_t slot);
+  void PrepareScratch();
+  Int_t StoreBlock();
+  void ApplyBlock(Int_t block, Float_t* values) const;
+
+  AliReducedBaseEvent* fEvent;                               //! event the cache is filled for
+  Float_t fEventValues[AliReducedVarManager::kNVars];        //! event variables
+  Float_t fRefValues[AliReducedVarManager::kNEventVars];     //! event variables the track and pair variables are computed from
+  Bool_t fHasRefValues;                                      //! fRefValues set for the current event
+  Float_t fScratch[AliReducedVarManager::kNVars];            //! work array for the track and pair variables
+
+  std::vector<AliReducedBaseTrack*> fTracks;                 //! tracks of the event, both track arrays
+  std::vector<Int_t> fTrackBlocks;                           //! block of each track, -1 if not yet computed
+  std::vector<Int_t> fTrackLegs;                             //! leg index of each track, -1 if not yet used in a pair
+  Int_t fNLegs;                                              //! number of tracks used in pairs
+  std::vector<Int_t> fPairTypes;                             //! pair types requested so far
+  std::vector<std::vector<std::vector<Int_t> > > fPairBlocks; //! block of each pair, indexed by [type][leg1][leg2]
+  std::vector<Int_t> fBlockOffsets;                          //! start of each block in fVarIndices and fVarValues
+  std::vector<Int_t> fVarIndices;                            //! variables filled in the blocks
+  std::vector<Float_t> fVarValues;                           //! values of the variables filled in the blocks
+
+  ClassDef(AliReducedVarCache, 1);
+};
+
+#endif
@@ -30,6 +30,7 @@
 #pragma link C++ class AliReducedPairInfo+;
 #pragma link C++ class AliReducedTrackCut+;
 #pragma link C++ class AliReducedTrackInfo+;
+#pragma link C++ class AliReducedVarCache+;
 #pragma link C++ class AliReducedVarCut+;
 #pragma link C++ class AliReducedVarManager+;
 #pragma link C++ class AliResonanceFits+;
@@ -302,6 +302,7 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(): AliAnalysisTaskSE(),
 //  fHistoTrueEtaNonLinearity(NULL),
   fEventPlaneAngle(-100),
   fRandom(0),
+  fPhotonPairs(),
   fnCuts(0),
   fiCut(0),
   fIsHeavyIon(0),
@@ -573,6 +574,7 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(const char *name):
 //  fHistoTrueEtaNonLinearity(NULL),
   fEventPlaneAngle(-100),
   fRandom(0),
+  fPhotonPairs(),
   fnCuts(0),
   fiCut(0),
   fIsHeavyIon(0),
@@ -4512,43 +4514,19 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
     mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fClusterCandidates->GetEntries());
   }
 
-  if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-    for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-      for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
-        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-
-          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()),currentEventGoodV0.GetLeadingCellID(),previousGoodV0.GetLeadingCellID())){
-            fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-            if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-              fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
-            }
-            if(!fDoLightOutput && TMath::Abs(backgroundCandidate->GetAlpha())<0.1)
-              fHistoMotherBackInvMassPtAlpha[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-
-            if(fDoMesonQA == 4 && fIsMC == 0 && (backgroundCandidate->Pt() > 13.) ){
-              fInvMassTreeInvMass = backgroundCandidate->M();
-              fInvMassTreePt = backgroundCandidate->Pt();
-              fInvMassTreeAlpha = TMath::Abs(backgroundCandidate->GetAlpha());
-              fInvMassTreeTheta = backgroundCandidate->GetOpeningAngle();
-              fInvMassTreeMixPool = zbin*100 + mbin;
-              fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
-              fInvMassTreeEta = backgroundCandidate->Eta();
-              tBckInvMassPtAlphaTheta[fiCut]->Fill();
-            }
-          }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
-        }
-      }
-    }
-  } else if ( ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UsePtmaxMethod() ) {
+  // current clusters in the first block, clusters of the mixed events in the second one:
+  // all the background pairs are computed and selected together, without mother objects
+  fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kFirst);
+  fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kSecond);
+  fPhotonPairs.ClearPairs();
+  for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
+    fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kFirst,(AliAODConversionPhoton*)fClusterCandidates->At(iCurrent));
+  }
+
+  Bool_t usePtMaxMethod = !((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity() &&
+                          ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UsePtmaxMethod();
+
+  if (usePtMaxMethod) {
 
     Double_t currentPtMax   = 0;  Double_t previousPtMax  = 0;
     Double_t currentAvePt   = 0;  Double_t previousAvePt  = 0;
@@ -4587,20 +4565,9 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
          if(TMath::Abs(previousAveEta-currentAveEta)<0.4 && TMath::Abs(previousAvePhi-currentAvePhi)<0.6 && (previousAvePt/currentAvePt)<4. && (previousAvePt/currentAvePt)>0.25) acceptedPtMax = kTRUE;
         }
         if(acceptedPtMax){
-          for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
-            AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-            for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-              AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-              AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-              backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-
-              if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-                ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()),currentEventGoodV0.GetLeadingCellID(),previousGoodV0.GetLeadingCellID())){
-                fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-              }
-              delete backgroundCandidate;
-              backgroundCandidate = 0x0;
-            }
+          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+            Int_t iMixed = fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kSecond,previousEventV0s->at(iPrevious));
+            for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++) fPhotonPairs.AddPair(iCurrent,iMixed);
           }
         }
       }
@@ -4608,40 +4575,39 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
   } else {
     for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
       AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-      if(previousEventV0s){
-        for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+      if(!previousEventV0s) continue;
+      for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+        Int_t iMixed = fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kSecond,previousEventV0s->at(iPrevious));
+        for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++) fPhotonPairs.AddPair(iCurrent,iMixed);
+      }
+    }
+  }
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+  fPhotonPairs.Compute(fInputEvent->GetPrimaryVertex());
+  fPhotonPairs.Select((AliConversionMesonCuts*)fMesonCutArray->At(fiCut),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),kTRUE);
 
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),currentEventGoodV0.GetLeadingCellID(),previousGoodV0.GetLeadingCellID()))){
-              fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
-              }
-              if(!fDoLightOutput && TMath::Abs(backgroundCandidate->GetAlpha())<0.1)
-                fHistoMotherBackInvMassPtAlpha[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-
-              if(fDoMesonQA == 4 && fIsMC == 0 && (backgroundCandidate->Pt() > 13.) ){
-                fInvMassTreeInvMass = backgroundCandidate->M();
-                fInvMassTreePt = backgroundCandidate->Pt();
-                fInvMassTreeAlpha = TMath::Abs(backgroundCandidate->GetAlpha());
-                fInvMassTreeTheta = backgroundCandidate->GetOpeningAngle();
-                fInvMassTreeMixPool = zbin*100 + mbin;
-                fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
-                fInvMassTreeEta = backgroundCandidate->Eta();
-                tBckInvMassPtAlphaTheta[fiCut]->Fill();
-              }
-            }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
-          }
-        }
-      }
+  for(Int_t iPair=0;iPair<fPhotonPairs.GetNPairs();iPair++){
+    if(!fPhotonPairs.IsSelected(iPair)) continue;
+    Double_t mesonM = fPhotonPairs.GetM(iPair);
+    Double_t mesonPt = fPhotonPairs.GetPt(iPair);
+    fHistoMotherBackInvMassPt[fiCut]->Fill(mesonM,mesonPt, fWeightJetJetMC);
+    if(usePtMaxMethod) continue;
+    if(fDoTHnSparse){
+      Double_t sparesFill[4] = {mesonM,mesonPt,(Double_t)zbin,(Double_t)mbin};
+      fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
+    }
+    if(!fDoLightOutput && TMath::Abs(fPhotonPairs.GetAlpha(iPair))<0.1)
+      fHistoMotherBackInvMassPtAlpha[fiCut]->Fill(mesonM,mesonPt, fWeightJetJetMC);
+
+    if(fDoMesonQA == 4 && fIsMC == 0 && (mesonPt > 13.) ){
+      fInvMassTreeInvMass = mesonM;
+      fInvMassTreePt = mesonPt;
+      fInvMassTreeAlpha = TMath::Abs(fPhotonPairs.GetAlpha(iPair));
+      fInvMassTreeTheta = fPhotonPairs.GetOpeningAngle(iPair);
+      fInvMassTreeMixPool = zbin*100 + mbin;
+      fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
+      fInvMassTreeEta = fPhotonPairs.GetEta(iPair);
+      tBckInvMassPtAlphaTheta[fiCut]->Fill();
     }
   }
 }
@@ -11,6 +11,7 @@
 #include "AliConvEventCuts.h"
 #include "AliConversionPhotonCuts.h"
 #include "AliConversionMesonCuts.h"
+#include "AliConversionPhotonPairs.h"
 #include "AliAnalysisManager.h"
 #include "TProfile2D.h"
 #include "TH3.h"
@@ -375,6 +376,7 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     // additional variables
     Double_t              fEventPlaneAngle;                                     // EventPlaneAngle
     TRandom3              fRandom;                                              // random
+    AliConversionPhotonPairs fPhotonPairs;                                      //! packed photons and pairs for the mixed event background
     Int_t                 fnCuts;                                               // number of cuts to be analysed in parallel
     Int_t                 fiCut;                                                // current cut
     Int_t                 fIsHeavyIon;                                          // switch for pp = 0, PbPb = 1, pPb = 2
@@ -406,7 +408,7 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     AliAnalysisTaskGammaCalo(const AliAnalysisTaskGammaCalo&);                  // Prevent copy-construction
     AliAnalysisTaskGammaCalo &operator=(const AliAnalysisTaskGammaCalo&);       // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaCalo, 44);
+    ClassDef(AliAnalysisTaskGammaCalo, 45);
 };
 
 #endif
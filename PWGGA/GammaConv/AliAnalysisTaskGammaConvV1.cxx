@@ -238,6 +238,7 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   iMesonMCInfo(0),
   fEventPlaneAngle(-100),
   fRandom(0),
+  fPhotonPairs(),
   fnGammaCandidates(0),
   fUnsmearedPx(NULL),
   fUnsmearedPy(NULL),
@@ -448,6 +449,7 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   iMesonMCInfo(0),
   fEventPlaneAngle(-100),
   fRandom(0),
+  fPhotonPairs(),
   fnGammaCandidates(0),
   fUnsmearedPx(NULL),
   fUnsmearedPy(NULL),
@@ -3091,120 +3093,135 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
 
   // Conversion Gammas
   if(fGammaCandidates->GetEntries()>1){
+    // pairs without common electron, computed and selected in one pass over packed photons
+    fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kFirst);
+    fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kSecond);
+    fPhotonPairs.ClearPairs();
+    for(Int_t gammaIndex=0;gammaIndex<fGammaCandidates->GetEntries();gammaIndex++){
+      AliAODConversionPhoton *gamma=(AliAODConversionPhoton*)fGammaCandidates->At(gammaIndex);
+      fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kFirst,gamma);
+      fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kSecond,gamma);
+    }
     for(Int_t firstGammaIndex=0;firstGammaIndex<fGammaCandidates->GetEntries()-1;firstGammaIndex++){
-      AliAODConversionPhoton *gamma0=dynamic_cast<AliAODConversionPhoton*>(fGammaCandidates->At(firstGammaIndex));
-      if (gamma0==NULL) continue;
+      AliAODConversionPhoton *gamma0=(AliAODConversionPhoton*)fGammaCandidates->At(firstGammaIndex);
       for(Int_t secondGammaIndex=firstGammaIndex+1;secondGammaIndex<fGammaCandidates->GetEntries();secondGammaIndex++){
-        AliAODConversionPhoton *gamma1=dynamic_cast<AliAODConversionPhoton*>(fGammaCandidates->At(secondGammaIndex));
+        AliAODConversionPhoton *gamma1=(AliAODConversionPhoton*)fGammaCandidates->At(secondGammaIndex);
         //Check for same Electron ID
-        if (gamma1==NULL) continue;
         if(gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelNegative() ||
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelNegative() ) continue;
+        fPhotonPairs.AddPair(firstGammaIndex,secondGammaIndex);
+      }
+    }
+    fPhotonPairs.Compute(fInputEvent->GetPrimaryVertex());
+    fPhotonPairs.Select((AliConversionMesonCuts*)fMesonCutArray->At(fiCut),kTRUE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
+
+    for(Int_t iPair=0;iPair<fPhotonPairs.GetNPairs();iPair++){
+      if(!fPhotonPairs.IsSelected(iPair)) continue;
+      Int_t firstGammaIndex = fPhotonPairs.GetFirst(iPair);
+      Int_t secondGammaIndex = fPhotonPairs.GetSecond(iPair);
+      AliAODConversionPhoton *gamma0=(AliAODConversionPhoton*)fGammaCandidates->At(firstGammaIndex);
+      AliAODConversionPhoton *gamma1=(AliAODConversionPhoton*)fGammaCandidates->At(secondGammaIndex);
+      Double_t mesonM = fPhotonPairs.GetM(iPair);
+      Double_t mesonPt = fPhotonPairs.GetPt(iPair);
+      if(fDoCentralityFlat > 0){
+        fHistoMotherInvMassPt[fiCut]->Fill(mesonM,mesonPt, fWeightCentrality[fiCut]*fWeightJetJetMC);
+        if(TMath::Abs(fPhotonPairs.GetAlpha(iPair))<0.1) fHistoMotherInvMassEalpha[fiCut]->Fill(mesonM,fPhotonPairs.GetE(iPair), fWeightCentrality[fiCut]*fWeightJetJetMC);
+      } else {
+        fHistoMotherInvMassPt[fiCut]->Fill(mesonM,mesonPt,fWeightJetJetMC);
+        if(TMath::Abs(fPhotonPairs.GetAlpha(iPair))<0.1) fHistoMotherInvMassEalpha[fiCut]->Fill(mesonM,fPhotonPairs.GetE(iPair),fWeightJetJetMC);
+      }
 
-        AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
-        pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
-        pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-
-        if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(pi0cand,kTRUE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-          if(fDoCentralityFlat > 0){
-            fHistoMotherInvMassPt[fiCut]->Fill(pi0cand->M(),pi0cand->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            if(TMath::Abs(pi0cand->GetAlpha())<0.1) fHistoMotherInvMassEalpha[fiCut]->Fill(pi0cand->M(),pi0cand->E(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-          } else {
-            fHistoMotherInvMassPt[fiCut]->Fill(pi0cand->M(),pi0cand->Pt(),fWeightJetJetMC);
-            if(TMath::Abs(pi0cand->GetAlpha())<0.1) fHistoMotherInvMassEalpha[fiCut]->Fill(pi0cand->M(),pi0cand->E(),fWeightJetJetMC);
-          }
-
-          if (fDoMesonQA > 0){
+      if (fDoMesonQA > 0){
 
-            if(fDoMesonQA == 3 && TMath::Abs(gamma0->GetConversionRadius()-gamma1->GetConversionRadius())<10 && pi0cand->GetOpeningAngle()<0.1){
-                    Double_t sparesFill[4] = {gamma0->GetPhotonPt(),gamma0->GetConversionRadius(),TMath::Abs(gamma0->GetConversionRadius()-gamma1->GetConversionRadius()),pi0cand->GetOpeningAngle()};
-                    sPtRDeltaROpenAngle[fiCut]->Fill(sparesFill, 1);
-            }
+        if(fDoMesonQA == 3 && TMath::Abs(gamma0->GetConversionRadius()-gamma1->GetConversionRadius())<10 && fPhotonPairs.GetOpeningAngle(iPair)<0.1){
+                Double_t sparesFill[4] = {gamma0->GetPhotonPt(),gamma0->GetConversionRadius(),TMath::Abs(gamma0->GetConversionRadius()-gamma1->GetConversionRadius()),fPhotonPairs.GetOpeningAngle(iPair)};
+                sPtRDeltaROpenAngle[fiCut]->Fill(sparesFill, 1);
+        }
 
-            if ( pi0cand->M() > 0.05 && pi0cand->M() < 0.17){
-              if (fIsMC < 2){
-                fHistoMotherPi0PtY[fiCut]->Fill(pi0cand->Pt(),pi0cand->Rapidity()-((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
-                fHistoMotherPi0PtOpenAngle[fiCut]->Fill(pi0cand->Pt(),pi0cand->GetOpeningAngle());
-              }
-              fHistoMotherPi0PtAlpha[fiCut]->Fill(pi0cand->Pt(),TMath::Abs(pi0cand->GetAlpha()),fWeightJetJetMC);
+        if ( mesonM > 0.05 && mesonM < 0.17){
+          if (fIsMC < 2){
+            fHistoMotherPi0PtY[fiCut]->Fill(mesonPt,fPhotonPairs.GetRapidity(iPair)-((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
+            fHistoMotherPi0PtOpenAngle[fiCut]->Fill(mesonPt,fPhotonPairs.GetOpeningAngle(iPair));
+          }
+          fHistoMotherPi0PtAlpha[fiCut]->Fill(mesonPt,TMath::Abs(fPhotonPairs.GetAlpha(iPair)),fWeightJetJetMC);
 
-            }
-            if ( pi0cand->M() > 0.45 && pi0cand->M() < 0.65){
-              if (fIsMC < 2){
-                fHistoMotherEtaPtY[fiCut]->Fill(pi0cand->Pt(),pi0cand->Rapidity()-((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
-                fHistoMotherEtaPtOpenAngle[fiCut]->Fill(pi0cand->Pt(),pi0cand->GetOpeningAngle());
-              }
-              fHistoMotherEtaPtAlpha[fiCut]->Fill(pi0cand->Pt(),TMath::Abs(pi0cand->GetAlpha()),fWeightJetJetMC);
-            }
+        }
+        if ( mesonM > 0.45 && mesonM < 0.65){
+          if (fIsMC < 2){
+            fHistoMotherEtaPtY[fiCut]->Fill(mesonPt,fPhotonPairs.GetRapidity(iPair)-((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
+            fHistoMotherEtaPtOpenAngle[fiCut]->Fill(mesonPt,fPhotonPairs.GetOpeningAngle(iPair));
           }
-          if(fDoTHnSparse && ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGCalculation()){
-            Int_t psibin = 0;
-            Int_t zbin = 0;
-            Int_t mbin = 0;
-
-            Double_t sparesFill[4];
-            if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->BackgroundHandlerType() == 0){
-              zbin = fBGHandler[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
-              if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-                mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fV0Reader->GetNumberOfPrimaryTracks());
-              } else {
-                mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fGammaCandidates->GetEntries());
-              }
-              sparesFill[0] = pi0cand->M();
-              sparesFill[1] = pi0cand->Pt();
-              sparesFill[2] = (Double_t)zbin;
-              sparesFill[3] = (Double_t)mbin;
-            } else {
-              psibin = fBGHandlerRP[fiCut]->GetRPBinIndex(TMath::Abs(fEventPlaneAngle));
-              zbin = fBGHandlerRP[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
+          fHistoMotherEtaPtAlpha[fiCut]->Fill(mesonPt,TMath::Abs(fPhotonPairs.GetAlpha(iPair)),fWeightJetJetMC);
+        }
+      }
+      if(fDoTHnSparse && ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGCalculation()){
+        Int_t psibin = 0;
+        Int_t zbin = 0;
+        Int_t mbin = 0;
+
+        Double_t sparesFill[4];
+        if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->BackgroundHandlerType() == 0){
+          zbin = fBGHandler[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
+          if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
+            mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fV0Reader->GetNumberOfPrimaryTracks());
+          } else {
+            mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fGammaCandidates->GetEntries());
+          }
+          sparesFill[0] = mesonM;
+          sparesFill[1] = mesonPt;
+          sparesFill[2] = (Double_t)zbin;
+          sparesFill[3] = (Double_t)mbin;
+        } else {
+          psibin = fBGHandlerRP[fiCut]->GetRPBinIndex(TMath::Abs(fEventPlaneAngle));
+          zbin = fBGHandlerRP[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
 //               if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
 //                 mbin = fBGHandlerRP[fiCut]->GetMultiplicityBinIndex(fV0Reader->GetNumberOfPrimaryTracks());
 //               } else {
 //                 mbin = fBGHandlerRP[fiCut]->GetMultiplicityBinIndex(fGammaCandidates->GetEntries());
 //               }
-              sparesFill[0] = pi0cand->M();
-              sparesFill[1] = pi0cand->Pt();
-              sparesFill[2] = (Double_t)zbin;
-              sparesFill[3] = (Double_t)psibin;
-            }
-//             Double_t sparesFill[4] = {pi0cand->M(),pi0cand->Pt(),(Double_t)zbin,(Double_t)mbin};
-            if(fDoCentralityFlat > 0) sESDMotherInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-            else  sESDMotherInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-          }
+          sparesFill[0] = mesonM;
+          sparesFill[1] = mesonPt;
+          sparesFill[2] = (Double_t)zbin;
+          sparesFill[3] = (Double_t)psibin;
+        }
+//             Double_t sparesFill[4] = {mesonM,mesonPt,(Double_t)zbin,(Double_t)mbin};
+        if(fDoCentralityFlat > 0) sESDMotherInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
+        else  sESDMotherInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
+      }
 
 
-          if( fIsMC > 0 ){
-            if(fInputEvent->IsA()==AliESDEvent::Class())
-              ProcessTrueMesonCandidates(pi0cand,gamma0,gamma1);
-            if(fInputEvent->IsA()==AliAODEvent::Class())
-              ProcessTrueMesonCandidatesAOD(pi0cand,gamma0,gamma1);
-          }
-          if (fDoMesonQA == 2){
-            fInvMass = pi0cand->M();
-            fPt  = pi0cand->Pt();
-            if (TMath::Abs(gamma0->GetDCAzToPrimVtx()) < TMath::Abs(gamma1->GetDCAzToPrimVtx())){
-              fDCAzGammaMin = gamma0->GetDCAzToPrimVtx();
-              fDCAzGammaMax = gamma1->GetDCAzToPrimVtx();
-            } else {
-              fDCAzGammaMin = gamma1->GetDCAzToPrimVtx();
-              fDCAzGammaMax = gamma0->GetDCAzToPrimVtx();
-            }
-            iFlag = pi0cand->GetMesonQuality();
-    //                   cout << "gamma 0: " << gamma0->GetV0Index()<< "\t" << gamma0->GetPx() << "\t" << gamma0->GetPy() << "\t" <<  gamma0->GetPz() << "\t" << endl;
-    //                   cout << "gamma 1: " << gamma1->GetV0Index()<< "\t"<< gamma1->GetPx() << "\t" << gamma1->GetPy() << "\t" <<  gamma1->GetPz() << "\t" << endl;
-    //                    cout << "pi0: "<<fInvMass << "\t" << fPt <<"\t" << fDCAzGammaMin << "\t" << fDCAzGammaMax << "\t" << (Int_t)iFlag << "\t" << (Int_t)iMesonMCInfo <<endl;
-            if (fIsHeavyIon == 1 && fPt > 0.399 && fPt < 20. ) {
-              if (fInvMass > 0.08 && fInvMass < 0.2) tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
-              if ((fInvMass > 0.45 && fInvMass < 0.6) &&  (fPt > 0.999 && fPt < 20.) )tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
-            } else if (fPt > 0.299 && fPt < 20. )  {
-              if ( (fInvMass > 0.08 && fInvMass < 0.6) ) tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
-            }
-          }
+      if( fIsMC > 0 ){
+        // full mother only for the MC truth matching
+        AliAODConversionMother pi0cand(gamma0,gamma1);
+        pi0cand.SetLabels(firstGammaIndex,secondGammaIndex);
+        pi0cand.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        if(fInputEvent->IsA()==AliESDEvent::Class())
+          ProcessTrueMesonCandidates(&pi0cand,gamma0,gamma1);
+        if(fInputEvent->IsA()==AliAODEvent::Class())
+          ProcessTrueMesonCandidatesAOD(&pi0cand,gamma0,gamma1);
+      }
+      if (fDoMesonQA == 2){
+        fInvMass = mesonM;
+        fPt  = mesonPt;
+        if (TMath::Abs(gamma0->GetDCAzToPrimVtx()) < TMath::Abs(gamma1->GetDCAzToPrimVtx())){
+          fDCAzGammaMin = gamma0->GetDCAzToPrimVtx();
+          fDCAzGammaMax = gamma1->GetDCAzToPrimVtx();
+        } else {
+          fDCAzGammaMin = gamma1->GetDCAzToPrimVtx();
+          fDCAzGammaMax = gamma0->GetDCAzToPrimVtx();
+        }
+        iFlag = AliAODConversionMother(gamma0,gamma1).GetMesonQuality();
+//                   cout << "gamma 0: " << gamma0->GetV0Index()<< "\t" << gamma0->GetPx() << "\t" << gamma0->GetPy() << "\t" <<  gamma0->GetPz() << "\t" << endl;
+//                   cout << "gamma 1: " << gamma1->GetV0Index()<< "\t"<< gamma1->GetPx() << "\t" << gamma1->GetPy() << "\t" <<  gamma1->GetPz() << "\t" << endl;
+//                    cout << "pi0: "<<fInvMass << "\t" << fPt <<"\t" << fDCAzGammaMin << "\t" << fDCAzGammaMax << "\t" << (Int_t)iFlag << "\t" << (Int_t)iMesonMCInfo <<endl;
+        if (fIsHeavyIon == 1 && fPt > 0.399 && fPt < 20. ) {
+          if (fInvMass > 0.08 && fInvMass < 0.2) tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
+          if ((fInvMass > 0.45 && fInvMass < 0.6) &&  (fPt > 0.999 && fPt < 20.) )tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
+        } else if (fPt > 0.299 && fPt < 20. )  {
+          if ( (fInvMass > 0.08 && fInvMass < 0.6) ) tESDMesonsInvMassPtDcazMinDcazMaxFlag[fiCut]->Fill();
         }
-        delete pi0cand;
-        pi0cand=0x0;
       }
     }
   }
@@ -3637,124 +3654,84 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fGammaCandidates->GetEntries());
     }
 
+  // current photons in the first block, rotated or mixed partners in the second one:
+  // all the background pairs are computed and selected together, without mother objects
+  fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kFirst);
+  fPhotonPairs.ClearPhotons(AliConversionPhotonPairs::kSecond);
+  fPhotonPairs.ClearPairs();
+  for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
+    fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kFirst,(AliAODConversionPhoton*)fGammaCandidates->At(iCurrent));
+  }
+
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseRotationMethod()){
 
+    Int_t nDegreesPMBackground = ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->NDegreesRotation();
+    Double_t nRadiansPM = nDegreesPMBackground*TMath::Pi()/180;
     for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-      AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+      AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
       for(Int_t iCurrent2=iCurrent+1;iCurrent2<fGammaCandidates->GetEntries();iCurrent2++){
+        AliAODConversionPhoton *currentEventGoodV02 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
         for(Int_t nRandom=0;nRandom<((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->GetNumberOfBGEvents();nRandom++){
-        AliAODConversionPhoton currentEventGoodV02 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
 
         if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGProbability()){
-          AliAODConversionMother *backgroundCandidateProb = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-          Double_t massBGprob = backgroundCandidateProb->M();
+          Double_t massBGprob = (*currentEventGoodV0 + *currentEventGoodV02).M();
           if(massBGprob>0.1 && massBGprob<0.14){
             if(fRandom.Rndm()>fBGHandler[fiCut]->GetBGProb(zbin,mbin)){
-              delete backgroundCandidateProb;
               continue;
             }
           }
-          delete backgroundCandidateProb;
-          backgroundCandidateProb = 0x0;
         }
 
-        RotateParticle(&currentEventGoodV02);
-        AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-        backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-        if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-          ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-          if(fDoTHnSparse){
-            Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-            if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-            else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-          }
-        }
-        delete backgroundCandidate;
-        backgroundCandidate = 0x0;
+        // same random rotation as RotateParticle
+        Int_t iRotated = fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kSecond,currentEventGoodV02);
+        fPhotonPairs.RotatePhoton(AliConversionPhotonPairs::kSecond,iRotated,fRandom.Rndm()*2*nRadiansPM + TMath::Pi()-nRadiansPM);
+        fPhotonPairs.AddPair(iCurrent,iRotated);
         }
       }
     }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
 
-    if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-      for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-        }
-
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-          if(fMoveParticleAccordingToVertex == kTRUE){
-            MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-          }
-          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-            RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-          }
-
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-            if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-              if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-              else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-            }
-          }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
-        }
-        }
+    for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      if(!previousEventV0s) continue;
+      if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+        bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
       }
-    } else {
-      for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
+      for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+        Int_t iMixed = fPhotonPairs.AddPhoton(AliConversionPhotonPairs::kSecond,previousEventV0s->at(iPrevious));
+        // as MoveParticleAccordingToVertex and RotateParticleAccordingToEP
+        if(fMoveParticleAccordingToVertex == kTRUE){
+          fPhotonPairs.MovePhoton(AliConversionPhotonPairs::kSecond,iMixed,
+                                  bgEventVertex->fX - fInputEvent->GetPrimaryVertex()->GetX(),
+                                  bgEventVertex->fY - fInputEvent->GetPrimaryVertex()->GetY(),
+                                  bgEventVertex->fZ - fInputEvent->GetPrimaryVertex()->GetZ());
         }
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-
-            if(fMoveParticleAccordingToVertex == kTRUE){
-              MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-            }
-            if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-              RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-            }
-
-
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-              ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-              else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-                else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-              }
-            }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
-          }
+        if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+          fPhotonPairs.RotatePhoton(AliConversionPhotonPairs::kSecond,iMixed,(fEventPlaneAngle+TMath::Pi())-(bgEventVertex->fEP+TMath::Pi()));
         }
+        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
+          fPhotonPairs.AddPair(iCurrent,iMixed);
         }
       }
     }
   }
+
+  fPhotonPairs.Compute(fInputEvent->GetPrimaryVertex());
+  fPhotonPairs.Select((AliConversionMesonCuts*)fMesonCutArray->At(fiCut),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift());
+
+  for(Int_t iPair=0;iPair<fPhotonPairs.GetNPairs();iPair++){
+    if(!fPhotonPairs.IsSelected(iPair)) continue;
+    Double_t mesonM = fPhotonPairs.GetM(iPair);
+    Double_t mesonPt = fPhotonPairs.GetPt(iPair);
+    if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(mesonM,mesonPt, fWeightCentrality[fiCut]*fWeightJetJetMC);
+    else fHistoMotherBackInvMassPt[fiCut]->Fill(mesonM,mesonPt,fWeightJetJetMC);
+    if(fDoTHnSparse){
+      Double_t sparesFill[4] = {mesonM,mesonPt,(Double_t)zbin,(Double_t)mbin};
+      if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
+      else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
+    }
+  }
 }
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::CalculateBackgroundRP(){
@@ -10,6 +10,7 @@
 #include "AliGammaConversionAODBGHandler.h"
 #include "AliConversionAODBGHandlerRP.h"
 #include "AliConversionMesonCuts.h"
+#include "AliConversionPhotonPairs.h"
 #include "AliAnalysisManager.h"
 #include "TProfile2D.h"
 #include "TH3.h"
@@ -275,6 +276,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
                                       // 6: primary meson gamma-gamma-channel
     Double_t                          fEventPlaneAngle;                           // EventPlaneAngle
     TRandom3                          fRandom;                                    //
+    AliConversionPhotonPairs          fPhotonPairs;                               //! packed photons and pairs for the meson candidates
     Int_t                             fnGammaCandidates;                          //
     Double_t*                         fUnsmearedPx;                               //[fnGammaCandidates]
     Double_t*                         fUnsmearedPy;                               //[fnGammaCandidates]
@@ -307,7 +309,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 42);
+    ClassDef(AliAnalysisTaskGammaConvV1, 43);
 };
 
 #endif
@@ -15,6 +15,7 @@
 #include "AliCaloPhotonCuts.h"
 
 class AliESDEvent;
+class AliConversionPhotonPairs;
 class AliAODEvent;
 class AliConversionPhotonBase;
 class AliKFVertex;
@@ -108,6 +109,7 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
 
     // Cut Selection
     Bool_t MesonIsSelected(AliAODConversionMother *pi0,Bool_t IsSignal=kTRUE, Double_t fRapidityShift=0., Int_t leadingCellID1 = 0, Int_t leadingCellID2 = 0);
+    Bool_t MesonIsSelected(const AliConversionPhotonPairs *pairs, Int_t pair, Bool_t IsSignal=kTRUE, Double_t fRapidityShift=0., Int_t leadingCellID1 = 0, Int_t leadingCellID2 = 0);
     Bool_t MesonIsSelectedMC(TParticle *fMCMother,AliMCEvent *mcEvent, Double_t fRapidityShift=0.);
     Bool_t MesonIsSelectedAODMC(AliAODMCParticle *MCMother,TClonesArray *AODMCArray, Double_t fRapidityShift=0.);
     Bool_t MesonIsSelectedMCDalitz(TParticle *fMCMother,AliMCEvent *mcEvent, Int_t &labelelectron, Int_t &labelpositron, Int_t &labelgamma,Double_t fRapidityShift=0.);
@@ -270,6 +272,11 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
 
   private:
 
+    // Meson selection from the kinematics of the candidate, shared by the MesonIsSelected overloads
+    Bool_t MesonIsSelectedKinematics(Double_t pt, Double_t e, Double_t pz, Double_t m, Double_t openingAngle, Double_t alpha,
+                                     Float_t dcaBetweenPhotons, Float_t dcaRPrimVtx, Float_t dcaZPrimVtx,
+                                     Bool_t IsSignal, Double_t fRapidityShift, Int_t leadingCellID1, Int_t leadingCellID2);
+
     /// \cond CLASSIMP
     ClassDef(AliConversionMesonCuts,22)
     /// \endcond
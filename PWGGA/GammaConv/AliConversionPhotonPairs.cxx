@@ -0,0 +1,271 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                         *
+* Permission to use, copy, modify and distribute this software and its    *
+* documentation strictly for non-commercial purposes is hereby granted    *
+* without fee, provided that the above copyright notice appears in all    *
+* copies and that both the copyright notice and this permission notice    *
+* appear in the supporting documentation. The authors make no claims      *
+* about the suitability of this software for any purpose. It is           *
+* provided "as is" without express or implied warranty.                   *
+**************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Packed photon momenta and the kinematics of their pairs
+//
+// The meson loops create an AliAODConversionMother for every same-event,
+// rotated or mixed pair only to decide whether it passes
+// AliConversionMesonCuts::MesonIsSelected. Here the photons are packed
+// into two blocks (momentum, conversion point and leading cell), the pairs
+// to combine are listed, and Compute() fills the quantities of
+// AliAODConversionMother (mass, pT, rapidity, opening angle, alpha, DCAs)
+// for the whole list, with the same formulas. Select() then applies the
+// meson selection to all the pairs. The buffers keep their memory from one
+// call to the next, so the loops allocate nothing; a mother object is only
+// needed for the selected pairs that go through MC truth matching.
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "AliConversionPhotonPairs.h"
+
+#include "TMath.h"
+#include "AliVVertex.h"
+#include "AliAODConversionPhoton.h"
+#include "AliConversionMesonCuts.h"
+
+ClassImp(AliConversionPhotonPairs)
+
+//________________________________________________________________________
+AliConversionPhotonPairs::AliConversionPhotonPairs():
+	TObject(),
+	fPairs()
+{
+	// Constructor
+}
+
+//________________________________________________________________________
+AliConversionPhotonPairs::~AliConversionPhotonPairs()
+{
+	// Destructor
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::ClearPhotons(Int_t block)
+{
+	// Remove the photons of a block, keeping the memory
+	fPhotons[block].clear();
+}
+
+//________________________________________________________________________
+Int_t AliConversionPhotonPairs::AddPhoton(Int_t block, const AliAODConversionPhoton *gamma)
+{
+	// Pack a photon, returns its index in the block
+	Photon photon;
+	photon.fPx = gamma->Px();
+	photon.fPy = gamma->Py();
+	photon.fPz = gamma->Pz();
+	photon.fE  = gamma->E();
+	photon.fConversionPoint[0] = gamma->GetConversionX();
+	photon.fConversionPoint[1] = gamma->GetConversionY();
+	photon.fConversionPoint[2] = gamma->GetConversionZ();
+	photon.fLeadingCellID = gamma->GetLeadingCellID();
+	fPhotons[block].push_back(photon);
+	return fPhotons[block].size()-1;
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::RotatePhoton(Int_t block, Int_t i, Double_t angle)
+{
+	// Rotate the momentum around z, as TLorentzVector::RotateZ
+	Photon &photon = fPhotons[block][i];
+	Double_t s = TMath::Sin(angle);
+	Double_t c = TMath::Cos(angle);
+	Double_t px = photon.fPx;
+	photon.fPx = c*px - s*photon.fPy;
+	photon.fPy = s*px + c*photon.fPy;
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::MovePhoton(Int_t block, Int_t i, Double_t dx, Double_t dy, Double_t dz)
+{
+	// Shift the conversion point by -(dx,dy,dz), as the tasks' MoveParticleAccordingToVertex
+	Photon &photon = fPhotons[block][i];
+	photon.fConversionPoint[0] -= dx;
+	photon.fConversionPoint[1] -= dy;
+	photon.fConversionPoint[2] -= dz;
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::AddPair(Int_t i, Int_t j)
+{
+	Pair pair;
+	pair.fFirst  = i;
+	pair.fSecond = j;
+	pair.fSelected = kFALSE;
+	fPairs.push_back(pair);
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::AddAllPairs()
+{
+	// Every photon of the first block with every photon of the second
+	Int_t n0 = fPhotons[kFirst].size();
+	Int_t n1 = fPhotons[kSecond].size();
+	fPairs.reserve(fPairs.size() + n0*n1);
+	for (Int_t i = 0; i < n0; i++){
+		for (Int_t j = 0; j < n1; j++) AddPair(i,j);
+	}
+}
+
+//________________________________________________________________________
+void AliConversionPhotonPairs::Compute(const AliVVertex *primVertex)
+{
+	// Kinematics of all the pairs, as the AliAODConversionMother(y1,y2) constructor
+	// followed by CalculateDistanceOfClossetApproachToPrimVtx(primVertex).
+	// Without vertex the DCAs to the primary vertex keep the default of the mother (100).
+
+	Double_t primCo[3] = {0.,0.,0.};
+	if (primVertex){
+		primCo[0] = primVertex->GetX();
+		primCo[1] = primVertex->GetY();
+		primCo[2] = primVertex->GetZ();
+	}
+
+	Int_t nPairs = fPairs.size();
+	for (Int_t p = 0; p < nPairs; p++){
+		Pair &pair = fPairs[p];
+		const Photon &y1 = fPhotons[kFirst][pair.fFirst];
+		const Photon &y2 = fPhotons[kSecond][pair.fSecond];
+
+		pair.fPx = y1.fPx + y2.fPx;
+		pair.fPy = y1.fPy + y2.fPy;
+		pair.fPz = y1.fPz + y2.fPz;
+		pair.fE  = y1.fE  + y2.fE;
+		pair.fSelected = kFALSE;
+
+		// opening angle, as TVector3::Angle
+		Double_t bb = y1.fPx*y1.fPx + y1.fPy*y1.fPy + y1.fPz*y1.fPz;
+		Double_t dd = y2.fPx*y2.fPx + y2.fPy*y2.fPy + y2.fPz*y2.fPz;
+		Double_t bd = y1.fPx*y2.fPx + y1.fPy*y2.fPy + y1.fPz*y2.fPz;
+		Double_t ptot2 = bb*dd;
+		if (ptot2 <= 0){
+			pair.fOpeningAngle = 0.;
+		} else {
+			Double_t arg = bd/TMath::Sqrt(ptot2);
+			if (arg >  1.0) arg =  1.0;
+			if (arg < -1.0) arg = -1.0;
+			pair.fOpeningAngle = TMath::ACos(arg);
+		}
+
+		pair.fAlpha = -1;
+		if (pair.fE != 0) pair.fAlpha = (y1.fE - y2.fE)/pair.fE;
+
+		// distance between the photon lines, as AliAODConversionMother::CalculateDistanceBetweenPhotons
+		const Double_t *a = y1.fConversionPoint;
+		const Double_t *c = y2.fConversionPoint;
+		Double_t b[3] = {y1.fPx, y1.fPy, y1.fPz};
+		Double_t d[3] = {y2.fPx, y2.fPy, y2.fPz};
+		Double_t n[3] = {b[1]*d[2]-b[2]*d[1], b[2]*d[0]-b[0]*d[2], b[0]*d[1]-b[1]*d[0]};
+		Double_t nMag = TMath::Sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+		Double_t ac[3] = {a[0]-c[0], a[1]-c[1], a[2]-c[2]};
+		Double_t prod[3] = {0.,0.,0.};
+		Double_t dist = 0;
+		if (nMag == 0){
+			Double_t dMag = TMath::Sqrt(dd);
+			if (dMag != 0){
+				Double_t ed[3] = {ac[1]*d[2]-ac[2]*d[1], ac[2]*d[0]-ac[0]*d[2], ac[0]*d[1]-ac[1]*d[0]};
+				dist = TMath::Sqrt(ed[0]*ed[0] + ed[1]*ed[1] + ed[2]*ed[2])/dMag;
+			}
+		} else {
+			dist = TMath::Abs(-(n[0]*ac[0] + n[1]*ac[1] + n[2]*ac[2]))/nMag;
+			Double_t acd = ac[0]*d[0] + ac[1]*d[1] + ac[2]*d[2];
+			Double_t acb = ac[0]*b[0] + ac[1]*b[1] + ac[2]*b[2];
+			Double_t den = bb*dd - bd*bd;
+			Double_t lambda = (bd*acd - dd*acb)/den;
+			Double_t mu = (acd*bb - acb*bd)/den;
+			Double_t s[3], s12[3];
+			Double_t s12Mag2 = 0;
+			for (Int_t k = 0; k < 3; k++){
+				s[k] = a[k] + lambda*b[k];
+				s12[k] = c[k] + mu*d[k] - s[k];
+				s12Mag2 += s12[k]*s12[k];
+			}
+			Double_t s12Mag = s12Mag2 > 0 ? TMath::Sqrt(s12Mag2) : 1.;
+			for (Int_t k = 0; k < 3; k++) prod[k] = s[k] + 0.5*dist*s12[k]/s12Mag;
+		}
+		if (dist > 1000) dist = 999.;
+		pair.fdcaBetweenPhotons = dist;
+
+		// distance of the meson line to the primary vertex
+		pair.fdcaRPrimVtx = 100;
+		pair.fdcaZPrimVtx = 100;
+		if (primVertex){
+			Double_t absoluteP = TMath::Sqrt(pair.fPx*pair.fPx + pair.fPy*pair.fPy + pair.fPz*pair.fPz);
+			Double_t u[3] = {pair.fPx/absoluteP, pair.fPy/absoluteP, pair.fPz/absoluteP};
+			Double_t cp[3] = {prod[0]-primCo[0], prod[1]-primCo[1], prod[2]-primCo[2]};
+			Double_t lambda = -(cp[0]*u[0] + cp[1]*u[1] + cp[2]*u[2])/(u[0]*u[0] + u[1]*u[1] + u[2]*u[2]);
+			Double_t s[3] = {prod[0]+u[0]*lambda, prod[1]+u[1]*lambda, prod[2]+u[2]*lambda};
+			pair.fdcaRPrimVtx = TMath::Sqrt((primCo[0]-s[0])*(primCo[0]-s[0]) + (primCo[1]-s[1])*(primCo[1]-s[1]));
+			pair.fdcaZPrimVtx = primCo[2]-s[2];
+		}
+	}
+}
+
+//________________________________________________________________________
+Int_t AliConversionPhotonPairs::Select(AliConversionMesonCuts *cuts, Bool_t isSignal, Double_t rapidityShift, Bool_t useLeadingCells)
+{
+	// Meson selection of all the computed pairs, returns the number of selected pairs.
+	// The leading cells of the clusters are passed for the merged cluster cuts if requested.
+
+	Int_t nSelected = 0;
+	Int_t nPairs = fPairs.size();
+	for (Int_t p = 0; p < nPairs; p++){
+		Pair &pair = fPairs[p];
+		Int_t leadingCellID1 = 0;
+		Int_t leadingCellID2 = 0;
+		if (useLeadingCells){
+			leadingCellID1 = fPhotons[kFirst][pair.fFirst].fLeadingCellID;
+			leadingCellID2 = fPhotons[kSecond][pair.fSecond].fLeadingCellID;
+		}
+		pair.fSelected = cuts->MesonIsSelected(this,p,isSignal,rapidityShift,leadingCellID1,leadingCellID2);
+		if (pair.fSelected) nSelected++;
+	}
+	return nSelected;
+}
+
+//________________________________________________________________________
+Double_t AliConversionPhotonPairs::GetPt(Int_t p) const
+{
+	const Pair &pair = fPairs[p];
+	return TMath::Sqrt(pair.fPx*pair.fPx + pair.fPy*pair.fPy);
+}
+
+//________________________________________________________________________
+Double_t AliConversionPhotonPairs::GetM(Int_t p) const
+{
+	// as TLorentzVector::M
+	const Pair &pair = fPairs[p];
+	Double_t mm = pair.fE*pair.fE - pair.fPx*pair.fPx - pair.fPy*pair.fPy - pair.fPz*pair.fPz;
+	return mm < 0.0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm);
+}
+
+//________________________________________________________________________
+Double_t AliConversionPhotonPairs::GetRapidity(Int_t p) const
+{
+	const Pair &pair = fPairs[p];
+	return 0.5*TMath::Log((pair.fE+pair.fPz)/(pair.fE-pair.fPz));
+}
+
+//________________________________________________________________________
+Double_t AliConversionPhotonPairs::GetEta(Int_t p) const
+{
+	// as TLorentzVector::Eta
+	const Pair &pair = fPairs[p];
+	Double_t ptot = TMath::Sqrt(pair.fPx*pair.fPx + pair.fPy*pair.fPy + pair.fPz*pair.fPz);
+	Double_t cosTheta = ptot == 0.0 ? 1.0 : pair.fPz/ptot;
+	if (cosTheta*cosTheta < 1) return -0.5*TMath::Log((1.0-cosTheta)/(1.0+cosTheta));
+	if (pair.fPz == 0) return 0;
+	if (pair.fPz > 0) return 10e10;
+	else return -10e10;
+}
@@ -0,0 +1,100 @@
+#ifndef ALICONVERSIONPHOTONPAIRS_H
+#define ALICONVERSIONPHOTONPAIRS_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Packed photon momenta and the kinematics of their pairs,
+// to build and select meson candidates without
+// AliAODConversionMother objects
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include <vector>
+#include "TObject.h"
+
+class AliVVertex;
+class AliAODConversionPhoton;
+class AliConversionMesonCuts;
+
+class AliConversionPhotonPairs : public TObject {
+
+	public:
+
+		enum EBlock_t {
+			kFirst  = 0,							// photons of the current event
+			kSecond = 1								// photons of the same, rotated or mixed event
+		};
+
+		AliConversionPhotonPairs();
+		virtual ~AliConversionPhotonPairs();
+
+		// Photons
+		void ClearPhotons(Int_t block);
+		Int_t AddPhoton(Int_t block, const AliAODConversionPhoton *gamma);
+		void RotatePhoton(Int_t block, Int_t i, Double_t angle);
+		void MovePhoton(Int_t block, Int_t i, Double_t dx, Double_t dy, Double_t dz);
+		Int_t GetNPhotons(Int_t block) const {return fPhotons[block].size();}
+
+		// Pairs: photon i of the first block with photon j of the second
+		void ClearPairs() {fPairs.clear();}
+		void AddPair(Int_t i, Int_t j);
+		void AddAllPairs();
+		void Compute(const AliVVertex *primVertex);
+		Int_t Select(AliConversionMesonCuts *cuts, Bool_t isSignal, Double_t rapidityShift, Bool_t useLeadingCells = kFALSE);
+
+		Int_t GetNPairs() const {return fPairs.size();}
+		Int_t GetFirst(Int_t p) const {return fPairs[p].fFirst;}
+		Int_t GetSecond(Int_t p) const {return fPairs[p].fSecond;}
+		Bool_t IsSelected(Int_t p) const {return fPairs[p].fSelected;}
+		Double_t GetPx(Int_t p) const {return fPairs[p].fPx;}
+		Double_t GetPy(Int_t p) const {return fPairs[p].fPy;}
+		Double_t GetPz(Int_t p) const {return fPairs[p].fPz;}
+		Double_t GetE(Int_t p) const {return fPairs[p].fE;}
+		Double_t GetPt(Int_t p) const;
+		Double_t GetM(Int_t p) const;
+		Double_t GetRapidity(Int_t p) const;
+		Double_t GetEta(Int_t p) const;
+		Double_t GetOpeningAngle(Int_t p) const {return fPairs[p].fOpeningAngle;}
+		Double_t GetAlpha(Int_t p) const {return fPairs[p].fAlpha;}
+		Float_t GetDCABetweenPhotons(Int_t p) const {return fPairs[p].fdcaBetweenPhotons;}
+		Float_t GetDCARMotherPrimVtx(Int_t p) const {return fPairs[p].fdcaRPrimVtx;}
+		Float_t GetDCAZMotherPrimVtx(Int_t p) const {return fPairs[p].fdcaZPrimVtx;}
+
+	private:
+
+		AliConversionPhotonPairs(const AliConversionPhotonPairs&);				// not implemented
+		AliConversionPhotonPairs& operator=(const AliConversionPhotonPairs&);	// not implemented
+
+		struct Photon {
+			Double_t fPx;						// four-momentum
+			Double_t fPy;
+			Double_t fPz;
+			Double_t fE;
+			Double_t fConversionPoint[3];		// conversion point
+			Int_t fLeadingCellID;				// leading cell of the cluster
+		};
+
+		struct Pair {
+			Int_t fFirst;						// photon in the first block
+			Int_t fSecond;						// photon in the second block
+			Double_t fPx;						// four-momentum of the pair
+			Double_t fPy;
+			Double_t fPz;
+			Double_t fE;
+			Double_t fOpeningAngle;
+			Double_t fAlpha;
+			Float_t fdcaBetweenPhotons;			// as in AliAODConversionMother
+			Float_t fdcaZPrimVtx;
+			Float_t fdcaRPrimVtx;
+			Bool_t fSelected;					// passed the meson selection
+		};
+
+		std::vector<Photon> fPhotons[2];		//! photons of the two blocks
+		std::vector<Pair> fPairs;				//! pairs to compute and select
+
+	ClassDef(AliConversionPhotonPairs,1)
+};
+
+#endif
@@ -125,7 +125,10 @@ AliAnalysisTaskPi0Flow::AliAnalysisTaskPi0Flow(const char *name, Period period)
   fRPV0C(0),
   fEMRPBin(0),
   fCaloPhotonsPHOS(0x0),
-  fCaloPhotonsPHOSLists(0x0)
+  fCaloPhotonsPHOSLists(0x0),
+  fNPairHistCentBins(0),
+  fPairHists(),
+  fPHOSphiHist(0x0)
 {
   const int nbins = 9;
   Double_t edges[nbins+1] = {0., 5., 10., 20., 30., 40., 50., 60., 70., 80.};
@@ -137,6 +140,10 @@ AliAnalysisTaskPi0Flow::AliAnalysisTaskPi0Flow(const char *name, Period period)
   for(int mod=1; mod <= kNMod; ++mod)
     fModuleEnabled[mod-1] = kTRUE;
 
+  for(Int_t mod1=0; mod1<kNMod; mod1++)
+    for(Int_t mod2=0; mod2<kNMod; mod2++)
+      fPi0ModHists[mod1][mod2] = 0x0;
+
   for(Int_t i=0;i<kNCenBins;i++){
     for(Int_t j=0;j<2; j++)
       for(Int_t k=0; k<2; k++) {
@@ -377,6 +384,8 @@ void AliAnalysisTaskPi0Flow::UserCreateOutputObjects()
   Int_t kapacity = kNVtxZBins * GetNumberOfCentralityBins() * fNEMRPBins;
   fCaloPhotonsPHOSLists = new TObjArray(kapacity);
   fCaloPhotonsPHOSLists->SetOwner();
+
+  SetupPairHistograms();
   
   PostData(1, fOutputContainer);
 }
@@ -904,14 +913,16 @@ void AliAnalysisTaskPi0Flow::FillSelectedClusterHistograms()
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0s()
 {
-  char key[55];
   for (Int_t i1=0; i1 < fCaloPhotonsPHOS->GetEntriesFast()-1; i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     for (Int_t i2=i1+1; i2<fCaloPhotonsPHOS->GetEntriesFast(); i2++) {
       AliCaloPhoton * ph2=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i2) ;
       TLorentzVector p12  = *ph1  + *ph2;
       TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-      FillHistogram("hPHOSphi",fCentrality,p12.Pt(),p12.Phi());
+      if(fPHOSphiHist)
+        fPHOSphiHist->Fill(fCentrality,p12.Pt(),p12.Phi());
+      else
+        FillHistogram("hPHOSphi",fCentrality,p12.Pt(),p12.Phi());
       Double_t dphiA=p12.Phi()-fRPV0A ;
       while(dphiA<0)dphiA+=TMath::Pi() ;
       while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
@@ -935,237 +946,217 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0s()
       Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
       if( fFillWideTOF ) {
-	FillHistogram(Form("hPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	FillPairHistogram(kFALSE,kPairCutWideTOF,kPairPi0,m,pt) ;
+	FillPairHistogram(kFALSE,kPairCutWideTOF,kPairSingle,m,pt1) ;
+	FillPairHistogram(kFALSE,kPairCutWideTOF,kPairSingle,m,pt2) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	  FillPairHistogram(kFALSE,kPairCutWideTOF,kPairMassPtTPC,m,pt,dphiT) ;
       }
 
       if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
 	continue;
 
-      FillHistogram(Form("hMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtV0A,m,pt,dphiA) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtV0C,m,pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
+        FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtTPC,m,pt,dphiT) ;
 
-      FillHistogram(Form("hMassPtV0AAllcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAllcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAllcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+        FillPairHistogram(kFALSE,kPairCutAll,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 
 
-      FillHistogram(Form("hPi0All_cen%d",fCentBin),m,pt) ;
-      FillHistogram(Form("hPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairPi0,m,pt) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairPi0core,mcore,ptcore) ;
       if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-        FillHistogram(Form("hPi0Allwou_cen%d",fCentBin),m,pt) ;
-        FillHistogram(Form("hMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-        FillHistogram(Form("hMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
+        FillPairHistogram(kFALSE,kPairCutAllwou,kPairPi0,m,pt) ;
+        FillPairHistogram(kFALSE,kPairCutAllwou,kPairMassPtV0A,m,pt,dphiA) ;
+        FillPairHistogram(kFALSE,kPairCutAllwou,kPairMassPtV0C,m,pt,dphiC) ;
         if(fHaveTPCRP)
-          FillHistogram(Form("hMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
+          FillPairHistogram(kFALSE,kPairCutAllwou,kPairMassPtTPC,m,pt,dphiT) ;
       }
 
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt1) ;
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt2) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairSingle,m,pt1) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairSingle,m,pt2) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairSinglecore,mcore,ptcore1) ;
+      FillPairHistogram(kFALSE,kPairCutAll,kPairSinglecore,mcore,ptcore2) ;
       if(ph1->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutAllwou,kPairSingle,m,pt1) ;
       if(ph2->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutAllwou,kPairSingle,m,pt2) ;
       if(ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutCPV,kPairSingle,m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutCPV,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutCPV,kPairSingle,m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutCPV,kPairSinglecore,mcore,ptcore2) ;
       }
       if(ph1->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutCPV2,kPairSingle,m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutCPV2,kPairSinglecore,mcore,ptcore2) ;
       }
       if(ph2->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutCPV2,kPairSingle,m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutCPV2,kPairSinglecore,mcore,ptcore2) ;
       }
       if(ph1->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutDisp,kPairSingle,m,pt1) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt1) ;
+          FillPairHistogram(kFALSE,kPairCutDispwou,kPairSingle,m,pt1) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutDisp,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph2->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutDisp,kPairSingle,m,pt2) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt2) ;
+          FillPairHistogram(kFALSE,kPairCutDispwou,kPairSingle,m,pt2) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutDisp,kPairSinglecore,mcore,ptcore2) ;
       }
       if(ph1->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutDisp2,kPairSingle,m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutDisp2,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph2->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutDisp2,kPairSingle,m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutDisp2,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph1->IsDispOK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutBoth,kPairSingle,m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutBoth,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph2->IsDispOK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutBoth,kPairSingle,m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutBoth,kPairSinglecore,mcore,ptcore2) ;
       }
       if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillPairHistogram(kFALSE,kPairCutBoth2,kPairSingle,m,pt1) ;
+        FillPairHistogram(kFALSE,kPairCutBoth2,kPairSinglecore,mcore,ptcore1) ;
       }
       if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillPairHistogram(kFALSE,kPairCutBoth2,kPairSingle,m,pt2) ;
+        FillPairHistogram(kFALSE,kPairCutBoth2,kPairSinglecore,mcore,ptcore2) ;
       }
 
 
       if(a<kAlphaCut){
-        FillHistogram(Form("hPi0All_a07_cen%d",fCentBin),m,pt) ;
+        FillPairHistogram(kFALSE,kPairCutAll,kPairPi0a07,m,pt) ;
       }
 
       if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	snprintf(key,55,"hMassPtCPV_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtV0A,m,pt,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtV0C,m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtTPC,m,pt,dphiT) ;
 
-	FillHistogram(Form("hMassPtV0ACPVcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPVcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPVcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+  	  FillPairHistogram(kFALSE,kPairCutCPV,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 
-	FillHistogram(Form("hPi0CPV_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairPi0,m,pt) ;
+	FillPairHistogram(kFALSE,kPairCutCPV,kPairPi0core,mcore, ptcore) ;
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV_a07_cen%d",fCentBin),m,pt) ;
+          FillPairHistogram(kFALSE,kPairCutCPV,kPairPi0a07,m,pt) ;
         }
       }
       if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	FillHistogram(Form("hMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtV0A,m,pt,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtV0C,m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	FillHistogram(Form("hMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+  	  FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtTPC,m,pt,dphiT) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+  	  FillPairHistogram(kFALSE,kPairCutCPV2,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 	
-	FillHistogram(Form("hPi0CPV2_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairPi0,m,pt) ;
+	FillPairHistogram(kFALSE,kPairCutCPV2,kPairPi0core,mcore, ptcore) ;
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
+          FillPairHistogram(kFALSE,kPairCutCPV2,kPairPi0a07,m,pt) ;
         }
       }
       if(ph1->IsDispOK() && ph2->IsDispOK()){
-	snprintf(key,55,"hMassPtDisp_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtV0A,m,pt,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtV0C,m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtTPC,m,pt,dphiT) ;
 	
-	FillHistogram(Form("hMassPtV0ADispcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDispcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtV0Acore,mcore, ptcore,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtV0Ccore,mcore, ptcore,dphiC) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDispcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+	  FillPairHistogram(kFALSE,kPairCutDisp,kPairMassPtTPCcore,mcore, ptcore,dphiT) ;
 
-	FillHistogram(Form("hPi0Disp_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0Dispcore_cen%d",fCentBin),mcore, ptcore) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairPi0,m,pt) ;
+	FillPairHistogram(kFALSE,kPairCutDisp,kPairPi0core,mcore, ptcore) ;
 	
 	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hPi0Dispwou_cen%d",fCentBin),m,pt) ;
+	  FillPairHistogram(kFALSE,kPairCutDispwou,kPairPi0,m,pt) ;
 
-	  FillHistogram(Form("hMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
- 	  FillHistogram(Form("hMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kFALSE,kPairCutDispwou,kPairMassPtV0A,m,pt,dphiA) ;
+ 	  FillPairHistogram(kFALSE,kPairCutDispwou,kPairMassPtV0C,m,pt,dphiC) ;
 	  if(fHaveTPCRP)
-  	    FillHistogram(Form("hMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
+  	    FillPairHistogram(kFALSE,kPairCutDispwou,kPairMassPtTPC,m,pt,dphiT) ;
 	}
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0Disp_a07_cen%d",fCentBin),m,pt) ;
+          FillPairHistogram(kFALSE,kPairCutDisp,kPairPi0a07,m,pt) ;
         }
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtV0C,m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtTPC,m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMassPtV0ABothcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBothcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBothcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+	    FillPairHistogram(kFALSE,kPairCutBoth,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 
-	  FillHistogram(Form("hPi0Both_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Bothcore_cen%d",fCentBin),mcore,ptcore) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairPi0,m,pt) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth,kPairPi0core,mcore,ptcore) ;
 
           if(a<kAlphaCut){
-            snprintf(key,55,"hPi0Both_a07_cen%d",fCentBin) ;
-            FillHistogram(Form("hPi0Both_a07_cen%d",fCentBin),m,pt) ;
+            FillPairHistogram(kFALSE,kPairCutBoth,kPairPi0a07,m,pt) ;
           }
-          if(ph1->Module()==1 && ph2->Module()==1)
-	    FillHistogram("hPi0M11",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==2)
-	    FillHistogram("hPi0M22",m,pt );
-          else if(ph1->Module()==3 && ph2->Module()==3)
-	    FillHistogram("hPi0M33",m,pt );
-          else if(ph1->Module()==4 && ph2->Module()==4)
-	    FillHistogram("hPi0M44",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==2)
-	    FillHistogram("hPi0M12",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==3)
-	    FillHistogram("hPi0M13",m,pt );
-          else if(ph1->Module()==1 && ph2->Module()==4)
-	    FillHistogram("hPi0M14",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==3)
-	    FillHistogram("hPi0M23",m,pt );
-          else if(ph1->Module()==2 && ph2->Module()==4)
-	    FillHistogram("hPi0M24",m,pt );
-          else if(ph1->Module()==3 && ph2->Module()==4)
-	    FillHistogram("hPi0M34",m,pt );
+          Int_t mod1=ph1->Module()-1, mod2=ph2->Module()-1 ;
+          if(mod1>=0 && mod1<kNMod && mod2>=0 && mod2<kNMod && fPi0ModHists[mod1][mod2])
+            fPi0ModHists[mod1][mod2]->Fill(m,pt) ;
         }
 	
       }
       
       
       if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	FillHistogram(Form("hPi0Disp2_cen%d",fCentBin),m,pt) ;
-  	FillHistogram(Form("hPi0Disp2core_cen%d",fCentBin),mcore, ptcore) ;	
+	FillPairHistogram(kFALSE,kPairCutDisp2,kPairPi0,m,pt) ;
+  	FillPairHistogram(kFALSE,kPairCutDisp2,kPairPi0core,mcore, ptcore) ;	
 
-	FillHistogram(Form("hMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtV0A,m,pt,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtV0C,m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtTPC,m,pt,dphiT) ;
 
-	FillHistogram(Form("hMassPtV0ADisp2core_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2core_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtV0Acore,mcore, ptcore,dphiA) ;
+	FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtV0Ccore,mcore, ptcore,dphiC) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDisp2core_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+	  FillPairHistogram(kFALSE,kPairCutDisp2,kPairMassPtTPCcore,mcore, ptcore,dphiT) ;
 	  
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtV0C,m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtTPC,m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMassPtV0ABoth2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+	    FillPairHistogram(kFALSE,kPairCutBoth2,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 
-	  FillHistogram(Form("hPi0Both2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Both2core_cen%d",fCentBin),mcore,ptcore) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairPi0,m,pt) ;
+	  FillPairHistogram(kFALSE,kPairCutBoth2,kPairPi0core,mcore,ptcore) ;
 	}
 
       }
@@ -1175,7 +1166,6 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0s()
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0sMix()
 {
-  char key[55];
 
   TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
 
@@ -1211,218 +1201,213 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0sMix()
         Double_t ptcore1=ph1->GetMomV2()->Pt() ;
         Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
-	snprintf(key,55,"hMiMassPtAll_cen%d",fCentBin) ; // probably not needed, consider removing this line!
 	if( fFillWideTOF ) {
-	  FillHistogram(Form("hMiPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	  FillPairHistogram(kTRUE,kPairCutWideTOF,kPairPi0,m,pt) ;
+	  FillPairHistogram(kTRUE,kPairCutWideTOF,kPairSingle,m,pt1) ;
+	  FillPairHistogram(kTRUE,kPairCutWideTOF,kPairSingle,m,pt2) ;
 	  if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(kTRUE,kPairCutWideTOF,kPairMassPtTPC,m,pt,dphiT) ;
 	}
 
 	if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
 	  continue;
 
-	FillHistogram(Form("hMiMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtV0A,m,pt,dphiA) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtV0C,m,pt,dphiC) ;
 	if(fHaveTPCRP)
- 	  FillHistogram(Form("hMiMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
+ 	  FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtTPC,m,pt,dphiT) ;
 
-	FillHistogram(Form("hMiMassPtV0AAllcore_cen%d",fCentBin),mcore, ptcore, dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAllcore_cen%d",fCentBin),mcore, ptcore, dphiC) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtV0Acore,mcore, ptcore, dphiA) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtV0Ccore,mcore, ptcore, dphiC) ;
         if(fHaveTPCRP)
-	  FillHistogram(Form("hMiMassPtTPCAllcore_cen%d",fCentBin),mcore, ptcore, dphiT) ;
+	  FillPairHistogram(kTRUE,kPairCutAll,kPairMassPtTPCcore,mcore, ptcore, dphiT) ;
 
-	FillHistogram(Form("hMiPi0All_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hMiPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairPi0,m,pt) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairPi0core,mcore,ptcore) ;
 	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hMiPi0Allwou_cen%d",fCentBin),m,pt) ;
-          FillHistogram(Form("hMiMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-          FillHistogram(Form("hMiMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutAllwou,kPairPi0,m,pt) ;
+          FillPairHistogram(kTRUE,kPairCutAllwou,kPairMassPtV0A,m,pt,dphiA) ;
+          FillPairHistogram(kTRUE,kPairCutAllwou,kPairMassPtV0C,m,pt,dphiC) ;
           if(fHaveTPCRP)
-            FillHistogram(Form("hMiMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
+            FillPairHistogram(kTRUE,kPairCutAllwou,kPairMassPtTPC,m,pt,dphiT) ;
 	}
 
-	FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+	FillPairHistogram(kTRUE,kPairCutAll,kPairSingle,m,pt1) ;
+        FillPairHistogram(kTRUE,kPairCutAll,kPairSingle,m,pt2) ;
+        FillPairHistogram(kTRUE,kPairCutAll,kPairSinglecore,mcore,ptcore1) ;
+        FillPairHistogram(kTRUE,kPairCutAll,kPairSinglecore,mcore,ptcore2) ;
         if(ph1->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutAllwou,kPairSingle,m,pt1) ;
         if(ph2->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutAllwou,kPairSingle,m,pt2) ;
         if(ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutCPV,kPairSingle,m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutCPV,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutCPV,kPairSingle,m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutCPV,kPairSinglecore,mcore,ptcore2) ;
         }
         if(ph1->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutCPV2,kPairSingle,m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutCPV2,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutCPV2,kPairSingle,m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutCPV2,kPairSinglecore,mcore,ptcore2) ;
         }
         if(ph1->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutDisp,kPairSingle,m,pt1) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt1) ;
+            FillPairHistogram(kTRUE,kPairCutDispwou,kPairSingle,m,pt1) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutDisp,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutDisp,kPairSingle,m,pt2) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt2) ;
+            FillPairHistogram(kTRUE,kPairCutDispwou,kPairSingle,m,pt2) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutDisp,kPairSinglecore,mcore,ptcore2) ;
         }
         if(ph1->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutDisp2,kPairSingle,m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutDisp2,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutDisp2,kPairSingle,m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutDisp2,kPairSinglecore,mcore,ptcore2) ;
         }
         if(ph1->IsDispOK() && ph1->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt1) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutBoth,kPairSingle,m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutBoth,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsDispOK() && ph2->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt2) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutBoth,kPairSingle,m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutBoth,kPairSinglecore,mcore,ptcore2) ;
         }
         if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillPairHistogram(kTRUE,kPairCutBoth2,kPairSingle,m,pt1) ;
+          FillPairHistogram(kTRUE,kPairCutBoth2,kPairSinglecore,mcore,ptcore1) ;
         }
         if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillPairHistogram(kTRUE,kPairCutBoth2,kPairSingle,m,pt2) ;
+          FillPairHistogram(kTRUE,kPairCutBoth2,kPairSinglecore,mcore,ptcore2) ;
         }
 
 
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hMiPi0All_a07_cen%d",fCentBin),m,pt) ;
+          FillPairHistogram(kTRUE,kPairCutAll,kPairPi0a07,m,pt) ;
         }
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMiMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtV0C,m,pt,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
+ 	    FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtTPC,m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ACPVcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPVcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtV0Acore,mcore, ptcore,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtV0Ccore,mcore, ptcore,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPVcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+ 	    FillPairHistogram(kTRUE,kPairCutCPV,kPairMassPtTPCcore,mcore, ptcore,dphiT) ;
 
-	  FillHistogram(Form("hMiPi0CPV_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairPi0,m,pt) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV,kPairPi0core,mcore, ptcore) ;
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV_a07_cen%d",fCentBin),m,pt) ;
+            FillPairHistogram(kTRUE,kPairCutCPV,kPairPi0a07,m,pt) ;
           }
 	}
 	if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	  FillHistogram(Form("hMiPi0CPV2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairPi0,m,pt) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairPi0core,mcore, ptcore) ;
 
-	  FillHistogram(Form("hMiMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtV0C,m,pt,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	  FillHistogram(Form("hMiMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+ 	    FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtTPC,m,pt,dphiT) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtV0Acore,mcore,ptcore,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtV0Ccore,mcore,ptcore,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+ 	    FillPairHistogram(kTRUE,kPairCutCPV2,kPairMassPtTPCcore,mcore,ptcore,dphiT) ;
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
+            FillPairHistogram(kTRUE,kPairCutCPV2,kPairPi0a07,m,pt) ;
           }
 	}
 	if(ph1->IsDispOK() && ph2->IsDispOK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtV0C,m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtTPC,m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtV0Acore,pv12.M(),pv12.Pt(),dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtV0Ccore,pv12.M(),pv12.Pt(),dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+	    FillPairHistogram(kTRUE,kPairCutDisp,kPairMassPtTPCcore,pv12.M(),pv12.Pt(),dphiT) ;
 
 
-	  FillHistogram(Form("hMiPi0Disp_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairPi0,m,pt) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp,kPairPi0core,pv12.M(),pv12.Pt()) ;
           if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	    FillHistogram(Form("hMiPi0Dispwou_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillPairHistogram(kTRUE,kPairCutDispwou,kPairPi0,m,pt) ;
+	    FillPairHistogram(kTRUE,kPairCutDispwou,kPairMassPtV0A,m,pt,dphiA) ;
+	    FillPairHistogram(kTRUE,kPairCutDispwou,kPairMassPtV0C,m,pt,dphiC) ;
             if(fHaveTPCRP)
-	      FillHistogram(Form("hMiMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
+	      FillPairHistogram(kTRUE,kPairCutDispwou,kPairMassPtTPC,m,pt,dphiT) ;
 	  }
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0Disp_a07_cen%d",fCentBin),m,pt) ;
+            FillPairHistogram(kTRUE,kPairCutDisp,kPairPi0a07,m,pt) ;
           }
 	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtV0A,m,pt,dphiA) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtV0C,m,pt,dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
+  	      FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtTPC,m,pt,dphiT) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtV0Acore,pv12.M(),pv12.Pt(),dphiA) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtV0Ccore,pv12.M(),pv12.Pt(),dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+  	      FillPairHistogram(kTRUE,kPairCutBoth,kPairMassPtTPCcore,pv12.M(),pv12.Pt(),dphiT) ;
 
-	    FillHistogram(Form("hMiPi0Both_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairPi0,m,pt) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth,kPairPi0core,pv12.M(),pv12.Pt()) ;
 
 	    if(a<kAlphaCut){
-              FillHistogram(Form("hMiPi0Both_a07_cen%d",fCentBin),m,pt) ;
+              FillPairHistogram(kTRUE,kPairCutBoth,kPairPi0a07,m,pt) ;
             }
 	  }
 	}
 	
   	if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtV0A,m,pt,dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtV0C,m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtTPC,m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtV0Acore,pv12.M(),pv12.Pt(),dphiA) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtV0Ccore,pv12.M(),pv12.Pt(),dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+	    FillPairHistogram(kTRUE,kPairCutDisp2,kPairMassPtTPCcore,pv12.M(),pv12.Pt(),dphiT) ;
 
 
-	  FillHistogram(Form("hMiPi0Disp2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairPi0,m,pt) ;
+	  FillPairHistogram(kTRUE,kPairCutDisp2,kPairPi0core,pv12.M(),pv12.Pt()) ;
 
 	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtV0A,m,pt,dphiA) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtV0C,m,pt,dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
+  	      FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtTPC,m,pt,dphiT) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtV0Acore,pv12.M(),pv12.Pt(),dphiA) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtV0Ccore,pv12.M(),pv12.Pt(),dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+  	      FillPairHistogram(kTRUE,kPairCutBoth2,kPairMassPtTPCcore,pv12.M(),pv12.Pt(),dphiT) ;
 
-	    FillHistogram(Form("hMiPi0Both2_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairPi0,m,pt) ;
+	    FillPairHistogram(kTRUE,kPairCutBoth2,kPairPi0core,pv12.M(),pv12.Pt()) ;
 
 	  }
 	}
@@ -1452,6 +1437,66 @@ void AliAnalysisTaskPi0Flow::UpdateLists()
     fCaloPhotonsPHOS->Clear(); // TODO: redundant???
 }
 //_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::SetupPairHistograms()
+{
+  //Resolve the histograms filled in the photon pair loops once, so that
+  //ConsiderPi0s() and ConsiderPi0sMix() fill them without formatting and looking up their names
+
+  fNPairHistCentBins = GetNumberOfCentralityBins();
+  fPairHists.assign(2*kNPairCuts*kNPairHists*fNPairHistCentBins, (TH1*)0x0);
+  for(Int_t mixed=0; mixed<2; mixed++)
+    for(Int_t cut=0; cut<kNPairCuts; cut++)
+      for(Int_t hist=0; hist<kNPairHists; hist++)
+        for(Int_t cent=0; cent<fNPairHistCentBins; cent++)
+          fPairHists[PairHistIndex(mixed,cut,hist,cent)] =
+            dynamic_cast<TH1*>(fOutputContainer->FindObject(GetPairHistName(mixed,cut,hist,cent)));
+
+  fPHOSphiHist = dynamic_cast<TH3*>(fOutputContainer->FindObject("hPHOSphi"));
+
+  //Module combinations are filled with the lower module first
+  for(Int_t mod1=0; mod1<kNMod; mod1++)
+    for(Int_t mod2=0; mod2<kNMod; mod2++)
+      fPi0ModHists[mod1][mod2] = (mod1<=mod2) ?
+        dynamic_cast<TH2*>(fOutputContainer->FindObject(Form("hPi0M%d%d",mod1+1,mod2+1))) : 0x0;
+}
+//_____________________________________________________________________________
+TString AliAnalysisTaskPi0Flow::GetPairHistName(Bool_t mixed, Int_t cut, Int_t hist, Int_t cent) const
+{
+  //Name of the pair histogram for the given cut, histogram type and centrality bin
+  const char* cutNames[kNPairCuts] = {"All", "Allwou", "CPV", "CPV2", "Disp", "Dispwou", "Disp2", "Both", "Both2", "WideTOF"};
+  const char* histNames[kNPairHists] = {"Pi0%s", "Pi0%score", "Pi0%s_a07", "Single%s", "Single%score",
+                                        "MassPtV0A%s", "MassPtV0C%s", "MassPtTPC%s",
+                                        "MassPtV0A%score", "MassPtV0C%score", "MassPtTPC%score"};
+  TString name(mixed ? "hMi" : "h");
+  name += Form(histNames[hist], cutNames[cut]);
+  name += Form("_cen%d", cent);
+  return name;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPairHistogram(Bool_t mixed, Int_t cut, Int_t hist, Double_t x, Double_t y) const
+{
+  //Fill a pair histogram of the current centrality bin, see SetupPairHistograms()
+  TH1 * h = GetPairHist(mixed, cut, hist);
+  if(h)
+    h->Fill(x, y) ;
+  else
+    FillHistogram(GetPairHistName(mixed, cut, hist, fCentBin).Data(), x, y) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillPairHistogram(Bool_t mixed, Int_t cut, Int_t hist, Double_t x, Double_t y, Double_t z) const
+{
+  //Fill a pair histogram of the current centrality bin, z is the weight of 2D histograms
+  TH1 * h = GetPairHist(mixed, cut, hist);
+  if(!h)
+    FillHistogram(GetPairHistName(mixed, cut, hist, fCentBin).Data(), x, y, z) ;
+  else if(h->GetDimension() == 2)
+    static_cast<TH2*>(h)->Fill(x, y, z) ;
+  else if(h->GetDimension() == 3)
+    static_cast<TH3*>(h)->Fill(x, y, z) ;
+  else
+    AliError(Form("can not find histogram (of instance TH2) <%s> ",h->GetName())) ;
+}
+//_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::FillHistogram(const char * key,Double_t x)const{
   //FillHistogram
   TH1 * hist = dynamic_cast<TH1*>(fOutputContainer->FindObject(key)) ;
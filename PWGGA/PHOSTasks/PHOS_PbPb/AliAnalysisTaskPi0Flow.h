@@ -11,6 +11,9 @@
 /* $Id$ */
 
 class TObjArray;
+class TH1;
+class TH2;
+class TH3;
 class TH1F;
 class TH2I;
 class TH2F;
@@ -26,6 +29,8 @@ class AliESDCaloCluster ;
 class AliEPFlattener;
 class AliAnalysisUtils;
 
+#include <vector>
+
 #include "TArrayD.h"
 
 #include "AliAnalysisTaskSE.h"
@@ -35,6 +40,10 @@ public:
     enum Period { kUndefinedPeriod, kLHC10h, kLHC11h, kLHC13 };
     enum EventSelection { kTotal, kInternalTriggerMaskSelection, kHasVertex, kHasAbsVertex, kHasCentrality, kCentUnderUpperBinUpperEdge, kCentOverLowerBinLowerEdge, kHasPHOSClusters, kTotalSelected };
     enum TriggerSelection { kNoSelection, kCentralInclusive, kCentralExclusive, kSemiCentralInclusive, kSemiCentralExclusive, kMBInclusive, kMBExclusive };
+    // Photon pair histograms filled in ConsiderPi0s() and ConsiderPi0sMix(), see SetupPairHistograms()
+    enum PairCut { kPairCutAll, kPairCutAllwou, kPairCutCPV, kPairCutCPV2, kPairCutDisp, kPairCutDispwou, kPairCutDisp2, kPairCutBoth, kPairCutBoth2, kPairCutWideTOF, kNPairCuts };
+    enum PairHist { kPairPi0, kPairPi0core, kPairPi0a07, kPairSingle, kPairSinglecore,
+                    kPairMassPtV0A, kPairMassPtV0C, kPairMassPtTPC, kPairMassPtV0Acore, kPairMassPtV0Ccore, kPairMassPtTPCcore, kNPairHists };
 
 public:
     AliAnalysisTaskPi0Flow(const char *name = "AliAnalysisTaskPi0Flow", Period period = kUndefinedPeriod);
@@ -129,6 +138,13 @@ protected:
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram witn name key
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram witn name key
 
+    void SetupPairHistograms(); //Resolve the pair histograms of all centrality bins
+    TString GetPairHistName(Bool_t mixed, Int_t cut, Int_t hist, Int_t cent) const;
+    Int_t PairHistIndex(Int_t mixed, Int_t cut, Int_t hist, Int_t cent) const { return ((mixed*kNPairCuts + cut)*kNPairHists + hist)*fNPairHistCentBins + cent; }
+    TH1* GetPairHist(Bool_t mixed, Int_t cut, Int_t hist) const { return (fCentBin>=0 && fCentBin<fNPairHistCentBins) ? fPairHists[PairHistIndex(mixed,cut,hist,fCentBin)] : 0x0; }
+    void FillPairHistogram(Bool_t mixed, Int_t cut, Int_t hist, Double_t x, Double_t y) const ; //Fill 2D pair histogram of the current centrality bin
+    void FillPairHistogram(Bool_t mixed, Int_t cut, Int_t hist, Double_t x, Double_t y, Double_t z) const ; //Fill 3D pair histogram of the current centrality bin
+
     TVector3 GetVertexVector(const AliVVertex* vertex);
     Int_t GetCentralityBin(Float_t centralityV0M);
     Int_t GetRPBin();
@@ -240,8 +256,14 @@ protected:
     // Step 12: Update lists for mixing.
     TObjArray* fCaloPhotonsPHOSLists; //! array of TList, Containers for events with PHOS photons
 
+    // Step 9, 10: Pair histograms, resolved in UserCreateOutputObjects
+    Int_t fNPairHistCentBins;         //! centrality bins of fPairHists
+    std::vector<TH1*> fPairHists;     //! [mixed][cut][hist][cent], null if not booked
+    TH3* fPHOSphiHist;                //! hPHOSphi
+    TH2* fPi0ModHists[kNMod][kNMod];  //! hPi0M<mod1><mod2>, mod1<=mod2
+
 
-    ClassDef(AliAnalysisTaskPi0Flow, 3); // PHOS analysis task
+    ClassDef(AliAnalysisTaskPi0Flow, 4); // PHOS analysis task
 };
 
 #endif
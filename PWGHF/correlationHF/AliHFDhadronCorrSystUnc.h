@@ -441,11 +441,17 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   void SetHistoBackSubtraction(TH1D *hMax,TString strname="",Bool_t clone=kTRUE,TH1D *hMin=0x0);
 
   
+  void SetTableFileName(const char *fileName){fTableFileName=fileName;}
+  const char* GetTableFileName() const {return fTableFileName.Data();}
+
   TGraphAsymmErrors* GetTotUncGraph(){return fgrTotal;}
   TGraphAsymmErrors* GetTotNonFlatUncGraph(){return fgrTotalNonFlatDPhi;}
   TGraphAsymmErrors* GetTotFlatUncGraph(){return fgrTotalFlatDPhi;}
   
  private:
+  void LoadTable(const char *key);
+  TH1D** GetHistoPointer(const char *member);
+
   Int_t fmeson;                       // 0=D0, 1=D*, 2=D+
   TString fstrmeson;                  // meson name
   TString fstrptAss;                  // string with pt range associated tracks
@@ -493,9 +499,10 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   TGraphAsymmErrors  *fgrTotalNonFlatDPhiRel;         //
   TGraphAsymmErrors  *fgrTotalFlatDPhi;         //
   TGraphAsymmErrors  *fgrTotalFlatDPhiRel;         //
+  TString fTableFileName;               // file with the tables of the uncertainties
 
 
-  ClassDef(AliHFDhadronCorrSystUnc,1);
+  ClassDef(AliHFDhadronCorrSystUnc,2);
 };
 
 
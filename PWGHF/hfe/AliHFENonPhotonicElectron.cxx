@@ -26,6 +26,8 @@
  *											*
  *************************************************************************************/
 
+#include <algorithm>
+
 #include "TVector2.h"
 #include "THnSparse.h"
 #include "TMath.h"
@@ -95,6 +97,9 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fArraytrack		(NULL)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
+    ,fPoolTheta()
+    ,fPoolP()
+    ,fPairCandidates()
     ,fListOutput		(NULL)
     ,fAssElectron		(NULL)
     ,fIncElectron		(NULL)
@@ -153,6 +158,9 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fArraytrack		(NULL)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
+    ,fPoolTheta()
+    ,fPoolP()
+    ,fPairCandidates()
     ,fListOutput		(NULL)
     ,fAssElectron		(NULL)
     ,fIncElectron		(NULL)
@@ -211,6 +219,9 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fArraytrack		(NULL)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
+    ,fPoolTheta()
+    ,fPoolP()
+    ,fPairCandidates()
     ,fListOutput		(ref.fListOutput)
     ,fAssElectron		(ref.fAssElectron)
     ,fIncElectron		(ref.fIncElectron)
@@ -595,12 +606,63 @@ Int_t AliHFENonPhotonicElectron::FillPoolAssociatedTracks(AliVEvent *inputEvent,
         }
     } // loop tracks
 
+    IndexPoolAssociatedTracks(inputEvent);
+
     //printf(Form("Associated Pool: Tracks %d, fCounterPoolBackground %d \n", nbtracks, fCounterPoolBackground));
 
     return fCounterPoolBackground;
 
 }
 
+//_____________________________________________________________________________________________
+void AliHFENonPhotonicElectron::IndexPoolAssociatedTracks(AliVEvent *inputEvent)
+{
+    //
+    // Sort the pool of associated tracks in polar angle, to find the partners
+    // of an inclusive electron within the opening angle cut without looping over the full pool
+    //
+
+    fPoolTheta.clear();
+    fPoolP.assign(fCounterPoolBackground, 0.);
+    for(Int_t idex = 0; idex < fCounterPoolBackground; idex++){
+        AliVTrack *track = (AliVTrack *) inputEvent->GetTrack(fArraytrack->At(idex));
+        if(!track) continue;
+        fPoolTheta.push_back(std::make_pair(track->Theta(), idex));
+        fPoolP[idex] = track->P();
+    }
+    std::sort(fPoolTheta.begin(), fPoolTheta.end());
+}
+
+//_____________________________________________________________________________________________
+void AliHFENonPhotonicElectron::SelectPairCandidates(const AliVTrack *inclusive)
+{
+    //
+    // Select the associated tracks which can pass the opening angle cut with the inclusive electron.
+    // The polar angle of the tracks is conserved along their helices, so the opening angle at the DCA
+    // (or from the KF particles) is at least the difference of the polar angles. The candidates
+    // are returned in the order of the pool.
+    // With the pair generation analysis switched on, the fill values depend on the previous pairs
+    // (valueSign[5]), and with the mass constraint of the KF algorithm every pair updates the
+    // primary vertex used for the next ones (MakePairKF), so in both cases all the pool is processed
+    //
+
+    const Double_t kAngleMargin = 1e-3;     // against rounding and the transport of the KF particles
+
+    fPairCandidates.clear();
+    if(fAnaPairGen || (fSetMassConstraint && !fAlgorithmMA) || fMaxOpening3D >= TMath::Pi()){
+        for(Int_t idex = 0; idex < fCounterPoolBackground; idex++) fPairCandidates.push_back(idex);
+        return;
+    }
+
+    Double_t theta = inclusive->Theta();
+    std::vector<std::pair<Double_t,Int_t> >::const_iterator first =
+        std::lower_bound(fPoolTheta.begin(), fPoolTheta.end(), std::make_pair(theta - fMaxOpening3D - kAngleMargin, -1));
+    std::vector<std::pair<Double_t,Int_t> >::const_iterator last =
+        std::upper_bound(fPoolTheta.begin(), fPoolTheta.end(), std::make_pair(theta + fMaxOpening3D + kAngleMargin, fCounterPoolBackground));
+    for(std::vector<std::pair<Double_t,Int_t> >::const_iterator it = first; it != last; ++it) fPairCandidates.push_back(it->second);
+    std::sort(fPairCandidates.begin(), fPairCandidates.end());
+}
+
 //_____________________________________________________________________________________________
 Int_t AliHFENonPhotonicElectron::CountPoolAssociated(AliVEvent *inputEvent, Int_t binct)
 {
@@ -733,7 +795,15 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
 
     //printf(Form("Inclusive Pool: TrackNr. %d, fnumberfound %d \n", iTrack1, fnumberfound));
 
-    for(Int_t idex = 0; idex < fCounterPoolBackground; idex++){
+    // Partners within the opening angle cut, and lower limit of the invariant mass at the
+    // DCA (algorithm MA) from the momenta, conserved along the helices, and the minimum opening angle
+    SelectPairCandidates(track1);
+    Bool_t useMassPrefilter = fAlgorithmMA && !fAnaPairGen;
+    Double_t eMass = TDatabasePDG::Instance()->GetParticle(11)->Mass();
+    Double_t p1 = track1->P(), e1 = TMath::Sqrt(p1*p1 + eMass*eMass), theta1 = track1->Theta();
+
+    for(UInt_t icand = 0; icand < fPairCandidates.size(); icand++){
+        Int_t idex = fPairCandidates[icand];
         iTrack2 = fArraytrack->At(idex);
         AliDebug(2,Form("track %d",iTrack2));
         track2 = (AliVTrack *)vEvent->GetTrack(iTrack2);
@@ -743,6 +813,12 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
             continue;
         }
 
+        if(useMassPrefilter){
+            Double_t p2 = fPoolP[idex], e2 = TMath::Sqrt(p2*p2 + eMass*eMass);
+            Double_t minMass2 = 2.*(eMass*eMass + e1*e2 - p1*p2*TMath::Cos(TMath::Min(TMath::Abs(theta1 - track2->Theta()), TMath::Pi())));
+            if(minMass2 > 0. && TMath::Sqrt(minMass2) > fMaxInvMass*(1. + 1e-3) + 1e-6) continue;
+        }
+
         fCharge2 = track2->Charge();		//Charge from track2
 
         // Reset the MC info
@@ -22,6 +22,9 @@
 #include <TArrayD.h>
 #endif
 
+#include <vector>
+#include <utility>
+
 class AliESDtrackCuts;
 class AliHFEpid;
 class AliHFEpidQAmanager;
@@ -132,6 +135,8 @@ class AliHFENonPhotonicElectron : public TNamed {
   Int_t    IsMotherOmega	(Int_t tr) const;
   Bool_t MakePairDCA(const AliVTrack *inclusive, const AliVTrack *associated, AliVEvent *vEvent, Bool_t isAOD, Double_t &invMass, Double_t &angle) const;
   Bool_t MakePairKF(const AliVTrack *inclusive, const AliVTrack *associated, AliKFVertex &primV, Double_t &invMass, Double_t &angle) const;
+  void   IndexPoolAssociatedTracks(AliVEvent *inputEvent);
+  void   SelectPairCandidates(const AliVTrack *inclusive);
   Bool_t FilterCategory1Track(const AliVTrack * const track, Bool_t isAOD, Int_t binct);
   Bool_t FilterCategory2Track(const AliVTrack * const track, Bool_t isAOD);
 
@@ -166,6 +171,9 @@ class AliHFENonPhotonicElectron : public TNamed {
   TArrayI                   *fArraytrack;                   //! list of associated tracks
   Int_t                     fCounterPoolBackground;         // number of associated electrons
   Int_t                     fnumberfound;                   // number of inclusive  electrons
+  std::vector<std::pair<Double_t,Int_t> > fPoolTheta;       //! polar angle and pool position of the associated tracks, sorted in polar angle
+  std::vector<Double_t>     fPoolP;                         //! momentum of the associated tracks, by pool position
+  std::vector<Int_t>        fPairCandidates;                //! pool positions of the partners of the current inclusive electron
   TList                     *fListOutput;                   // List of histos
   THnSparseF                *fAssElectron;                  //! centrality, pt, Source MC, P, TPCsignal
   THnSparseF                *fIncElectron;                  //! centrality, pt, Source MC, eta, phi, charge
@@ -187,7 +195,7 @@ class AliHFENonPhotonicElectron : public TNamed {
 
   AliHFENonPhotonicElectron(const AliHFENonPhotonicElectron &ref); 
 
-  ClassDef(AliHFENonPhotonicElectron, 5); //!example of analysis
+  ClassDef(AliHFENonPhotonicElectron, 6); //!example of analysis
 };
 
 #endif
@@ -29,6 +29,7 @@
 #include "AliAODRecoDecayHF.h"
 #include "AliAODEvent.h"
 #include "AliVertexerTracks.h"
+#include "AliHFPrimaryVtxCache.h"
 #include "AliExternalTrackParam.h"
 #include "AliKFVertex.h"
 #include "AliVVertex.h"
@@ -332,6 +333,37 @@ AliAODVertex* AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod)
 
   return vtxAODNew;
 }
+//---------------------------------------------------------------------------
+AliAODVertex* AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod,AliHFPrimaryVtxCache *cache) {
+  //
+  // Same as above, but the daughter tracks are subtracted from the
+  // primary vertex fit of the event kept in the cache, instead of
+  // refitting the vertex from scratch for each candidate.
+  // The result is an approximation of the refit above (no outlier
+  // re-selection, tracks linearized at the event vertex).
+  // The full refit is done if the cache can not be used for this
+  // event or candidate.
+  //
+
+  if(!cache || !cache->SetEvent(aod)) return RemoveDaughtersFromPrimaryVtx(aod);
+
+  Int_t skipped[10];
+  Int_t nTrksToSkip=0,id;
+  for(Int_t i=0; i<GetNDaughters(); i++) {
+    AliAODTrack *t = dynamic_cast<AliAODTrack*>(GetDaughter(i));
+    if(!t) return RemoveDaughtersFromPrimaryVtx(aod);
+    id = (Int_t)t->GetID();
+    if(id<0) continue;
+    skipped[nTrksToSkip++] = id;
+  }
+
+  AliAODVertex *vtxAODNew = cache->RemoveTracks(nTrksToSkip,skipped);
+  if(!vtxAODNew) return RemoveDaughtersFromPrimaryVtx(aod);
+
+  RecalculateImpPars(vtxAODNew,aod);
+
+  return vtxAODNew;
+}
 //-----------------------------------------------------------------------------------
 void AliAODRecoDecayHF::RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent* aod) {
   //
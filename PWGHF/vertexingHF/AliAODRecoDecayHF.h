@@ -18,6 +18,7 @@
 class AliAODEvent;
 class AliRDHFCuts;
 class AliKFParticle;
+class AliHFPrimaryVtxCache;
 
 class AliAODRecoDecayHF : public AliAODRecoDecay {
 
@@ -51,6 +52,7 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   void UnsetOwnSecondaryVtx() {if(fOwnSecondaryVtx) {delete fOwnSecondaryVtx; fOwnSecondaryVtx=0;} return;}
   AliAODVertex* GetPrimaryVtx() const { return (GetOwnPrimaryVtx() ? GetOwnPrimaryVtx() : GetPrimaryVtxRef()); }
   AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod);  
+  AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODEvent *aod,AliHFPrimaryVtxCache *cache);
   void          RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent *aod);
 
   void     SetIsFilled(Int_t filled){fIsFilled=filled;}
@@ -0,0 +1,303 @@
+/**************************************************************************
+ * Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+//
+// Primary vertex fit of an AOD event as a sum of track contributions,
+// used to remove the daughters of HF candidates from the primary vertex
+//
+/////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <TH2F.h>
+#include <TMath.h>
+#include <TString.h>
+
+#include "AliAODEvent.h"
+#include "AliAODTrack.h"
+#include "AliAODVertex.h"
+#include "AliExternalTrackParam.h"
+#include "AliLog.h"
+#include "AliHFPrimaryVtxCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFPrimaryVtxCache);
+/// \endcond
+
+//--------------------------------------------------------------------------
+AliHFPrimaryVtxCache::AliHFPrimaryVtxCache() :
+  TObject(),
+  fAOD(0x0),
+  fEventVtxNContr(-1),
+  fEventNTracks(-1),
+  fEventRunNumber(-1),
+  fUsable(kFALSE),
+  fConstraint(kFALSE),
+  fSumRWr(0.),
+  fIDs(),
+  fW(),
+  fWr(),
+  fRWr(),
+  fHistComparison(0x0)
+{
+  //
+  /// Default constructor
+  //
+  for(Int_t i=0; i<3; i++) {fEventVtxPos[i]=0.; fSumWr[i]=0.;}
+  for(Int_t i=0; i<6; i++) fSumW[i]=0.;
+}
+//--------------------------------------------------------------------------
+AliHFPrimaryVtxCache::~AliHFPrimaryVtxCache()
+{
+  //
+  /// Destructor
+  //
+  if(fHistComparison) {delete fHistComparison; fHistComparison=0x0;}
+}
+//--------------------------------------------------------------------------
+void AliHFPrimaryVtxCache::Clear(Option_t *)
+{
+  //
+  /// Forget the cached event, the storage is kept for the next one
+  //
+  fAOD=0x0;
+  fEventVtxNContr=-1;
+  fEventNTracks=-1;
+  fEventRunNumber=-1;
+  fUsable=kFALSE;
+  fConstraint=kFALSE;
+  for(Int_t i=0; i<3; i++) {fEventVtxPos[i]=0.; fSumWr[i]=0.;}
+  for(Int_t i=0; i<6; i++) fSumW[i]=0.;
+  fSumRWr=0.;
+  fIDs.clear();
+  fW.clear();
+  fWr.clear();
+  fRWr.clear();
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFPrimaryVtxCache::SetEvent(AliAODEvent *aod)
+{
+  //
+  /// Fill the cache for the event, if not done yet.
+  /// Returns kFALSE if the event primary vertex can not be reproduced
+  /// by the sum of the track contributions, in which case the vertex
+  /// has to be refitted with AliVertexerTracks.
+  //
+  if(!aod) return kFALSE;
+  if(IsSameEvent(aod)) return fUsable;
+
+  Clear();
+  fAOD=aod;
+  AliAODVertex *vtx=aod->GetPrimaryVertex();
+  if(vtx) {
+    vtx->GetXYZ(fEventVtxPos);
+    fEventVtxNContr=vtx->GetNContributors();
+  }
+  fEventNTracks=aod->GetNumberOfTracks();
+  fEventRunNumber=aod->GetRunNumber();
+
+  fUsable=Build(aod);
+  return fUsable;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFPrimaryVtxCache::IsSameEvent(AliAODEvent *aod) const
+{
+  //
+  /// The AOD event object is reused, so the event is identified by its primary vertex
+  //
+  if(aod!=fAOD) return kFALSE;
+  if(aod->GetNumberOfTracks()!=fEventNTracks) return kFALSE;
+  if(aod->GetRunNumber()!=fEventRunNumber) return kFALSE;
+  AliAODVertex *vtx=aod->GetPrimaryVertex();
+  if(!vtx) return fEventVtxNContr<0;
+  Double_t pos[3];
+  vtx->GetXYZ(pos);
+  return (vtx->GetNContributors()==fEventVtxNContr &&
+          pos[0]==fEventVtxPos[0] && pos[1]==fEventVtxPos[1] && pos[2]==fEventVtxPos[2]);
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFPrimaryVtxCache::Build(AliAODEvent *aod)
+{
+  //
+  /// Sum the contributions of the tracks used in the primary vertex fit
+  //
+  AliAODVertex *vtx=aod->GetPrimaryVertex();
+  if(!vtx) return kFALSE;
+  TString title=vtx->GetTitle();
+  if(!title.Contains("VertexerTracks")) return kFALSE;
+
+  if(title.Contains("WithConstraint")) {
+    // same diamond as in AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx
+    Float_t diamondcovxy[3];
+    aod->GetDiamondCovXY(diamondcovxy);
+    Double_t pos[3]={aod->GetDiamondX(),aod->GetDiamondY(),0.};
+    Double_t det=diamondcovxy[0]*diamondcovxy[2]-diamondcovxy[1]*diamondcovxy[1];
+    if(det<=0.) return kFALSE;
+    fConstraint=kTRUE;
+    fSumW[0]=diamondcovxy[2]/det;
+    fSumW[1]=-diamondcovxy[1]/det;
+    fSumW[2]=diamondcovxy[0]/det;
+    fSumW[5]=1./(10.*10.);
+    fSumWr[0]=fSumW[0]*pos[0]+fSumW[1]*pos[1];
+    fSumWr[1]=fSumW[1]*pos[0]+fSumW[2]*pos[1];
+    fSumRWr=pos[0]*fSumWr[0]+pos[1]*fSumWr[1];
+  }
+
+  Double_t bField=aod->GetMagneticField();
+  for(Int_t i=0; i<aod->GetNumberOfTracks(); i++) {
+    AliAODTrack *track=dynamic_cast<AliAODTrack*>(aod->GetTrack(i));
+    if(!track || !track->GetUsedForPrimVtxFit() || track->GetID()<0) continue;
+    if(!AddTrack(track,bField)) return kFALSE;
+  }
+
+  // all the contributors must be found, otherwise the cached fit is not the event one
+  if((Int_t)fIDs.size()!=vtx->GetNContributors()) {
+    AliDebug(2,Form("%d tracks used for the primary vertex fit, %d contributors",(Int_t)fIDs.size(),vtx->GetNContributors()));
+    return kFALSE;
+  }
+
+  std::sort(fIDs.begin(),fIDs.end());
+  for(UInt_t i=1; i<fIDs.size(); i++) {
+    if(fIDs[i].first==fIDs[i-1].first) return kFALSE;
+  }
+
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFPrimaryVtxCache::AddTrack(AliAODTrack *track, Double_t bField)
+{
+  //
+  /// Contribution of a track at its point of closest approach to the event vertex,
+  /// computed as in AliVertexerTracks::TrackToPoint
+  //
+  AliExternalTrackParam etp;
+  etp.CopyFromVTrack(track);
+  Double_t dz[2],covdz[3];
+  if(!etp.PropagateToDCA(fAOD->GetPrimaryVertex(),bField,100.,dz,covdz)) return kFALSE;
+
+  Double_t alpha=etp.GetAlpha();
+  Double_t cosa=TMath::Cos(alpha);
+  Double_t sina=TMath::Sin(alpha);
+  Double_t r[3]={etp.GetX()*cosa-etp.GetY()*sina,
+                 etp.GetX()*sina+etp.GetY()*cosa,
+                 etp.GetZ()};
+
+  // inverse of the covariance matrix of the local (y,z)
+  Double_t syy=etp.GetSigmaY2(), szy=etp.GetSigmaZY(), szz=etp.GetSigmaZ2();
+  Double_t det=syy*szz-szy*szy;
+  if(det<=0.) return kFALSE;
+  Double_t uyy=szz/det, uzy=-szy/det, uzz=syy/det;
+
+  // W = Q^T U^-1 Q, Q being the projection from global (x,y,z) to local (y,z)
+  Double_t w[6]={ uyy*sina*sina,
+                 -uyy*sina*cosa,
+                  uyy*cosa*cosa,
+                 -uzy*sina,
+                  uzy*cosa,
+                  uzz};
+  Double_t wr[3]={w[0]*r[0]+w[1]*r[1]+w[3]*r[2],
+                  w[1]*r[0]+w[2]*r[1]+w[4]*r[2],
+                  w[3]*r[0]+w[4]*r[1]+w[5]*r[2]};
+  Double_t rwr=r[0]*wr[0]+r[1]*wr[1]+r[2]*wr[2];
+
+  fIDs.push_back(std::make_pair((Int_t)track->GetID(),(Int_t)fRWr.size()));
+  for(Int_t k=0; k<6; k++) {fW.push_back(w[k]); fSumW[k]+=w[k];}
+  for(Int_t k=0; k<3; k++) {fWr.push_back(wr[k]); fSumWr[k]+=wr[k];}
+  fRWr.push_back(rwr);
+  fSumRWr+=rwr;
+
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+AliAODVertex* AliHFPrimaryVtxCache::RemoveTracks(Int_t nTrks, const Int_t *ids) const
+{
+  //
+  /// Primary vertex of the event without the tracks with the given IDs,
+  /// created with "new". Tracks not used in the fit are ignored.
+  /// Returns 0 if no contributor is left or the fit is singular.
+  //
+  if(!fUsable) return 0;
+
+  Double_t sumW[6],sumWr[3],sumRWr=fSumRWr;
+  for(Int_t k=0; k<6; k++) sumW[k]=fSumW[k];
+  for(Int_t k=0; k<3; k++) sumWr[k]=fSumWr[k];
+  Int_t nContr=fIDs.size();
+
+  for(Int_t i=0; i<nTrks; i++) {
+    Bool_t duplicate=kFALSE;
+    for(Int_t j=0; j<i; j++) if(ids[j]==ids[i]) duplicate=kTRUE;
+    if(duplicate) continue;
+    std::vector<std::pair<Int_t,Int_t> >::const_iterator it=
+      std::lower_bound(fIDs.begin(),fIDs.end(),std::make_pair(ids[i],-1));
+    if(it==fIDs.end() || it->first!=ids[i]) continue;
+    Int_t ic=it->second;
+    for(Int_t k=0; k<6; k++) sumW[k]-=fW[6*ic+k];
+    for(Int_t k=0; k<3; k++) sumWr[k]-=fWr[3*ic+k];
+    sumRWr-=fRWr[ic];
+    nContr--;
+  }
+  if(nContr<=0) return 0;
+
+  // covariance matrix = inverse of the summed weights
+  Double_t c00=sumW[2]*sumW[5]-sumW[4]*sumW[4];
+  Double_t c01=sumW[3]*sumW[4]-sumW[1]*sumW[5];
+  Double_t c11=sumW[0]*sumW[5]-sumW[3]*sumW[3];
+  Double_t c02=sumW[1]*sumW[4]-sumW[2]*sumW[3];
+  Double_t c12=sumW[1]*sumW[3]-sumW[0]*sumW[4];
+  Double_t c22=sumW[0]*sumW[2]-sumW[1]*sumW[1];
+  Double_t det=sumW[0]*c00+sumW[1]*c01+sumW[3]*c02;
+  if(det<=0.) return 0;
+  Double_t cov[6]={c00/det,c01/det,c11/det,c02/det,c12/det,c22/det};
+
+  Double_t pos[3]={cov[0]*sumWr[0]+cov[1]*sumWr[1]+cov[3]*sumWr[2],
+                   cov[1]*sumWr[0]+cov[2]*sumWr[1]+cov[4]*sumWr[2],
+                   cov[3]*sumWr[0]+cov[4]*sumWr[1]+cov[5]*sumWr[2]};
+
+  Double_t chi2=sumRWr-(pos[0]*sumWr[0]+pos[1]*sumWr[1]+pos[2]*sumWr[2]);
+  Int_t ndf=2*nContr-3;
+  if(fConstraint) ndf+=3;
+  Double_t chi2perNDF=(ndf>0) ? chi2/ndf : 0.;
+
+  return new AliAODVertex(pos,cov,chi2perNDF);
+}
+//--------------------------------------------------------------------------
+void AliHFPrimaryVtxCache::Compare(const AliAODVertex *cached, const AliAODVertex *refit)
+{
+  //
+  /// Fill the pulls of the vertex obtained from the cache with respect to
+  /// the one of the full refit, for the same candidate
+  //
+  if(!cached || !refit) return;
+  if(!fHistComparison) {
+    fHistComparison=new TH2F("hPrimVtxCacheComparison","cached vs refitted primary vertex;;(cached-refit)/#sigma_{refit}",3,-0.5,2.5,200,-5.,5.);
+    fHistComparison->SetDirectory(0);
+    fHistComparison->GetXaxis()->SetBinLabel(1,"x");
+    fHistComparison->GetXaxis()->SetBinLabel(2,"y");
+    fHistComparison->GetXaxis()->SetBinLabel(3,"z");
+  }
+
+  Double_t posCached[3],posRefit[3],cov[6];
+  cached->GetXYZ(posCached);
+  refit->GetXYZ(posRefit);
+  refit->GetCovarianceMatrix(cov);
+  const Int_t kDiag[3]={0,2,5};
+  for(Int_t k=0; k<3; k++) {
+    if(cov[kDiag[k]]<=0.) continue;
+    fHistComparison->Fill(k,(posCached[k]-posRefit[k])/TMath::Sqrt(cov[kDiag[k]]));
+  }
+}
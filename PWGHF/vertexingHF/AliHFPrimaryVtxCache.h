@@ -0,0 +1,100 @@
+#ifndef ALIHFPRIMARYVTXCACHE_H
+#define ALIHFPRIMARYVTXCACHE_H
+/* Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//***********************************************************
+/// \class Class AliHFPrimaryVtxCache
+/// \brief primary vertex fit of an AOD event, kept as the sum of the
+/// weighted contributions of the tracks used in the fit, to remove the
+/// daughters of many candidates without refitting the vertex from scratch
+///
+/// The contributions of the tracks are evaluated once per event at the
+/// position of the event primary vertex, as in the last iteration of
+/// AliVertexerTracks::VertexFitter. Removing the daughters of a candidate
+/// is then a subtraction of their contributions and the solution of a 3x3
+/// system.
+///
+/// The result is an APPROXIMATION of the full refit of
+/// AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx(aod):
+/// - the refit runs AliVertexerTracks::FindPrimaryVertex on all the AOD
+///   tracks, which selects again the tracks compatible with a first-pass
+///   vertex (impact parameter cut in units of sigma). Tracks rejected as
+///   outliers of the event vertex can then re-enter the fit and contributors
+///   of the event vertex can be rejected. The cache keeps exactly the
+///   contributors of the event vertex without the daughters;
+/// - the tracks are linearized at the event vertex, not at the new vertex.
+/// The outlier rejection can not be reproduced without the tracks which
+/// are not flagged as used for the fit in the AOD, so the difference is
+/// measured instead: with AliRDHFCuts::SetUseApproxPrimVtxCache(kTRUE,kTRUE),
+/// RecalcOwnPrimaryVtx runs the refit as well and histograms the pulls of
+/// the cached vertex with respect to it (see GetComparisonHistogram()).
+/// The cache is opt-in: by default AliRDHFCuts::RecalcOwnPrimaryVtx
+/// keeps the exact refit.
+///***********************************************************
+
+#include <vector>
+#include <utility>
+
+#include <TObject.h>
+
+class TH2F;
+class AliAODEvent;
+class AliAODVertex;
+class AliAODTrack;
+
+class AliHFPrimaryVtxCache : public TObject
+{
+ public:
+
+  AliHFPrimaryVtxCache();
+  virtual ~AliHFPrimaryVtxCache();
+
+  Bool_t SetEvent(AliAODEvent *aod);
+  virtual void Clear(Option_t *opt="");
+
+  /// number of contributors of the cached fit
+  Int_t GetNContributors() const {return (Int_t)fIDs.size();}
+
+  AliAODVertex* RemoveTracks(Int_t nTrks, const Int_t *ids) const;
+
+  void Compare(const AliAODVertex *cached, const AliAODVertex *refit);
+  /// pulls (cached-refit)/sigma(refit) in x, y, z, owned by the cache
+  TH2F* GetComparisonHistogram() const {return fHistComparison;}
+
+ private:
+
+  AliHFPrimaryVtxCache(const AliHFPrimaryVtxCache &source);
+  AliHFPrimaryVtxCache& operator=(const AliHFPrimaryVtxCache &source);
+
+  Bool_t IsSameEvent(AliAODEvent *aod) const;
+  Bool_t Build(AliAODEvent *aod);
+  Bool_t AddTrack(AliAODTrack *track, Double_t bField);
+
+  AliAODEvent *fAOD;             //!<! event of the cached fit
+  Double_t fEventVtxPos[3];      //!<! position of the event primary vertex
+  Int_t    fEventVtxNContr;      //!<! contributors of the event primary vertex
+  Int_t    fEventNTracks;        //!<! number of tracks of the event
+  Int_t    fEventRunNumber;      //!<! run number of the event
+  Bool_t   fUsable;              //!<! the cached fit reproduces the event primary vertex
+  Bool_t   fConstraint;          //!<! the diamond constraint is part of the fit
+
+  Double_t fSumW[6];             //!<! sum of the weight matrices (xx,xy,yy,xz,yz,zz)
+  Double_t fSumWr[3];            //!<! sum of the weighted positions
+  Double_t fSumRWr;              //!<! sum of r^T W r, for the chi2
+
+  std::vector<std::pair<Int_t,Int_t> > fIDs; //!<! (track ID, contribution), sorted by ID
+  std::vector<Double_t> fW;      //!<! weight matrix of each contribution
+  std::vector<Double_t> fWr;     //!<! weighted position of each contribution
+  std::vector<Double_t> fRWr;    //!<! r^T W r of each contribution
+
+  TH2F    *fHistComparison;      //!<! pulls of the cached vertex with respect to the refit
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFPrimaryVtxCache,1); /// per-event primary vertex fit for the removal of candidate daughters
+  /// \endcond
+};
+
+#endif
@@ -97,6 +97,9 @@ class AliHFSystErr : public TNamed
     fIsRapidityScan = flag; 
     if(flag) AliInfo("Settings for the pPb vs y measurement");
   }
+  /// File with the tables of the uncertainties, see AliHFSystErrTables.txt
+  void SetTableFileName(const char *fileName) { fTableFileName = fileName; }
+  const char* GetTableFileName() const { return fTableFileName.Data(); }
 
   /// Function to initialize the variables/histograms
   void Init(Int_t decay);
@@ -308,6 +311,9 @@ class AliHFSystErr : public TNamed
 
   TH1F* ReflectHisto(TH1F *hin) const;
 
+  void LoadTable(const char *key);
+  TH1F** GetHistoPointer(const char *member);
+
   TH1F *fNorm;            /// normalization
   TH1F *fRawYield;        /// raw yield 
   TH1F *fTrackingEff;     /// tracking efficiency
@@ -331,8 +337,10 @@ class AliHFSystErr : public TNamed
   Bool_t fIsCentScan;      /// flag fot the PbPb centrality scan
   Bool_t fIsRapidityScan;  /// flag for the pPb vs y measurement
 
+  TString fTableFileName;  /// file with the tables of the uncertainties
+
   /// \cond CLASSIMP    
-  ClassDef(AliHFSystErr,9);  /// class for systematic errors of charm hadrons
+  ClassDef(AliHFSystErr,10);  /// class for systematic errors of charm hadrons
   /// \endcond
 };
 
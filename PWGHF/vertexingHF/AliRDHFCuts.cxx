@@ -35,6 +35,7 @@
 #include "AliESDtrackCuts.h"
 #include "AliCentrality.h"
 #include "AliAODRecoDecayHF.h"
+#include "AliHFPrimaryVtxCache.h"
 #include "AliAnalysisVertexingHF.h"
 #include "AliAODMCHeader.h"
 #include "AliAODMCParticle.h"
@@ -128,7 +129,10 @@ fCutGeoNcrNclLength(130.),
 fCutGeoNcrNclGeom1Pt(1.5),
 fCutGeoNcrNclFractionNcr(0.85),
 fCutGeoNcrNclFractionNcl(0.7),
-fUseV0ANDSelectionOffline(kFALSE)
+fUseV0ANDSelectionOffline(kFALSE),
+fUseApproxPrimVtxCache(kFALSE),
+fComparePrimVtxCache(kFALSE),
+fPrimVtxCache(0x0)
 {
   //
   // Default Constructor
@@ -204,7 +208,10 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fCutGeoNcrNclGeom1Pt(source.fCutGeoNcrNclGeom1Pt),
   fCutGeoNcrNclFractionNcr(source.fCutGeoNcrNclFractionNcr),
   fCutGeoNcrNclFractionNcl(source.fCutGeoNcrNclFractionNcl),
-  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline)
+  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline),
+  fUseApproxPrimVtxCache(source.fUseApproxPrimVtxCache),
+  fComparePrimVtxCache(source.fComparePrimVtxCache),
+  fPrimVtxCache(0x0)
 {
   //
   // Copy constructor
@@ -307,6 +314,8 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCutGeoNcrNclFractionNcr=source.fCutGeoNcrNclFractionNcr;
   fCutGeoNcrNclFractionNcl=source.fCutGeoNcrNclFractionNcl;
   fUseV0ANDSelectionOffline=source.fUseV0ANDSelectionOffline;
+  fUseApproxPrimVtxCache=source.fUseApproxPrimVtxCache;
+  fComparePrimVtxCache=source.fComparePrimVtxCache;
 
   PrintAll();
 
@@ -336,6 +345,7 @@ AliRDHFCuts::~AliRDHFCuts() {
     delete f1CutMinNCrossedRowsTPCPtDep;
     f1CutMinNCrossedRowsTPCPtDep = 0;
   }
+  if(fPrimVtxCache) {delete fPrimVtxCache; fPrimVtxCache=0;}
 
 }
 //---------------------------------------------------------------------------
@@ -1156,6 +1166,7 @@ void AliRDHFCuts::PrintAll() const {
   printf("Min SPD mult %d\n",fMinSPDMultiplicity);
   printf("Use PID %d  OldPid=%d\n",(Int_t)fUsePID,fPidHF ? fPidHF->GetOldPid() : -1);
   printf("Remove daughters from vtx %d\n",(Int_t)fRemoveDaughtersFromPrimary);
+  if(fRemoveDaughtersFromPrimary) printf(" -- using the approximate cached primary vertex fit %d (compare with refit %d)\n",(Int_t)fUseApproxPrimVtxCache,(Int_t)fComparePrimVtxCache);
   printf("Physics selection: %s\n",fUsePhysicsSelection ? "Yes" : "No");
   printf("Pileup rejection: %s\n",(fOptPileup > 0) ? "Yes" : "No");
   if(fOptPileup==1) printf(" -- Reject pileup event");
@@ -1552,6 +1563,7 @@ Bool_t AliRDHFCuts::CompareCuts(const AliRDHFCuts *obj) const {
   if(fUsePID!=obj->fUsePID) { printf("Use PID %d  %d\n",(Int_t)fUsePID,(Int_t)obj->fUsePID); areEqual=kFALSE;}
 
   if(fRemoveDaughtersFromPrimary!=obj->fRemoveDaughtersFromPrimary) {printf("Remove daughters from vtx %d  %d\n",(Int_t)fRemoveDaughtersFromPrimary,(Int_t)obj->fRemoveDaughtersFromPrimary); areEqual=kFALSE;}
+  if(fUseApproxPrimVtxCache!=obj->fUseApproxPrimVtxCache) {printf("Use approximate cached primary vtx fit %d  %d\n",(Int_t)fUseApproxPrimVtxCache,(Int_t)obj->fUseApproxPrimVtxCache); areEqual=kFALSE;}
   if(fTrackCuts){
     if(fTrackCuts->GetMinNClusterTPC()!=obj->fTrackCuts->GetMinNClusterTPC()) {printf("MinNClsTPC %d  %d\n",fTrackCuts->GetMinNClusterTPC(),obj->fTrackCuts->GetMinNClusterTPC()); areEqual=kFALSE;}
 
@@ -1624,7 +1636,23 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
     return 0;
   }   
 
-  AliAODVertex *recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  AliAODVertex *recvtx=0x0;
+  if(fUseApproxPrimVtxCache) {
+    if(!fPrimVtxCache) {
+      AliWarning("Using the approximate cached primary vertex fit instead of the refit without daughters (see AliHFPrimaryVtxCache)");
+      fPrimVtxCache=new AliHFPrimaryVtxCache();
+    }
+    // the refit is done first, the impact parameters are then recalculated with the cached vertex
+    AliAODVertex *refitvtx=0x0;
+    if(fComparePrimVtxCache && fPrimVtxCache->SetEvent(aod)) refitvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+    recvtx=d->RemoveDaughtersFromPrimaryVtx(aod,fPrimVtxCache);
+    if(refitvtx) {
+      fPrimVtxCache->Compare(recvtx,refitvtx);
+      delete refitvtx;
+    }
+  } else {
+    recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  }
   if(!recvtx){
     AliDebug(2,"Removal of daughter tracks failed");
     return kFALSE;
@@ -1638,6 +1666,15 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
   return kTRUE;
 }
 //--------------------------------------------------------------------------
+TH2F* AliRDHFCuts::GetPrimVtxCacheComparison() const
+{
+  //
+  // Pulls of the primary vertex from the cache with respect to the full refit,
+  // filled by RecalcOwnPrimaryVtx with SetUseApproxPrimVtxCache(kTRUE,kTRUE)
+  //
+  return fPrimVtxCache ? fPrimVtxCache->GetComparisonHistogram() : 0x0;
+}
+//--------------------------------------------------------------------------
 Bool_t AliRDHFCuts::SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const
 {
   //
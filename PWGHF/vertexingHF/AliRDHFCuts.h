@@ -22,7 +22,9 @@
 class AliAODTrack;
 class AliAODRecoDecayHF;
 class AliESDVertex;
+class AliHFPrimaryVtxCache;
 class TF1;
+class TH2F;
 class TFormula;
 
 class AliRDHFCuts : public AliAnalysisCuts 
@@ -363,6 +365,13 @@ class AliRDHFCuts : public AliAnalysisCuts
   Bool_t GetUseMCVertex() const { return fUseMCVertex; }
 
   Bool_t RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
+  /// APPROXIMATE: remove the daughters from the primary vertex fit of the event instead of refitting it for each candidate.
+  /// The vertex is not identical to the refit (no outlier re-selection, see AliHFPrimaryVtxCache), off by default.
+  /// With compare=kTRUE the full refit is done as well and the differences are histogrammed
+  void SetUseApproxPrimVtxCache(Bool_t use=kTRUE, Bool_t compare=kFALSE) {fUseApproxPrimVtxCache=use; fComparePrimVtxCache=compare;}
+  Bool_t GetUseApproxPrimVtxCache() const {return fUseApproxPrimVtxCache;}
+  /// pulls of the cached primary vertex with respect to the refit, owned by the cuts
+  TH2F* GetPrimVtxCacheComparison() const;
   Bool_t SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
   void   CleanOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod,AliAODVertex *origownvtx) const;
 
@@ -468,10 +477,13 @@ class AliRDHFCuts : public AliAnalysisCuts
   Double_t fCutGeoNcrNclFractionNcr; /// 4th parameter of GeoNcrNcl cut
   Double_t fCutGeoNcrNclFractionNcl; /// 5th parameter of GeoNcrNcl cut
   Bool_t fUseV0ANDSelectionOffline; ///flag to apply V0AND selection offline
+  Bool_t fUseApproxPrimVtxCache; /// flag to use the approximate cached primary vertex fit in RecalcOwnPrimaryVtx instead of the refit (default kFALSE)
+  Bool_t fComparePrimVtxCache; /// flag to compare the cached primary vertex with the full refit
+  mutable AliHFPrimaryVtxCache *fPrimVtxCache; //!<! per-event primary vertex fit
   
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,41);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,42);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
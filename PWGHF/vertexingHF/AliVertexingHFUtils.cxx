@@ -27,6 +27,7 @@
 #include "AliGenEventHeader.h"
 #include "AliAODMCParticle.h"
 #include "AliAODRecoDecayHF.h"
+#include "AliEventShapeCalculator.h"
 #include "AliVertexingHFUtils.h"
 
 /* $Id$ */
@@ -2171,9 +2172,9 @@ void AliVertexingHFUtils::GetSpherocity(AliAODEvent* aod,
   Int_t nTracks=aod->GetNumberOfTracks();
   Int_t nSelTracks=0;
 
-  Double_t* ptArr=new Double_t[nTracks];
-  Double_t* phiArr=new Double_t[nTracks];
-  Double_t sumpt=0.;
+  // static methods: one calculator per process, its buffers are reused at each call
+  static AliEventShapeCalculator eventShape;
+  eventShape.Clear();
 
   for(Int_t it=0; it<nTracks; it++) {
     AliAODTrack *tr=dynamic_cast<AliAODTrack*>(aod->GetTrack(it));
@@ -2197,37 +2198,16 @@ void AliVertexingHFUtils::GetSpherocity(AliAODEvent* aod,
     if(filtbit1==1 && !tpcRefit) fb1=kFALSE;
     if(filtbit2==1 && !tpcRefit) fb2=kFALSE;
     if( !(fb1 || fb2) ) continue;    
-    ptArr[nSelTracks]=pt;
-    phiArr[nSelTracks]=phi;
+    eventShape.AddParticle(pt,phi);
     nSelTracks++;
-    sumpt+=pt;
   }
 
   if(nSelTracks<minMult){spherocity = -0.5; return;}
 
-  //Getting thrust
-  spherocity=2.;
-  for(Int_t i=0; i<360/phiStepSizeDeg; ++i){
-    Double_t phistep=TMath::Pi()*(Double_t)i*phiStepSizeDeg/180.;
-    Double_t nx=TMath::Cos(phistep);
-    Double_t ny=TMath::Sin(phistep);
-    Double_t numer=0.;
-    for(Int_t j=0; j<nSelTracks; ++j){
-      Double_t pxA=ptArr[j]*TMath::Cos(phiArr[j]);  // x component of an unitary vector n
-      Double_t pyA=ptArr[j]*TMath::Sin(phiArr[j]);  // y component of an unitary vector n
-      numer+=TMath::Abs(ny*pxA - nx*pyA);  
-    }
-    Double_t pFull=numer*numer/(sumpt*sumpt);
-    if(pFull<spherocity){
-        spherocity=pFull; // minimization;
-        phiRef=phistep;
-    }
-  }
-
-  delete [] ptArr;
-  delete [] phiArr;
-
-  spherocity*=(TMath::Pi()*TMath::Pi()/4.);
+  // exact minimum, phiStepSizeDeg is not used anymore
+  eventShape.Compute();
+  spherocity=eventShape.GetSpherocity();
+  phiRef=eventShape.GetSpherocityAxisPhi();
   return;
 
 }
@@ -2243,9 +2223,8 @@ void AliVertexingHFUtils::GetGeneratedSpherocity(TClonesArray *arrayMC,
   Int_t nParticles=arrayMC->GetEntriesFast();
   Int_t nSelParticles=0;
 
-  Double_t* ptArr=new Double_t[nParticles];
-  Double_t* phiArr=new Double_t[nParticles];
-  Double_t sumpt=0.;
+  static AliEventShapeCalculator eventShape; // as in GetSpherocity
+  eventShape.Clear();
 
   for(Int_t ip=0; ip<nParticles; ip++) {
     AliAODMCParticle *part=(AliAODMCParticle*)arrayMC->UncheckedAt(ip);
@@ -2260,37 +2239,16 @@ void AliVertexingHFUtils::GetGeneratedSpherocity(TClonesArray *arrayMC,
     if(eta<etaMin || eta>etaMax) continue;
     if(pt<ptMin || pt>ptMax) continue;    
 
-    ptArr[nSelParticles]=pt;
-    phiArr[nSelParticles]=phi;
+    eventShape.AddParticle(pt,phi);
     nSelParticles++;
-    sumpt+=pt;
   }
 
   if(nSelParticles<minMult){spherocity = -0.5; return;}
 
-  //Getting thrust
-  spherocity=2.;
-  for(Int_t i=0; i<360/phiStepSizeDeg; ++i){
-    Double_t phistep=TMath::Pi()*(Double_t)i*phiStepSizeDeg/180.;
-    Double_t nx=TMath::Cos(phistep);
-    Double_t ny=TMath::Sin(phistep);
-    Double_t numer=0.;
-    for(Int_t j=0; j<nSelParticles; ++j){
-      Double_t pxA=ptArr[j]*TMath::Cos(phiArr[j]);  // x component of an unitary vector n
-      Double_t pyA=ptArr[j]*TMath::Sin(phiArr[j]);  // y component of an unitary vector n
-      numer+=TMath::Abs(ny*pxA - nx*pyA);  
-    }
-    Double_t pFull=numer*numer/(sumpt*sumpt);
-    if(pFull<spherocity){
-        spherocity=pFull; // minimization;
-        phiRef=phistep;
-    }
-  }
-
-  delete [] ptArr;
-  delete [] phiArr;
-
-  spherocity*=(TMath::Pi()*TMath::Pi()/4.);
+  // exact minimum, phiStepSizeDeg is not used anymore
+  eventShape.Compute();
+  spherocity=eventShape.GetSpherocity();
+  phiRef=eventShape.GetSpherocityAxisPhi();
   return;
 
 }
@@ -17,12 +17,13 @@
 #include "AliClusterContainer.h"
 #include "AliJetContainer.h"
 #include "AliFJWrapper.h"
+#include "AliEmcalJetSubstructureCache.h"
 #include "AliEmcalJetFinder.h"
 #include "TH1.h"
 
 //________________________________________________________________________
 AliEmcalJetFinder::AliEmcalJetFinder() :
-  TNamed("EmcalJetFinder","EmcalJetFinder"), fFastjetWrapper(0), fInputVectorIndex(0), fJetCount(0), fJetArray(), fGhostArea(0.005), fRadius(0.4), fJetAlgorithm(0), fRecombScheme(-1), fTrackMaxEta(0.9), fJetMaxEta(0.5), fJetMinPt(0), fJetMinArea(0)
+  TNamed("EmcalJetFinder","EmcalJetFinder"), fFastjetWrapper(0), fInputVectorIndex(0), fJetCount(0), fJetArray(), fGhostArea(0.005), fRadius(0.4), fJetAlgorithm(0), fRecombScheme(-1), fTrackMaxEta(0.9), fJetMaxEta(0.5), fJetMinPt(0), fJetMinArea(0), fSubstructureCache(0)
 {
   // Constructor
   fFastjetWrapper = new AliFJWrapper("FJWrapper", "FJWrapper");
@@ -30,7 +31,7 @@ AliEmcalJetFinder::AliEmcalJetFinder() :
 
 //________________________________________________________________________
 AliEmcalJetFinder::AliEmcalJetFinder(const char* name) :
-  TNamed(name, name), fFastjetWrapper(0), fInputVectorIndex(0), fJetCount(0), fJetArray(), fGhostArea(0.005), fRadius(0.4), fJetAlgorithm(0), fRecombScheme(-1), fTrackMaxEta(0.9), fJetMaxEta(0.5), fJetMinPt(0), fJetMinArea(0)
+  TNamed(name, name), fFastjetWrapper(0), fInputVectorIndex(0), fJetCount(0), fJetArray(), fGhostArea(0.005), fRadius(0.4), fJetAlgorithm(0), fRecombScheme(-1), fTrackMaxEta(0.9), fJetMaxEta(0.5), fJetMinPt(0), fJetMinArea(0), fSubstructureCache(0)
 {
   // Constructor
   fFastjetWrapper = new AliFJWrapper("FJWrapper", "FJWrapper");
@@ -125,6 +126,10 @@ Bool_t AliEmcalJetFinder::Filter(AliEmcalJet *pJet, AliJetContainer *pContJets,
   if ((!pJet) || (!pContJets)) return kFALSE;
 //=============================================================================
 
+  // without ghosts the subjets are read from the clustering history kept in the cache
+  if (fSubstructureCache && !pJet->HasGhost()) return FilterFromCache(pJet, pContJets, dVtx);
+//=============================================================================
+
   AliParticleContainer *pContTrks = pContJets->GetParticleContainer();
   if (pContTrks) for (Int_t i=0; i<pJet->GetNumberOfTracks(); i++) {
     AliVParticle *pTrk = pJet->TrackAt(i, pContTrks->GetArray()); if (!pTrk) continue;
@@ -213,6 +218,61 @@ Bool_t AliEmcalJetFinder::Filter(AliEmcalJet *pJet, AliJetContainer *pContJets,
   return kTRUE;
 }
 
+//________________________________________________________________________
+Bool_t AliEmcalJetFinder::FilterFromCache(AliEmcalJet *pJet, AliJetContainer *pContJets, Double_t dVtx[3])
+{
+//
+//  Same as Filter() for jets without ghosts, from the history of the substructure cache.
+//  The subjets have no area, so fJetMinArea is not applied.
+//
+
+  Int_t scheme = (fRecombScheme>=0) ? fRecombScheme : static_cast<Int_t>(fastjet::BIpt_scheme);
+  Int_t history = fSubstructureCache->Cluster(pJet, pContJets, dVtx, fJetAlgorithm, fRadius, scheme);
+  if (history<0) {
+    AliError("No input vectors added to jet finder!");
+    return kFALSE;
+  }
+
+  std::vector<Int_t> subjets;
+  std::vector<Int_t> constituents;
+  fSubstructureCache->GetSubjets(history, fRadius, subjets);
+
+  fJetArray.resize(subjets.size());
+  for (UInt_t j=0; j<subjets.size(); j++) {
+    Int_t node = subjets[j];
+    if (fSubstructureCache->GetPt(node)<fJetMinPt) continue;
+    if (TMath::Abs(fSubstructureCache->GetEta(node))>fJetMaxEta) continue;
+
+    AliEmcalJet *piece = new AliEmcalJet(fSubstructureCache->GetPt(node),
+                                         fSubstructureCache->GetEta(node),
+                                         fSubstructureCache->GetPhi(node),
+                                         fSubstructureCache->GetM(node));
+
+    piece->SetLabel(j);
+
+    UInt_t nConstis = fSubstructureCache->GetConstituents(node, constituents);
+    piece->SetNumberOfTracks(nConstis);
+    piece->SetNumberOfClusters(nConstis);
+
+    Int_t nt = 0;
+    Int_t nc = 0;
+    for (UInt_t i=0; i<nConstis; i++) {
+      Int_t uid = constituents[i];
+      if (uid>= 100) { piece->AddTrackAt(   1*uid-100, nt); ++nt; }
+      if (uid<=-100) { piece->AddClusterAt(-1*uid-100, nc); ++nc; }
+    }
+
+    piece->SetNumberOfTracks(nt);
+    piece->SetNumberOfClusters(nc);
+
+    fJetArray[fJetCount] = piece;
+    fJetCount++;
+  }
+
+  fJetArray.resize(fJetCount);
+  return kTRUE;
+}
+
 //________________________________________________________________________
 void AliEmcalJetFinder::AddInputVector(Double_t px, Double_t py, Double_t pz)
 {
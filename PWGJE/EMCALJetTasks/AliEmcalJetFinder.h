@@ -10,6 +10,7 @@ namespace fastjet {
 class AliEmcalJet;
 class AliJetContainer;
 class AliFJWrapper;
+class AliEmcalJetSubstructureCache;
 class TNamed;
 class TH1;
 
@@ -45,8 +46,12 @@ class AliEmcalJetFinder : public TNamed
     void                          SetJetMinPt(Double_t val)       {fJetMinPt = val;}
     void                          SetJetMinArea(Double_t val)     {fJetMinArea = val;}
 
+    void                          SetSubstructureCache(AliEmcalJetSubstructureCache* cache) {fSubstructureCache = cache;}
+
     void                          SetManualIndex(Int_t val)       {fInputVectorIndex = val;}
   private:
+    Bool_t                        FilterFromCache(AliEmcalJet *pJet, AliJetContainer *pContJets, Double_t dVtx[3]);
+
     // General properties
     AliFJWrapper*                 fFastjetWrapper;                // Interface object to fastjet
     Int_t                         fInputVectorIndex;              // Current index of input vectors (by default: count of vectors)
@@ -62,11 +67,13 @@ class AliEmcalJetFinder : public TNamed
     Double_t                      fJetMaxEta;                     // cut for |jet-eta| < fJetMaxEta
     Double_t                      fJetMinPt;                      // cut for  jet-pT > fJetMinPt
     Double_t                      fJetMinArea;                    // cut for  jet-area > fJetMinArea 
+    // Clustering histories shared between the reclusterings of the event
+    AliEmcalJetSubstructureCache* fSubstructureCache;             //! cache used by Filter() for jets without ghosts (not owned)
 
     AliEmcalJetFinder(const AliEmcalJetFinder& obj); // copy constructor
     AliEmcalJetFinder& operator=(const AliEmcalJetFinder& other); // assignment
 
-    ClassDef(AliEmcalJetFinder, 2); // Lightweight fastjet implementation outside analysis tasks
+    ClassDef(AliEmcalJetFinder, 3); // Lightweight fastjet implementation outside analysis tasks
 };
 
 #endif
@@ -0,0 +1,341 @@
+// $Id$
+//
+// Per-event cache of the clustering histories of the jet constituents
+//   Substructure observables (subjet fractions, N-subjettiness axes, soft
+//   drop, Lund-plane splittings, ...) recluster the constituents of the same
+//   jet several times per event, often in several wagons. The cache runs
+//   FastJet once per jet, algorithm and radius, without ghosts, and keeps
+//   the full clustering history as a flat array of nodes. Subjets,
+//   exclusive subjets and declustering sequences are then read from it.
+//   For Cambridge/Aachen the history is built with the maximum radius, and
+//   the inclusive subjets at any radius R are the nodes present before the
+//   first recombination at distance >= R, so one clustering serves all radii.
+//   The cluster momenta depend on the vertex, which is part of the key of
+//   the histories together with the jet, algorithm, scheme and radius.
+//   The constituents are clustered without ghosts: the subjets read from
+//   the cache have no area, and no area cut can be applied to them.
+//   The cache is cleared at each new entry of the analysis manager, or
+//   explicitly with NewEvent().
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "AliLog.h"
+#include "AliVCluster.h"
+#include "AliEmcalJet.h"
+#include "AliParticleContainer.h"
+#include "AliClusterContainer.h"
+#include "AliJetContainer.h"
+#include "AliAnalysisManager.h"
+#include "FJ_includes.h"
+#include "AliEmcalJetSubstructureCache.h"
+
+ClassImp(AliEmcalJetSubstructureCache)
+
+AliEmcalJetSubstructureCache *AliEmcalJetSubstructureCache::fgInstance = 0;
+
+//________________________________________________________________________
+AliEmcalJetSubstructureCache::AliEmcalJetSubstructureCache() :
+  TNamed("EmcalJetSubstructureCache","EmcalJetSubstructureCache"), fNodes(), fHistories(), fHistoryIndex(), fEntry(-1)
+{
+  // Constructor
+}
+
+//________________________________________________________________________
+AliEmcalJetSubstructureCache::AliEmcalJetSubstructureCache(const char* name) :
+  TNamed(name, name), fNodes(), fHistories(), fHistoryIndex(), fEntry(-1)
+{
+  // Constructor
+}
+
+//________________________________________________________________________
+AliEmcalJetSubstructureCache* AliEmcalJetSubstructureCache::Instance()
+{
+  // Cache shared by all the tasks of the process
+  if (!fgInstance) fgInstance = new AliEmcalJetSubstructureCache("SharedEmcalJetSubstructureCache");
+  return fgInstance;
+}
+
+//________________________________________________________________________
+void AliEmcalJetSubstructureCache::NewEvent()
+{
+  // Drop the histories of the previous event, keeping the memory
+  fNodes.clear();
+  fHistories.clear();
+  fHistoryIndex.clear();
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::Cluster(AliEmcalJet *pJet, AliJetContainer *pContJets, Double_t dVtx[3], Int_t algorithm, Double_t radius, Int_t recombScheme)
+{
+  // Index of the clustering history of the constituents of pJet, clustered at the first request.
+  // The constituents get the user index of AliEmcalJetFinder::Filter (track id+100, -cluster id-100).
+  // Returns -1 if the jet has no constituent.
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (mgr && mgr->GetCurrentEntry() != fEntry) {
+    NewEvent();
+    fEntry = mgr->GetCurrentEntry();
+  }
+
+  if ((!pJet) || (!pContJets)) return -1;
+
+  if (algorithm == kCA) radius = -1;
+  Key_t key;
+  key.fJet       = pJet;
+  key.fAlgorithm = algorithm + 10*recombScheme;
+  key.fRadius    = radius;
+  for (Int_t i=0; i<3; i++) key.fVertex[i] = dVtx ? dVtx[i] : 0;
+  std::map<Key_t, Int_t>::iterator it = fHistoryIndex.find(key);
+  if (it != fHistoryIndex.end()) return it->second;
+
+  std::vector<fastjet::PseudoJet> inputs;
+  AliParticleContainer *pContTrks = pContJets->GetParticleContainer();
+  if (pContTrks) for (Int_t i=0; i<pJet->GetNumberOfTracks(); i++) {
+    AliVParticle *pTrk = pJet->TrackAt(i, pContTrks->GetArray()); if (!pTrk) continue;
+    fastjet::PseudoJet v(pTrk->Px(), pTrk->Py(), pTrk->Pz(), pTrk->E());
+    v.set_user_index(pJet->TrackAt(i)+100);
+    inputs.push_back(v);
+  }
+
+  AliClusterContainer *pContClus = pContJets->GetClusterContainer();
+  if (pContClus) for (Int_t i=0; i<pJet->GetNumberOfClusters(); i++) {
+    AliVCluster *pClu = pJet->ClusterAt(i, pContClus->GetArray()); if (!pClu) continue;
+    TLorentzVector vClu; pClu->GetMomentum(vClu, dVtx);
+    fastjet::PseudoJet v(vClu.Px(), vClu.Py(), vClu.Pz(), vClu.P());
+    v.set_user_index(-1*pJet->ClusterAt(i)-100);
+    inputs.push_back(v);
+  }
+
+  if (inputs.empty()) return -1;
+
+  fastjet::JetAlgorithm fjAlgorithm = fastjet::antikt_algorithm;
+  if (algorithm == kKt) fjAlgorithm = fastjet::kt_algorithm;
+  if (algorithm == kCA) fjAlgorithm = fastjet::cambridge_algorithm;
+  Double_t fjRadius = (algorithm == kCA) ? fastjet::JetDefinition::max_allowable_R : radius;
+  fastjet::JetDefinition jetDef(fjAlgorithm, fjRadius, static_cast<fastjet::RecombinationScheme>(recombScheme), fastjet::Best);
+
+  History history;
+  history.fAlgorithm = algorithm;
+  history.fRadius    = radius;
+  history.fFirstNode = fNodes.size();
+  history.fNNodes    = 0;
+  history.fNLeaves   = 0;
+
+  try {
+    fastjet::ClusterSequence cs(inputs, jetDef);
+    const std::vector<fastjet::ClusterSequence::history_element> &steps = cs.history();
+    const std::vector<fastjet::PseudoJet> &jets = cs.jets();
+
+    // node of each FastJet pseudojet
+    std::vector<Int_t> nodeOfJet(jets.size(), -1);
+    for (UInt_t i=0; i<steps.size(); i++) {
+      const fastjet::ClusterSequence::history_element &step = steps[i];
+      if (step.parent2 == fastjet::ClusterSequence::BeamJet) continue;
+
+      Node node;
+      const fastjet::PseudoJet &p = jets[step.jetp_index];
+      node.fPx = p.px(); node.fPy = p.py(); node.fPz = p.pz(); node.fE = p.E();
+      node.fChild1 = -1; node.fChild2 = -1; node.fParent = -1;
+      node.fUserIndex = p.user_index();
+      node.fDeltaR = 0;
+
+      Int_t index = fNodes.size();
+      if (step.parent1 == fastjet::ClusterSequence::InexistentParent) {
+        history.fNLeaves++;
+      } else {
+        Int_t jet1 = steps[step.parent1].jetp_index;
+        Int_t jet2 = steps[step.parent2].jetp_index;
+        node.fChild1 = nodeOfJet[jet1];
+        node.fChild2 = nodeOfJet[jet2];
+        node.fDeltaR = jets[jet1].delta_R(jets[jet2]);
+        fNodes[node.fChild1].fParent = index;
+        fNodes[node.fChild2].fParent = index;
+      }
+      nodeOfJet[step.jetp_index] = index;
+      fNodes.push_back(node);
+    }
+  } catch (fastjet::Error) {
+    AliError(" [w] FJ Exception caught.");
+    fNodes.resize(history.fFirstNode);
+    return -1;
+  }
+
+  history.fNNodes = fNodes.size() - history.fFirstNode;
+  fHistories.push_back(history);
+  fHistoryIndex[key] = fHistories.size()-1;
+  return fHistories.size()-1;
+}
+
+//________________________________________________________________________
+Bool_t AliEmcalJetSubstructureCache::Key_t::operator<(const Key_t &other) const
+{
+  // Lexicographic order of the jet, algorithm, radius and vertex
+  if (fJet != other.fJet) return fJet < other.fJet;
+  if (fAlgorithm != other.fAlgorithm) return fAlgorithm < other.fAlgorithm;
+  if (fRadius != other.fRadius) return fRadius < other.fRadius;
+  for (Int_t i=0; i<3; i++) {
+    if (fVertex[i] != other.fVertex[i]) return fVertex[i] < other.fVertex[i];
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetSubjets(Int_t h, Double_t radius, std::vector<Int_t> &nodes) const
+{
+  // Inclusive subjets at the given radius: for C/A any radius, for the other
+  // algorithms only the clustering radius of the history. Returns their number.
+
+  nodes.clear();
+  const History &history = fHistories[h];
+  Int_t first = history.fFirstNode;
+  Int_t end = first + history.fNNodes;
+
+  // first recombination that does not take place at this radius
+  Int_t cut = end;
+  if (history.fAlgorithm == kCA) {
+    for (Int_t i=first+history.fNLeaves; i<end; i++) {
+      if (fNodes[i].fDeltaR >= radius) { cut = i; break; }
+    }
+  } else if (TMath::Abs(radius - history.fRadius) > 1e-6) {
+    AliError(Form("History %d was clustered with R=%.3f, subjets at R=%.3f need their own clustering", h, history.fRadius, radius));
+    return 0;
+  }
+
+  for (Int_t i=first; i<cut; i++) {
+    if (fNodes[i].fParent < 0 || fNodes[i].fParent >= cut) nodes.push_back(i);
+  }
+  return nodes.size();
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetExclusiveSubjets(Int_t h, Int_t n, std::vector<Int_t> &nodes) const
+{
+  // Exclusive subjets: the n nodes left undoing the last recombinations.
+  // Only defined if all the constituents end up in one jet (always the case for C/A).
+
+  nodes.clear();
+  const History &history = fHistories[h];
+  Int_t first = history.fFirstNode;
+  if (history.fNNodes != 2*history.fNLeaves - 1) {
+    AliError(Form("History %d has more than one jet, no exclusive subjets", h));
+    return 0;
+  }
+  if (n > history.fNLeaves) n = history.fNLeaves;
+  if (n < 1) return 0;
+
+  Int_t cut = first + 2*history.fNLeaves - n;
+  for (Int_t i=first; i<cut; i++) {
+    if (fNodes[i].fParent < 0 || fNodes[i].fParent >= cut) nodes.push_back(i);
+  }
+  return nodes.size();
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetPrimaryDeclusterings(Int_t h, std::vector<Int_t> &nodes) const
+{
+  // Recombinations along the harder branch, starting from the hardest jet of
+  // the history (Lund-plane primary splittings, soft drop grooming, ...).
+
+  nodes.clear();
+  const History &history = fHistories[h];
+  Int_t first = history.fFirstNode;
+  Int_t end = first + history.fNNodes;
+
+  Int_t node = -1;
+  for (Int_t i=first; i<end; i++) {
+    if (fNodes[i].fParent >= 0) continue;
+    if (node < 0 || GetPt(i) > GetPt(node)) node = i;
+  }
+  while (node >= 0 && !IsLeaf(node)) {
+    nodes.push_back(node);
+    node = GetHarderChild(node);
+  }
+  return nodes.size();
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetPt(Int_t node) const
+{
+  const Node &n = fNodes[node];
+  return TMath::Sqrt(n.fPx*n.fPx + n.fPy*n.fPy);
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetEta(Int_t node) const
+{
+  const Node &n = fNodes[node];
+  return TLorentzVector(n.fPx, n.fPy, n.fPz, n.fE).Eta();
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetPhi(Int_t node) const
+{
+  // Azimuth in [0,2pi), as AliEmcalJet
+  const Node &n = fNodes[node];
+  Double_t phi = TMath::ATan2(n.fPy, n.fPx);
+  if (phi < 0) phi += TMath::TwoPi();
+  return phi;
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetM(Int_t node) const
+{
+  const Node &n = fNodes[node];
+  Double_t m2 = n.fE*n.fE - n.fPx*n.fPx - n.fPy*n.fPy - n.fPz*n.fPz;
+  return (m2 > 0) ? TMath::Sqrt(m2) : -TMath::Sqrt(-m2);
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetHarderChild(Int_t node) const
+{
+  const Node &n = fNodes[node];
+  if (n.fChild1 < 0) return -1;
+  return (GetPt(n.fChild1) >= GetPt(n.fChild2)) ? n.fChild1 : n.fChild2;
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetSofterChild(Int_t node) const
+{
+  const Node &n = fNodes[node];
+  if (n.fChild1 < 0) return -1;
+  return (GetPt(n.fChild1) >= GetPt(n.fChild2)) ? n.fChild2 : n.fChild1;
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetZ(Int_t node) const
+{
+  // Momentum fraction of the softer child
+  if (IsLeaf(node)) return 0;
+  Double_t ptSoft = GetPt(GetSofterChild(node));
+  Double_t ptHard = GetPt(GetHarderChild(node));
+  return (ptSoft + ptHard > 0) ? ptSoft/(ptSoft + ptHard) : 0;
+}
+
+//________________________________________________________________________
+Double_t AliEmcalJetSubstructureCache::GetKt(Int_t node) const
+{
+  // Transverse momentum of the softer child relative to the harder one
+  if (IsLeaf(node)) return 0;
+  return GetPt(GetSofterChild(node))*fNodes[node].fDeltaR;
+}
+
+//________________________________________________________________________
+Int_t AliEmcalJetSubstructureCache::GetConstituents(Int_t node, std::vector<Int_t> &userIndices) const
+{
+  // User indices of the constituents of a node
+  userIndices.clear();
+  std::vector<Int_t> stack(1, node);
+  while (!stack.empty()) {
+    Int_t i = stack.back();
+    stack.pop_back();
+    const Node &n = fNodes[i];
+    if (n.fChild1 < 0) {
+      userIndices.push_back(n.fUserIndex);
+    } else {
+      stack.push_back(n.fChild2);
+      stack.push_back(n.fChild1);
+    }
+  }
+  return userIndices.size();
+}
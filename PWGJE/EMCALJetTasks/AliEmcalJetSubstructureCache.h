@@ -0,0 +1,97 @@
+#ifndef ALIEMCALJETSUBSTRUCTURECACHE_H
+#define ALIEMCALJETSUBSTRUCTURECACHE_H
+
+// $Id$
+
+#include <map>
+#include <vector>
+
+#include <TNamed.h>
+
+class AliEmcalJet;
+class AliJetContainer;
+
+class AliEmcalJetSubstructureCache : public TNamed
+{
+  public:
+    enum EAlgorithm_t {
+      kAntiKt = 0,                // same numbering as AliEmcalJetFinder
+      kKt     = 1,
+      kCA     = 2
+    };
+
+    AliEmcalJetSubstructureCache();
+    AliEmcalJetSubstructureCache(const char* name);
+    ~AliEmcalJetSubstructureCache() {}
+
+    static AliEmcalJetSubstructureCache* Instance();
+
+    void                          NewEvent();
+    Int_t                         Cluster(AliEmcalJet *pJet, AliJetContainer *pContJets, Double_t dVtx[3], Int_t algorithm, Double_t radius, Int_t recombScheme = 0);
+
+    // Derived from the clustering history h
+    Int_t                         GetNumberOfHistories() const    {return fHistories.size();}
+    Int_t                         GetSubjets(Int_t h, Double_t radius, std::vector<Int_t> &nodes) const;
+    Int_t                         GetExclusiveSubjets(Int_t h, Int_t n, std::vector<Int_t> &nodes) const;
+    Int_t                         GetPrimaryDeclusterings(Int_t h, std::vector<Int_t> &nodes) const;
+
+    // Nodes: leaves are the constituents, the others are the recombinations
+    Double_t                      GetPx(Int_t node) const         {return fNodes[node].fPx;}
+    Double_t                      GetPy(Int_t node) const         {return fNodes[node].fPy;}
+    Double_t                      GetPz(Int_t node) const         {return fNodes[node].fPz;}
+    Double_t                      GetE(Int_t node) const          {return fNodes[node].fE;}
+    Double_t                      GetPt(Int_t node) const;
+    Double_t                      GetEta(Int_t node) const;
+    Double_t                      GetPhi(Int_t node) const;
+    Double_t                      GetM(Int_t node) const;
+    Bool_t                        IsLeaf(Int_t node) const        {return fNodes[node].fChild1 < 0;}
+    Int_t                         GetUserIndex(Int_t node) const  {return fNodes[node].fUserIndex;}
+    Int_t                         GetParent(Int_t node) const     {return fNodes[node].fParent;}
+    Int_t                         GetHarderChild(Int_t node) const;
+    Int_t                         GetSofterChild(Int_t node) const;
+    Double_t                      GetDeltaR(Int_t node) const     {return fNodes[node].fDeltaR;}
+    Double_t                      GetZ(Int_t node) const;
+    Double_t                      GetKt(Int_t node) const;
+    Int_t                         GetConstituents(Int_t node, std::vector<Int_t> &userIndices) const;
+
+  private:
+    struct Node {
+      Double_t                    fPx;                            // four-momentum
+      Double_t                    fPy;                            //
+      Double_t                    fPz;                            //
+      Double_t                    fE;                             //
+      Int_t                       fChild1;                        // recombined nodes, -1 for the constituents
+      Int_t                       fChild2;                        //
+      Int_t                       fParent;                        // -1 for the (sub)jets at the clustering radius
+      Int_t                       fUserIndex;                     // constituent id, as in AliEmcalJetFinder
+      Double_t                    fDeltaR;                        // distance between the children
+    };
+    struct History {
+      Int_t                       fAlgorithm;                     // algorithm
+      Double_t                    fRadius;                        // clustering radius, -1 for C/A (full history)
+      Int_t                       fFirstNode;                     // first node in fNodes
+      Int_t                       fNNodes;                        // number of nodes
+      Int_t                       fNLeaves;                       // number of constituents, first in the history
+    };
+    struct Key_t {
+      const AliEmcalJet*          fJet;                           // clustered jet
+      Int_t                       fAlgorithm;                     // algorithm + 10*scheme
+      Double_t                    fRadius;                        // clustering radius, -1 for C/A
+      Double_t                    fVertex[3];                     // vertex of the cluster momenta
+      Bool_t                      operator<(const Key_t &other) const;
+    };
+
+    std::vector<Node>             fNodes;                         //! nodes of all the histories of the event
+    std::vector<History>          fHistories;                     //! histories of the event
+    std::map<Key_t, Int_t>        fHistoryIndex;                  //! history of each clustered jet
+    Long64_t                      fEntry;                         //! entry of the cached event
+
+    static AliEmcalJetSubstructureCache *fgInstance;              //! shared instance
+
+    AliEmcalJetSubstructureCache(const AliEmcalJetSubstructureCache& obj); // copy constructor
+    AliEmcalJetSubstructureCache& operator=(const AliEmcalJetSubstructureCache& other); // assignment
+
+    ClassDef(AliEmcalJetSubstructureCache, 1); // Per-event cache of the clustering histories of the jet constituents
+};
+
+#endif
@@ -41,6 +41,7 @@
 #include "TRandom3.h"
 #include "AliPicoTrack.h"
 #include "AliEmcalJetFinder.h"
+#include "AliEmcalJetSubstructureCache.h"
 #include "AliAODEvent.h"
 #include "AliAnalysisTaskSubJetFraction.h"
 
@@ -217,7 +218,8 @@ AliAnalysisTaskSubJetFraction::AliAnalysisTaskSubJetFraction() :
   fhSubJettiness2to1_FJ_OP_WTA_KT(0x0),
   fhSubJettiness2to1_FJ_OP_WTA_CA(0x0),
   fhSubJettiness2to1_FJ_MIN(0x0),
-  fTreeResponseMatrixAxis(0)
+  fTreeResponseMatrixAxis(0),
+  fReclusterers(0)
 
 {
   for(Int_t i=0;i<nVar;i++){
@@ -374,7 +376,8 @@ AliAnalysisTaskSubJetFraction::AliAnalysisTaskSubJetFraction(const char *name) :
   fhSubJettiness2to1_FJ_OP_WTA_KT(0x0),
   fhSubJettiness2to1_FJ_OP_WTA_CA(0x0),
   fhSubJettiness2to1_FJ_MIN(0x0),
-  fTreeResponseMatrixAxis(0)
+  fTreeResponseMatrixAxis(0),
+  fReclusterers(0)
   
 {
   // Standard constructor.
@@ -390,6 +393,7 @@ AliAnalysisTaskSubJetFraction::AliAnalysisTaskSubJetFraction(const char *name) :
 AliAnalysisTaskSubJetFraction::~AliAnalysisTaskSubJetFraction()
 {
   // Destructor.
+  delete fReclusterers;
 }
 
 //________________________________________________________________________
@@ -1536,7 +1540,16 @@ Double_t AliAnalysisTaskSubJetFraction::PTD(AliEmcalJet *Jet, Int_t JetContNb){
 AliEmcalJetFinder *AliAnalysisTaskSubJetFraction::Recluster(AliEmcalJet *Jet, Int_t JetContNb, Double_t SubJetRadius, Double_t SubJetMinPt, Int_t Algorithm, const char* Name){
 
   AliJetContainer *JetCont = GetJetContainer(JetContNb);
-  AliEmcalJetFinder *Reclusterer = new AliEmcalJetFinder(Name); //JetFinder Object for reclustered jets                                                                 
+  if (!fReclusterers) {
+    fReclusterers = new TList();
+    fReclusterers->SetOwner(kTRUE);
+  }
+  AliEmcalJetFinder *Reclusterer = static_cast<AliEmcalJetFinder*>(fReclusterers->FindObject(Name)); //JetFinder Object for reclustered jets, reused for all the jets
+  if (!Reclusterer) {
+    Reclusterer = new AliEmcalJetFinder(Name);
+    Reclusterer->SetSubstructureCache(AliEmcalJetSubstructureCache::Instance()); //subjets of jets without ghosts from the clustering history shared by the tasks
+    fReclusterers->Add(Reclusterer);
+  }
   Reclusterer->SetRadius(SubJetRadius); 
   Reclusterer->SetJetMinPt(SubJetMinPt);
   Reclusterer->SetJetAlgorithm(Algorithm); //0 for anti-kt     1 for kt
@@ -254,12 +254,13 @@ class AliAnalysisTaskSubJetFraction : public AliAnalysisTaskEmcalJet {
   TH1D                                *fhSubJettiness2to1_FJ_OP_WTA_CA;
   TH1D                                *fhSubJettiness2to1_FJ_MIN; 
   TTree                               *fTreeResponseMatrixAxis;  //Tree with tagging variables subtracted MC or true MC or raw 
+  TList                               *fReclusterers;            //! jet finders used for the reclustering, one per name
 
  private:
   AliAnalysisTaskSubJetFraction(const AliAnalysisTaskSubJetFraction&);            // not implemented
   AliAnalysisTaskSubJetFraction &operator=(const AliAnalysisTaskSubJetFraction&); // not implemented
 
-  ClassDef(AliAnalysisTaskSubJetFraction, 6)
+  ClassDef(AliAnalysisTaskSubJetFraction, 7)
 };
 #endif
 
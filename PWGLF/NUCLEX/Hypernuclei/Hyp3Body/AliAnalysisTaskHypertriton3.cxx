@@ -64,6 +64,7 @@
 #include "AliPhysicsSelection.h"
 #include "AliStack.h"
 #include "AliVertexerTracks.h"
+#include "AliVertexerHypertriton3Body.h"
 #include "AliVEvent.h"
 #include "AliVTrack.h"
 
@@ -84,10 +85,9 @@ AliAnalysisTaskHypertriton3::AliAnalysisTaskHypertriton3(TString taskname):
   fESDtrackCutsV0(0x0),
   fPrimaryVertex(0x0),
   fPIDResponse(0x0),
-  fVertexer(0x0),
+  fHyp3Vertexer(0x0),
   fVtx1(0x0),
   fVtx2(0x0),
-  fTrkArray(0x0),
   fQAplots(kFALSE),
   fMC(kFALSE),
   fFillTree(kFALSE),
@@ -140,6 +140,7 @@ AliAnalysisTaskHypertriton3::AliAnalysisTaskHypertriton3(TString taskname):
   fDCAdp(0.2),
   fDCApip(0.5),
   fDCAdpi(0.5),
+  fMaxPairVtxDist(-1.),
   fAngledp(TMath::Pi()),
   fAngledpi(TMath::Pi()),
   fLowCentrality(0.),
@@ -377,8 +378,7 @@ AliAnalysisTaskHypertriton3::~AliAnalysisTaskHypertriton3(){
     if(fESDtrackCuts) delete fESDtrackCuts;
     if(fESDtrackCutsV0) delete fESDtrackCutsV0;
     if(fPrimaryVertex) delete fPrimaryVertex;
-    if(fVertexer) delete fVertexer;
-    if(fTrkArray) delete fTrkArray;
+    if(fHyp3Vertexer) delete fHyp3Vertexer;
     if(fVtx1) delete fVtx1;
     if(fVtx2) delete fVtx2;
 
@@ -614,7 +614,8 @@ void AliAnalysisTaskHypertriton3::CombineThreeTracks(Bool_t isMatter, TArrayI ar
 //Define variables
 //===Combining tracks loop===//
 Double_t bz = fESDevent->GetMagneticField();
-fVertexer->SetFieldkG(bz);
+fHyp3Vertexer->SetFieldkG(bz);
+fHyp3Vertexer->SetVtxStart(fPrimaryVertex);
 
 Double_t dlh[3] = {0,0,0}; //array for the coordinates of the decay length
 Double_t dca_dp, dca_dpi, dca_ppi, angle_dp, angle_dpi, angle_ppi = 0.;
@@ -633,8 +634,6 @@ AliESDtrack *trackD = 0x0;
 AliESDtrack *trackP = 0x0;
 AliESDtrack *trackNPi = 0x0;
 
-Double_t xthiss(0.0);
-Double_t xpp(0.0);
 Float_t piprim[2] = {0.,0.};
 Float_t piprimc[3] = {0.,0.,0.};
 Float_t nsd, nsp, nspi = 0.;
@@ -655,18 +654,22 @@ TParticle *tparticlePi = 0x0;
 // -------------------------------------------------------
 
 
+fHyp3Vertexer->SetTracks(fESDevent,arrD,arrP,arrPi);
+
+// Stage 1: pairwise DCA cuts, each pair DCA is computed once per event
+// and the pairwise vertices of the surviving triplets must be compatible
 for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size()
 
-  trackD = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrD[j]));
+  trackD = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kDeuteron,j);
 
 
   for(Int_t m=0; m<arrP.GetSize(); m++){ // candidate proton loop cproton.size()
 
-    trackP = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrP[m]));
+    trackP = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kProton,m);
 
     if(trackD->GetID() == trackP->GetID()) continue;
 
-    dca_dp = trackD->GetDCA(trackP,bz,xthiss,xpp);
+    dca_dp = fHyp3Vertexer->GetDCA(AliVertexerHypertriton3Body::kDeuteronProton,j,m);
 
     fHistDCAdeupro->Fill(dca_dp);
 
@@ -675,26 +678,15 @@ for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size
 
     for(Int_t s=0; s<arrPi.GetSize(); s++ ){ // candidate pion loop cpion.size()
 
-      fTrkArray->Clear();
-      Hypertriton.Clear();
-      posD.Clear();
-      posP.Clear();
-      negPi.Clear();
-      h1.Clear();
-      d1.Clear();
-      p1.Clear();
-      pi1.Clear();
-
-      trackNPi = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrPi[s]));
-      brotherHood = kFALSE;
+      trackNPi = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kPion,s);
 
 
       if(trackNPi->GetID() == trackP->GetID()) continue;
       if(trackNPi->GetID() == trackD->GetID()) continue;
 
 
-      dca_dpi = trackNPi->GetDCA(trackD,bz,xthiss,xpp);
-      dca_ppi = trackNPi->GetDCA(trackP,bz,xthiss,xpp);
+      dca_dpi = fHyp3Vertexer->GetDCA(AliVertexerHypertriton3Body::kDeuteronPion,j,s);
+      dca_ppi = fHyp3Vertexer->GetDCA(AliVertexerHypertriton3Body::kProtonPion,m,s);
 
 
       fHistDCAdpdpi->Fill(dca_dp,dca_dpi);
@@ -712,12 +704,34 @@ for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size
       fHistDCApiondeu->Fill(dca_dpi);
       fHistDCApionpro->Fill(dca_ppi);
 
-      fTrkArray->AddAt(trackD,0);
-      fTrkArray->AddAt(trackP,1);
-      fTrkArray->AddAt(trackNPi,2);
+      fHyp3Vertexer->AddCandidate(j,m,s);
+    } // end of candidate pion loop
+  } // end of candidate proton loop
+}// end of candidate deuteron loop
+
 
-      fVertexer->SetVtxStart(fPrimaryVertex);
-      decayVtx = (AliESDVertex*)fVertexer->VertexForSelectedESDTracks(fTrkArray);
+// Stage 2: full three-track fit and selection of the surviving candidates
+for(Int_t c=0; c<fHyp3Vertexer->GetNCandidates(); c++){ // candidate triplet loop
+
+      Hypertriton.Clear();
+      posD.Clear();
+      posP.Clear();
+      negPi.Clear();
+      h1.Clear();
+      d1.Clear();
+      p1.Clear();
+      pi1.Clear();
+
+      trackD = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kDeuteron,fHyp3Vertexer->GetCandidateTrack(c,AliVertexerHypertriton3Body::kDeuteron));
+      trackP = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kProton,fHyp3Vertexer->GetCandidateTrack(c,AliVertexerHypertriton3Body::kProton));
+      trackNPi = fHyp3Vertexer->GetTrack(AliVertexerHypertriton3Body::kPion,fHyp3Vertexer->GetCandidateTrack(c,AliVertexerHypertriton3Body::kPion));
+      brotherHood = kFALSE;
+
+      dca_dp = fHyp3Vertexer->GetCandidateDCA(c,AliVertexerHypertriton3Body::kDeuteronProton);
+      dca_dpi = fHyp3Vertexer->GetCandidateDCA(c,AliVertexerHypertriton3Body::kDeuteronPion);
+      dca_ppi = fHyp3Vertexer->GetCandidateDCA(c,AliVertexerHypertriton3Body::kProtonPion);
+
+      decayVtx = fHyp3Vertexer->FitVertex(c);
 
       SetConvertedAODVertices(fPrimaryVertex,decayVtx);
 
@@ -1042,9 +1056,7 @@ if(fFillTree){
   fTTree->Fill();
   PostData(2,fTTree);
      } //end of Fill Tree
-    } // end of candidate pion loop
-  } // end of candidate proton loop
-}// end of candidate deuteron loop
+}// end of candidate triplet loop
 
 }
 
@@ -1056,8 +1068,8 @@ void AliAnalysisTaskHypertriton3::UserCreateOutputObjects(){
   //printf("AliAnalysisTaskHypertriton3::CreateOutputObjects()\n");
   //printf("**************************************************\n");
 
-  fVertexer = new AliVertexerTracks();
-  fTrkArray = new TObjArray(3);
+  fHyp3Vertexer = new AliVertexerHypertriton3Body();
+  fHyp3Vertexer->SetMaxPairVertexDistance(fMaxPairVtxDist);
   fVtx1 = new AliAODVertex();
   fVtx2 = new AliAODVertex();
 
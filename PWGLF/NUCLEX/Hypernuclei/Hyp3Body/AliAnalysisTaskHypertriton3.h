@@ -47,7 +47,7 @@ class AliESDtrack;
 class AliESDVertex;
 class AliPID;
 class AliPIDResponse;
-class AliVertexerTracks;
+class AliVertexerHypertriton3Body;
 
 class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
 
@@ -106,6 +106,7 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   void SetDCADeuteronProton(double maxdp) {fDCAdp = maxdp;}
   void SetDCAPionProton(double maxpip) {fDCApip = maxpip;}
   void SetDCADeuteronPion(double maxdpi) {fDCAdpi = maxdpi;}
+  void SetMaxPairVertexDistance(double maxdist) {fMaxPairVtxDist = maxdist;}
 
   void SetAngleDeuteronProton(double ang_dp) {fAngledp = ang_dp;}
   void SetAngleDeuteronPion(double ang_dpi) {fAngledpi = ang_dpi;}
@@ -132,13 +133,11 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   AliESDtrackCuts    *fESDtrackCutsV0;             ///< Track cuts applied only to \f$\pi^{-}\f$ and \f$\pi^{+}\f$ candidate
   AliESDVertex       *fPrimaryVertex;              //!<! Primary vertex of the current event
   AliPIDResponse     *fPIDResponse;                //!<! PID response class
-  AliVertexerTracks  *fVertexer;                   //!<! Secondary vertex reconstructed with three candidate tracks
+  AliVertexerHypertriton3Body *fHyp3Vertexer;      //!<! Staged vertexer of the three candidate tracks
 
   AliAODVertex       *fVtx1;                       //!<! Primary vertex converted from ESD to AOD
   AliAODVertex       *fVtx2;                       //!<! Secondary vertex converted from ESD to AOD
 
-  TObjArray          *fTrkArray;                   //!<! Array containing the three tracks candidated to the secondary vertex reconstruction
-
   //Variables
   Bool_t             fQAplots;
   Bool_t             fMC;                          ///< variables for MC selection
@@ -194,6 +193,7 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   Double_t           fDCAdp;                       ///< Cut DCA deuteron-proton
   Double_t           fDCApip;                      ///< Cut DCA pion-proton
   Double_t           fDCAdpi;                      ///< Cut DCA deuteron-pion
+  Double_t           fMaxPairVtxDist;              ///< Cut on the distance between the pairwise vertices of a triplet (disabled if <= 0)
   Double_t           fAngledp;                     ///< Cut on the angle between deuteron - proton
   Double_t           fAngledpi;                    ///< Cut on the angle between deuteron - pion
   Double_t           fLowCentrality;               ///< Cut on lower value of centrality class
@@ -426,7 +426,7 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   AliAnalysisTaskHypertriton3(const AliAnalysisTaskHypertriton3&); // not implemented
   AliAnalysisTaskHypertriton3& operator=(const AliAnalysisTaskHypertriton3&); // not implemented
 
-  ClassDef(AliAnalysisTaskHypertriton3, 3); // analysisclass
+  ClassDef(AliAnalysisTaskHypertriton3, 4); // analysisclass
 
 };
 
@@ -0,0 +1,167 @@
+/**************************************************************************
+ * Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+///////////////////////////////////////////////////////////////////////////
+// AliVertexerHypertriton3Body class
+// staged vertexing of d+p+pi three-body decay candidates
+//
+// The pairwise DCAs are the ones of AliExternalTrackParam::GetDCA and
+// are computed at most once per pair in the event, instead of once per
+// triplet. The approximate two-track vertex is the midpoint of the two
+// points of closest approach. A triplet is kept only if its three
+// pairwise vertices lie within fMaxPairVtxDist from each other; the
+// weighted fit of AliVertexerTracks is then run on the survivors only.
+///////////////////////////////////////////////////////////////////////////
+
+#include <TArrayI.h>
+#include <TMath.h>
+#include <TObjArray.h>
+
+#include "AliESDEvent.h"
+#include "AliESDtrack.h"
+#include "AliESDVertex.h"
+#include "AliVertexerTracks.h"
+#include "AliVertexerHypertriton3Body.h"
+
+ClassImp(AliVertexerHypertriton3Body)
+
+namespace {
+  // prongs of each pair, in the d, p, pi order of the indices
+  const Int_t kFirstProng[3]  = {AliVertexerHypertriton3Body::kDeuteron, AliVertexerHypertriton3Body::kDeuteron, AliVertexerHypertriton3Body::kProton};
+  const Int_t kSecondProng[3] = {AliVertexerHypertriton3Body::kProton, AliVertexerHypertriton3Body::kPion, AliVertexerHypertriton3Body::kPion};
+}
+
+//________________________________________________________________________
+AliVertexerHypertriton3Body::AliVertexerHypertriton3Body():
+  TObject(),
+  fBz(0.),
+  fMaxPairVtxDist(-1.),
+  fVtxStart(0x0),
+  fVertexer(new AliVertexerTracks()),
+  fTrkArray(new TObjArray(3)),
+  fCandidates()
+{
+  //Default constructor
+}
+
+//________________________________________________________________________
+AliVertexerHypertriton3Body::~AliVertexerHypertriton3Body(){
+  //Destructor
+  if(fVertexer) delete fVertexer;
+  if(fTrkArray) delete fTrkArray;
+}
+
+//________________________________________________________________________
+void AliVertexerHypertriton3Body::SetTracks(AliESDEvent *esd, const TArrayI &arrD, const TArrayI &arrP, const TArrayI &arrPi){
+  // Store the candidate tracks of the three prongs and reset the caches
+  const TArrayI *arr[3] = {&arrD, &arrP, &arrPi};
+  for(Int_t prong=0; prong<3; prong++){
+    fTracks[prong].resize(arr[prong]->GetSize());
+    for(Int_t i=0; i<arr[prong]->GetSize(); i++) fTracks[prong][i] = dynamic_cast<AliESDtrack*>(esd->GetTrack(arr[prong]->At(i)));
+  }
+
+  PairCache empty;
+  empty.fHasDCA = kFALSE;
+  empty.fHasVertex = kFALSE;
+  for(Int_t pair=0; pair<3; pair++){
+    fPairs[pair].assign(fTracks[kFirstProng[pair]].size()*fTracks[kSecondProng[pair]].size(), empty);
+  }
+  fCandidates.clear();
+}
+
+//________________________________________________________________________
+AliVertexerHypertriton3Body::PairCache &AliVertexerHypertriton3Body::GetPair(Int_t pair, Int_t i, Int_t j){
+  return fPairs[pair][i*fTracks[kSecondProng[pair]].size() + j];
+}
+
+//________________________________________________________________________
+Double_t AliVertexerHypertriton3Body::GetDCA(Int_t pair, Int_t i, Int_t j){
+  // DCA between track i of the first prong and track j of the second prong of the pair
+  PairCache &pc = GetPair(pair,i,j);
+  if(!pc.fHasDCA){
+    AliESDtrack *first = fTracks[kFirstProng[pair]][i];
+    AliESDtrack *second = fTracks[kSecondProng[pair]][j];
+    // same call order as the per-triplet computation: the pion is always the reference track
+    if(kSecondProng[pair] == kPion) pc.fDCA = second->GetDCA(first,fBz,pc.fX[1],pc.fX[0]);
+    else pc.fDCA = first->GetDCA(second,fBz,pc.fX[0],pc.fX[1]);
+    pc.fHasDCA = kTRUE;
+  }
+  return pc.fDCA;
+}
+
+//________________________________________________________________________
+const Double_t *AliVertexerHypertriton3Body::GetPairVertex(Int_t pair, Int_t i, Int_t j){
+  // Approximate two-track vertex, 0x0 if a track cannot be evaluated at its point of closest approach
+  GetDCA(pair,i,j);
+  PairCache &pc = GetPair(pair,i,j);
+  if(!pc.fHasVertex){
+    Double_t r1[3], r2[3];
+    if(!fTracks[kFirstProng[pair]][i]->GetXYZAt(pc.fX[0],fBz,r1)) return 0x0;
+    if(!fTracks[kSecondProng[pair]][j]->GetXYZAt(pc.fX[1],fBz,r2)) return 0x0;
+    for(Int_t k=0; k<3; k++) pc.fVertex[k] = 0.5*(r1[k] + r2[k]);
+    pc.fHasVertex = kTRUE;
+  }
+  return pc.fVertex;
+}
+
+//________________________________________________________________________
+Double_t AliVertexerHypertriton3Body::GetPairVertexSpread(Int_t iD, Int_t iP, Int_t iPi){
+  // Largest distance between the three pairwise vertices of the triplet, -1 if one of them is not available
+  const Double_t *v[3] = {GetPairVertex(kDeuteronProton,iD,iP), GetPairVertex(kDeuteronPion,iD,iPi), GetPairVertex(kProtonPion,iP,iPi)};
+  if(!v[0] || !v[1] || !v[2]) return -1.;
+
+  Double_t spread2 = 0.;
+  for(Int_t a=0; a<3; a++){
+    for(Int_t b=a+1; b<3; b++){
+      Double_t d2 = 0.;
+      for(Int_t k=0; k<3; k++) d2 += (v[a][k]-v[b][k])*(v[a][k]-v[b][k]);
+      if(d2 > spread2) spread2 = d2;
+    }
+  }
+  return TMath::Sqrt(spread2);
+}
+
+//________________________________________________________________________
+Bool_t AliVertexerHypertriton3Body::AddCandidate(Int_t iD, Int_t iP, Int_t iPi){
+  // Store the triplet if its pairwise vertices are compatible
+  Double_t spread = -1.;
+  if(fMaxPairVtxDist > 0.){
+    spread = GetPairVertexSpread(iD,iP,iPi);
+    if(spread > fMaxPairVtxDist) return kFALSE;
+  }
+
+  Candidate c;
+  c.fTrack[kDeuteron] = iD;
+  c.fTrack[kProton] = iP;
+  c.fTrack[kPion] = iPi;
+  c.fDCA[kDeuteronProton] = GetDCA(kDeuteronProton,iD,iP);
+  c.fDCA[kDeuteronPion] = GetDCA(kDeuteronPion,iD,iPi);
+  c.fDCA[kProtonPion] = GetDCA(kProtonPion,iP,iPi);
+  c.fSpread = spread;
+  fCandidates.push_back(c);
+  return kTRUE;
+}
+
+//________________________________________________________________________
+AliESDVertex *AliVertexerHypertriton3Body::FitVertex(Int_t c){
+  // Weighted three-track fit of candidate c
+  fTrkArray->Clear();
+  for(Int_t prong=0; prong<3; prong++) fTrkArray->AddAt(fTracks[prong][fCandidates[c].fTrack[prong]],prong);
+
+  fVertexer->SetFieldkG(fBz);
+  if(fVtxStart) fVertexer->SetVtxStart(fVtxStart);
+  return (AliESDVertex*)fVertexer->VertexForSelectedESDTracks(fTrkArray);
+}
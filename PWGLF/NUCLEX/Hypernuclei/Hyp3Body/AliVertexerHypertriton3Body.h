@@ -0,0 +1,107 @@
+#ifndef ALIVERTEXERHYPERTRITON3BODY_H
+#define ALIVERTEXERHYPERTRITON3BODY_H
+
+
+/**************************************************************************
+ *                                                                        *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// AliVertexerHypertriton3Body class
+// staged vertexing of d+p+pi three-body decay candidates:
+// - pairwise DCAs and approximate two-track vertices, computed once
+//   per pair and cached for the whole event
+// - rejection of triplets whose pairwise vertices are incompatible
+// - full three-track fit with AliVertexerTracks for the survivors
+///////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <TObject.h>
+
+class TArrayI;
+class TObjArray;
+
+class AliESDEvent;
+class AliESDtrack;
+class AliESDVertex;
+class AliVertexerTracks;
+
+class AliVertexerHypertriton3Body : public TObject {
+
+ public:
+  enum EProng_t {kDeuteron = 0, kProton = 1, kPion = 2};
+  enum EPair_t {kDeuteronProton = 0, kDeuteronPion = 1, kProtonPion = 2};
+
+  AliVertexerHypertriton3Body();
+  virtual ~AliVertexerHypertriton3Body();
+
+  void SetFieldkG(Double_t bz) {fBz = bz;}
+  void SetVtxStart(AliESDVertex *vtx) {fVtxStart = vtx;}
+  void SetMaxPairVertexDistance(Double_t maxdist) {fMaxPairVtxDist = maxdist;}  ///< <= 0 disables the compatibility stage
+
+  void SetTracks(AliESDEvent *esd, const TArrayI &arrD, const TArrayI &arrP, const TArrayI &arrPi);
+  Int_t GetNTracks(Int_t prong) const {return fTracks[prong].size();}
+  AliESDtrack *GetTrack(Int_t prong, Int_t i) const {return fTracks[prong][i];}
+
+  // Stage 1: cached pairwise quantities, indices follow the d, p, pi order of the pair
+  Double_t GetDCA(Int_t pair, Int_t i, Int_t j);
+  const Double_t *GetPairVertex(Int_t pair, Int_t i, Int_t j);
+
+  // Stage 2: compatibility of the three pairwise vertices
+  Double_t GetPairVertexSpread(Int_t iD, Int_t iP, Int_t iPi);
+  Bool_t AddCandidate(Int_t iD, Int_t iP, Int_t iPi);
+
+  // Stage 3: full fit of the surviving candidates, the caller owns the vertex
+  AliESDVertex *FitVertex(Int_t c);
+
+  Int_t GetNCandidates() const {return fCandidates.size();}
+  Int_t GetCandidateTrack(Int_t c, Int_t prong) const {return fCandidates[c].fTrack[prong];}
+  Double_t GetCandidateDCA(Int_t c, Int_t pair) const {return fCandidates[c].fDCA[pair];}
+  Double_t GetCandidateVertexSpread(Int_t c) const {return fCandidates[c].fSpread;}
+
+ private:
+  struct PairCache {
+    Bool_t   fHasDCA;          // DCA computed
+    Bool_t   fHasVertex;       // approximate vertex computed
+    Double_t fDCA;             // DCA between the two tracks
+    Double_t fX[2];            // local x of the points of closest approach
+    Double_t fVertex[3];       // midpoint of the points of closest approach
+  };
+
+  struct Candidate {
+    Int_t    fTrack[3];        // track index for each prong
+    Double_t fDCA[3];          // DCA for each pair
+    Double_t fSpread;          // largest distance between the pairwise vertices
+  };
+
+  PairCache &GetPair(Int_t pair, Int_t i, Int_t j);
+
+  AliVertexerHypertriton3Body(const AliVertexerHypertriton3Body&); // not implemented
+  AliVertexerHypertriton3Body& operator=(const AliVertexerHypertriton3Body&); // not implemented
+
+  Double_t                  fBz;              ///< Magnetic field (kG)
+  Double_t                  fMaxPairVtxDist;  ///< Maximum distance between the pairwise vertices of a triplet (cm)
+  AliESDVertex             *fVtxStart;        //!<! Starting point of the three-track fit
+  AliVertexerTracks        *fVertexer;        //!<! Three-track vertexer
+  TObjArray                *fTrkArray;        //!<! Tracks passed to the three-track vertexer
+  std::vector<AliESDtrack*> fTracks[3];       //!<! Candidate tracks for each prong
+  std::vector<PairCache>    fPairs[3];        //!<! Pairwise cache for each pair type
+  std::vector<Candidate>    fCandidates;      //!<! Triplets surviving the compatibility stage
+
+  ClassDef(AliVertexerHypertriton3Body, 1); // staged three-body vertexer
+
+};
+
+#endif
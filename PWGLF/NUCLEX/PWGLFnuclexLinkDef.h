@@ -73,6 +73,7 @@
 #pragma link C++ class AliAnalysisTaskHypertriton3+;
 #pragma link C++ class AliAnalysisTaskHypertriton3Dev+;
 #pragma link C++ class AliAnalysisTaskHypertriton3AOD+;
+#pragma link C++ class AliVertexerHypertriton3Body+;
 
 /// Utils
 /// * RecoDecay
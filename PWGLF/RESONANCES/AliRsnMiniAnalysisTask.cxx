@@ -13,6 +13,9 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <algorithm>
+#include <map>
+
 #include <Riostream.h>
 
 #include <TH1.h>
@@ -103,6 +106,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMotherAcceptanceCutMaxEta(0.9),
    fKeepMotherInAcceptance(kFALSE),
    fRsnTreeInFile(kFALSE),
+   fMaxPoolMemory(256.0),
+   fEvPool(),
+   fEvPoolSize(0.0),
+   fEvVz(),
+   fEvMult(),
+   fEvAngle(),
    fNResonanceFinders(0)
 {
 //
@@ -163,6 +172,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fMotherAcceptanceCutMaxEta(0.9),
    fKeepMotherInAcceptance(kFALSE),
    fRsnTreeInFile(saveRsnTreeInFile),
+   fMaxPoolMemory(256.0),
+   fEvPool(),
+   fEvPoolSize(0.0),
+   fEvVz(),
+   fEvMult(),
+   fEvAngle(),
    fNResonanceFinders(0)
 {
 //
@@ -229,6 +244,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMotherAcceptanceCutMaxEta(copy.fMotherAcceptanceCutMaxEta),
    fKeepMotherInAcceptance(copy.fKeepMotherInAcceptance),
    fRsnTreeInFile(copy.fRsnTreeInFile),
+   fMaxPoolMemory(copy.fMaxPoolMemory),
+   fEvPool(),
+   fEvPoolSize(0.0),
+   fEvVz(),
+   fEvMult(),
+   fEvAngle(),
    fNResonanceFinders(0)
 {
 //
@@ -296,6 +317,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fMotherAcceptanceCutMaxEta = copy.fMotherAcceptanceCutMaxEta;
    fKeepMotherInAcceptance = copy.fKeepMotherInAcceptance;
    fRsnTreeInFile = copy.fRsnTreeInFile;
+   fMaxPoolMemory = copy.fMaxPoolMemory;
 
    return (*this);
 }
@@ -427,6 +449,12 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
    if (fRsnTreeInFile) OpenFile(2);
    fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");  
    fMiniEvent = new AliRsnMiniEvent();
+   fEvPool.SetOwner(kTRUE);
+   fEvPool.Delete();
+   fEvPoolSize = 0.0;
+   fEvVz.clear();
+   fEvMult.clear();
+   fEvAngle.clear();
    fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
    
    // create one histogram per each stored definition (event histograms)
@@ -490,6 +518,7 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
       fMiniEvent->ID() = id;
       fEvBuffer->Fill();
+      StoreMiniEvent();
    }
 
    // post data for computed stuff
@@ -505,6 +534,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
 // and then the buffer will be full with all the corresponding mini-events,
 // each one containing all tracks selected by each of the available track cuts.
 // Here a loop is done on each of these events, and both single-event and mixing are computed
+// The mini-events kept in memory by StoreMiniEvent() are used directly,
+// the others are read back from the buffer.
 //
 
    // security code: reassign the buffer to the mini-event cursor
@@ -513,9 +544,10 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
+   AliRsnMiniEvent *event = 0x0;
 
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
@@ -524,6 +556,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   AliInfo(Form("[%s] %d/%d mini-events kept in memory (%.1f MB)", GetName(), fEvPool.GetEntriesFast(), nEvents, fEvPoolSize));
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -531,7 +565,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    timer.Start();
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
-      fEvBuffer->GetEntry(ievt);
+      event = GetStoredEvent(ievt);
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -546,23 +580,23 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             case AliRsnMiniOutput::kEventOnly:
                //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
                ifill = 1;
-               def->FillEvent(fMiniEvent, &fValues);
+               def->FillEvent(event, &fValues);
                break;
             case AliRsnMiniOutput::kTruePair:
                //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPair:
                //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPairRotated1:
                //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPairRotated2:
                //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             default:
                // other kinds are processed elsewhere
@@ -577,86 +611,132 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // if no mixing is required, stop here and post the output
    if (fNMix < 1) {
       AliDebugClass(2, "Stopping here, since no mixing is required");
+      fEvPool.Delete();
       PostData(1, fOutput);
       return;
    }
 
    // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > smatched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
+   // the mixing variables are kept by StoreMiniEvent(), read them from the buffer otherwise
+   if ((Int_t)fEvVz.size() != nEvents) {
+      fEvVz.resize(nEvents);
+      fEvMult.resize(nEvents);
+      fEvAngle.resize(nEvents);
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         event = GetStoredEvent(ievt);
+         fEvVz[ievt] = event->Vz();
+         fEvMult[ievt] = event->Mult();
+         fEvAngle[ievt] = event->Angle();
+      }
+   }
+
+   // group the events in cells of the mixing variables, a matching event
+   // is always in the same or in a neighbouring cell
+   typedef std::pair<Int_t, Int_t> MixCell;
+   std::map< MixCell, std::vector<Int_t> > cells;
+   for (ievt = 0; ievt < nEvents; ievt++)
+      cells[MixCell(MixBin(fEvVz[ievt], fMaxDiffVz), MixBin(fEvMult[ievt], fMaxDiffMult))].push_back(ievt);
+
    // search for good matchings
+   // the candidates of the neighbouring cells are merged in the order of the
+   // full loop over the buffer, starting after the main event and wrapping around
+   std::vector<const std::vector<Int_t> *> candList;
+   std::vector<Int_t> candFirst, candUsed;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
+      candList.clear();
+      candFirst.clear();
+      candUsed.clear();
+      Int_t binVz = MixBin(fEvVz[ievt], fMaxDiffVz), binMult = MixBin(fEvMult[ievt], fMaxDiffMult);
+      for (Int_t iVz = binVz - 1; iVz <= binVz + 1; iVz++) {
+         for (Int_t iMult = binMult - 1; iMult <= binMult + 1; iMult++) {
+            std::map< MixCell, std::vector<Int_t> >::const_iterator cell = cells.find(MixCell(iVz, iMult));
+            if (cell == cells.end()) continue;
+            candList.push_back(&cell->second);
+            candFirst.push_back(std::upper_bound(cell->second.begin(), cell->second.end(), ievt) - cell->second.begin());
+            candUsed.push_back(0);
+         }
+      }
+      Int_t ncand = candList.size();
+      while (1) {
+         // next candidate in the loop order
+         Int_t best = -1, bestDist = nEvents;
+         for (Int_t icand = 0; icand < ncand; icand++) {
+            Int_t size = candList[icand]->size();
+            if (candUsed[icand] >= size) continue;
+            Int_t dist = (*candList[icand])[(candFirst[icand] + candUsed[icand]) % size] - ievt;
+            if (dist <= 0) dist += nEvents;
+            if (dist < bestDist) {
+               best = icand;
+               bestDist = dist;
+            }
+         }
+         if (best < 0) break;
+         candUsed[best]++;
+         imix = ievt + bestDist;
          if (imix >= nEvents) imix -= nEvents;
          if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
          // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
+         if (!EventsMatch(fEvVz[ievt], fEvMult[ievt], fEvAngle[ievt], fEvVz[imix], fEvMult[imix], fEvAngle[imix])) continue;
          // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
+         if (std::find(smatched[imix].begin(), smatched[imix].end(), ievt) != smatched[imix].end()) continue;
          // check that the found good events has not enough matches already
          if (nmatched[imix] >= fNMix) continue;
          // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
+         smatched[ievt].push_back(imix);
          nmatched[ievt]++;
          nmatched[imix]++;
          if (nmatched[ievt] >= fNMix) break;
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
+   AliRsnMiniEvent evMainCopy;
+   AliRsnMiniEvent *evMain = 0x0;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
+      if (smatched[ievt].empty()) continue;
+      // an event read from the buffer is copied, since the cursor is reused for the mixed one
+      evMain = GetStoredEvent(ievt);
+      if (evMain == fMiniEvent) {
+         evMainCopy = *fMiniEvent;
+         evMain = &evMainCopy;
+      }
+      for (UInt_t imatch = 0; imatch < smatched[ievt].size(); imatch++) {
+         imix = smatched[ievt][imatch];
+         event = GetStoredEvent(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
             if (!def) continue;
             if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
+            ifill += def->FillPair(evMain, event, &fValues, kTRUE);
             if (!def->IsSymmetric()) {
                AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+               ifill += def->FillPair(event, evMain, &fValues, kFALSE);
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
+   fEvPool.Delete();
 
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
@@ -1484,33 +1564,43 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2)
+{
+//
+// Same as above, from the values of the mixing variables of the two events.
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
       if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Vz = %f", dv));
          return kFALSE;
       }
       if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Mult = %f", dm));
          return kFALSE;
       }
       if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Angle = %f", da));
          return kFALSE;
       }
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1518,6 +1608,66 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::MixBin(Double_t value, Double_t width) const
+{
+//
+// Cell of a mixing variable used to pre-select the mixing candidates.
+// Two events matching in this variable, both with the continuous and the binned mixing,
+// are at most one cell apart.
+//
+
+   if (width <= 0.0) return 0;
+   Double_t bin = TMath::Floor(value / width);
+   if (!(bin == bin)) return 0;
+   if (bin >  1E9) return  1000000000;
+   if (bin < -1E9) return -1000000000;
+   return (Int_t)bin;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::StoreMiniEvent()
+{
+//
+// Keep the mixing variables of the mini-event just added to the buffer,
+// and a decoded copy of it as long as the pool memory limit is not reached.
+// Only the first events of the buffer are kept, so that the pool index is the buffer entry.
+//
+
+   Int_t id = fEvVz.size();
+   fEvVz.push_back(fMiniEvent->Vz());
+   fEvMult.push_back(fMiniEvent->Mult());
+   fEvAngle.push_back(fMiniEvent->Angle());
+
+   if (fEvPool.GetEntriesFast() != id) return;
+   Double_t size = (sizeof(AliRsnMiniEvent) + fMiniEvent->Particles().GetEntriesFast() * sizeof(AliRsnMiniParticle)) / 1048576.0;
+   if (fEvPoolSize + size > fMaxPoolMemory) return;
+
+   fEvPool.AddLast(new AliRsnMiniEvent(*fMiniEvent));
+   fEvPoolSize += size;
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEvent *AliRsnMiniAnalysisTask::GetStoredEvent(Int_t i)
+{
+//
+// Get the i-th mini-event of the buffer, from the pool if it is there,
+// otherwise it is read into the mini-event cursor.
+// As when reading from the buffer, the transient references are those of the cursor.
+//
+
+   if (i < fEvPool.GetEntriesFast()) {
+      AliRsnMiniEvent *event = (AliRsnMiniEvent *)fEvPool.UncheckedAt(i);
+      event->SetRef(fMiniEvent->GetRef());
+      event->SetRefMC(fMiniEvent->GetRefMC());
+      event->SetQnVector(fMiniEvent->GetQnVector());
+      return event;
+   }
+
+   fEvBuffer->GetEntry(i);
+   return fMiniEvent;
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -12,6 +12,8 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -62,6 +64,7 @@ public:
    void                SetMaxDiffAngle(Double_t val)      {fMaxDiffAngle = val;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   void                SetMaxPoolMemory(Double_t mb)      {fMaxPoolMemory = mb;}
    void                SetCheckDecay(Bool_t checkDecay = kTRUE) {fCheckDecay = checkDecay;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
@@ -109,6 +112,10 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2);
+   Int_t    MixBin(Double_t value, Double_t width) const;
+   void     StoreMiniEvent();
+   AliRsnMiniEvent *GetStoredEvent(Int_t i);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -165,11 +172,18 @@ private:
    Float_t              fMotherAcceptanceCutMaxEta;             // cut value to apply when selecting the mothers inside a defined acceptance
    Bool_t               fKeepMotherInAcceptance;                // flag to keep also mothers in acceptance
    Bool_t               fRsnTreeInFile;  // flag rsn tree should be saved in file instead of memory
+   Double_t             fMaxPoolMemory;  // mixing --> memory (MB) for mini-events kept decoded in memory, the others are read back from the buffer
+
+   TObjArray            fEvPool;         //! decoded copies of the first mini-events of the buffer
+   Double_t             fEvPoolSize;     //! estimated memory (MB) of the decoded mini-events
+   std::vector<Float_t> fEvVz;           //! Vz of all the buffered mini-events
+   std::vector<Float_t> fEvMult;         //! multiplicity of all the buffered mini-events
+   std::vector<Float_t> fEvAngle;        //! angle of all the buffered mini-events
 
    UShort_t              fNResonanceFinders; // number of AliRsnMiniResonanceFinder objects
    AliRsnMiniResonanceFinder* fResonanceFinder[2]; // pointers to AliRsnMiniResonanceFinder objects
 
-   ClassDef(AliRsnMiniAnalysisTask, 16);   // AliRsnMiniAnalysisTask
+   ClassDef(AliRsnMiniAnalysisTask, 17);   // AliRsnMiniAnalysisTask
 };
 
 
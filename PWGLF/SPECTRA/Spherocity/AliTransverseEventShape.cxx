@@ -91,7 +91,8 @@ AliTransverseEventShape::AliTransverseEventShape():TObject(),
 	fhptSoMC(0),
 	fhetaStMC(0),
 	fhphiStMC(0),
-	fhptStMC(0)
+	fhptStMC(0),
+	fEventShape()
 
 {
 	// Default contructor
@@ -132,7 +133,8 @@ AliTransverseEventShape::AliTransverseEventShape(const AliTransverseEventShape &
 	fhptSoMC(0),
 	fhetaStMC(0),
 	fhphiStMC(0),
-	fhptStMC(0)
+	fhptStMC(0),
+	fEventShape()
 
 {
 	//
@@ -440,14 +442,10 @@ Float_t AliTransverseEventShape::AnalyseGetSphericity( Bool_t fillHist, const ve
 Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi ){
 
 
-	Float_t spherocity = -10.0;
-	Float_t pFull = 0;
-	Float_t Spherocity = 2;
-
-	//computing total pt
-	Float_t sumapt = 0;
+	// exact minimization over the axis, fSizeStepESA is not used anymore
+	fEventShape.Clear();
 	for(Int_t i1 = 0; i1 < fNrec; ++i1){
-		sumapt += pt[i1];
+		fEventShape.AddParticle(pt[i1], phi[i1]);
 
 		//Fill QA histos
 		if(fillHist){
@@ -457,31 +455,9 @@ Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const ve
 		}
 
 	}
+	fEventShape.Compute();
 
-	//Getting thrust
-	for(Int_t i = 0; i < 360/(fSizeStepESA); ++i){
-		Float_t numerador = 0;
-		Float_t phiparam  = 0;
-		Float_t nx = 0;
-		Float_t ny = 0;
-		phiparam=( (TMath::Pi()) * i * fSizeStepESA ) / 180; // parametrization of the angle
-		nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-		for(Int_t i1 = 0; i1 < fNrec; ++i1){
-
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
-		}
-		pFull=TMath::Power( (numerador / sumapt),2 );
-		if(pFull < Spherocity)//maximization of pFull
-		{
-			Spherocity = pFull;
-		}
-	}
-
-	spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
+	Float_t spherocity = fEventShape.GetSpherocity();
 
 
 	return spherocity;
@@ -13,6 +13,7 @@
 #include "TObject.h"
 
 #include <AliAnalysisFilter.h>
+#include "AliEventShapeCalculator.h"
 #include <vector>
 
 class AliVEvent;
@@ -44,7 +45,7 @@ class AliTransverseEventShape : public TObject {
   void  SetAODTrackFilterESA(Int_t aodtrackF) {fAODFilterGlobal = aodtrackF;}
 
   void  SetMinMultForESA(Int_t minnch)     {fMinMultESA = minnch;}
-  void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;}
+  void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;} // obsolete, the spherocity axis is found exactly
   void  SetIsEtaAbsESA(Bool_t isabseta)    {fIsAbsEtaESA = isabseta;}
   void  SetTrackEtaMinESA(Float_t etaminF) {fEtaMinCutESA = etaminF;}
   void  SetTrackEtaMaxESA(Float_t etamaxF) {fEtaMaxCutESA = etamaxF;}
@@ -116,9 +117,10 @@ class AliTransverseEventShape : public TObject {
   TH1D    *fhetaStMC;
   TH1D    *fhphiStMC;
   TH1D    *fhptStMC;
+  AliEventShapeCalculator fEventShape; //! spherocity calculator, reused for every event
 
 
-  ClassDef(AliTransverseEventShape,2) // base helper class
+  ClassDef(AliTransverseEventShape,3) // base helper class
 };
 #endif
 
@@ -54,6 +54,7 @@ class AliAODv0;
 #include "TRandom3.h"
 #include "TLorentzVector.h"
 #include "TObjectTable.h"
+#include <vector>
 //#include "AliLog.h"
 
 #include "AliESDEvent.h"
@@ -128,6 +129,7 @@ fkDoImprovedDCACascDauPropagation ( kFALSE ),
 fkDoPureGeometricMinimization( kFALSE ),
 fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
+fkPreselectDaughterPairs(kTRUE),
 fMinPtCascade(   0.3 ),
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
@@ -173,6 +175,7 @@ fkDoImprovedDCACascDauPropagation ( kFALSE ),
 fkDoPureGeometricMinimization( kFALSE ),
 fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
+fkPreselectDaughterPairs(kTRUE),
 fMinPtCascade(   0.3 ), //pre-selection
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
@@ -521,6 +524,14 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     Long_t nneg=0, npos=0, nvtx=0;
     
+    //Per-track quantities of the pairing, evaluated once per event instead of once per pair:
+    //DCA to the primary vertex, starting parameters and circle in the XY plane
+    std::vector<Double_t> lNegDCAToPV, lPosDCAToPV;
+    std::vector<AliExternalTrackParam> lNegParams, lPosParams;
+    std::vector<Double_t> lNegCircles, lPosCircles;
+    lNegDCAToPV.reserve(nentr); lNegParams.reserve(nentr); lNegCircles.reserve(3*nentr);
+    lPosDCAToPV.reserve(nentr); lPosParams.reserve(nentr); lPosCircles.reserve(3*nentr);
+    
     Long_t i;
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdTrack=event->GetTrack(i);
@@ -538,18 +549,35 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
-        if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
-        else pos[npos++]=i;
+        AliExternalTrackParam lParam(*esdTrack);
+        //Re-propagate to closest position to the primary vertex if asked to do so
+        if (fkResetInitialPositions){
+            Double_t dztemp[2], covartemp[3];
+            //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+            lParam.PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+        }
+        Double_t lCircle[3];
+        GetHelixCircle( &lParam, lCircle, b );
+        
+        if (esdTrack->GetSign() < 0.) {
+            neg[nneg++]=i;
+            lNegDCAToPV.push_back(TMath::Abs(d));
+            lNegParams.push_back(lParam);
+            lNegCircles.insert(lNegCircles.end(), lCircle, lCircle+3);
+        } else {
+            pos[npos++]=i;
+            lPosDCAToPV.push_back(TMath::Abs(d));
+            lPosParams.push_back(lParam);
+            lPosCircles.insert(lPosCircles.end(), lCircle, lCircle+3);
+        }
     }
     
     
     for (i=0; i<nneg; i++) {
         Long_t nidx=neg[i];
-        AliESDtrack *ntrk=event->GetTrack(nidx);
         
         for (Int_t k=0; k<npos; k++) {
             Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
             
             //Pre-select dE/dx: only proceed if at least one of these tracks looks like a proton
             /*
@@ -560,22 +588,19 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
              }
              */
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (lNegDCAToPV[i]<fV0VertexerSels[1])
+                if (lPosDCAToPV[k]<fV0VertexerSels[2]) continue;
             
-            AliExternalTrackParam nt(*ntrk), pt(*ptrk), *ntp=&nt, *ptp=&pt;
+            //Skip pairs that cannot pass the DCA cut before any propagation
+            if (fkPreselectDaughterPairs &&
+                !IsV0DaughterPairCompatible(&lNegParams[i], &lNegCircles[3*i], &lPosParams[k], &lPosCircles[3*k])) continue;
+            
+            //Starting parameters, re-propagated to the primary vertex if asked to do so
+            AliExternalTrackParam nt(lNegParams[i]), pt(lPosParams[k]), *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
             
             //Improved call: use own function, including XY-pre-opt stage
             
-            //Re-propagate to closest position to the primary vertex if asked to do so
-            if (fkResetInitialPositions){
-                Double_t dztemp[2], covartemp[3];
-                //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-            }
-            
             if( fkDoImprovedDCAV0DauPropagation ){
                 //Improved: use own call
                 dca=GetDCAV0Dau(ptp, ntp, xp, xn, b);
@@ -775,6 +800,24 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         trk[ntr++]=i;
     }
     
+    //Bachelor candidates of each charge, in the order of trk, with their circles in the XY plane
+    std::vector<Int_t> lBachNeg, lBachPos;
+    std::vector<Double_t> lBachNegCircles, lBachPosCircles;
+    for (Long_t j=0; j<ntr; j++) {
+        AliESDtrack *btrk=event->GetTrack(trk[j]);
+        Double_t lCircle[3];
+        GetHelixCircle( btrk, lCircle, b );
+        if (btrk->GetSign()<=0) {
+            lBachNeg.push_back(trk[j]);
+            lBachNegCircles.insert(lBachNegCircles.end(), lCircle, lCircle+3);
+        }
+        if (btrk->GetSign()>=0) {
+            lBachPos.push_back(trk[j]);
+            lBachPosCircles.insert(lBachPosCircles.end(), lCircle, lCircle+3);
+        }
+    }
+    Int_t nBachNeg=lBachNeg.size(), nBachPos=lBachPos.size();
+    
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
     
@@ -784,14 +827,15 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        for (Int_t j=0; j<nBachNeg; j++) {//loop on tracks with the bachelor's charge
+            Int_t bidx=lBachNeg[j];
             //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
             
-            AliESDtrack *btrk=event->GetTrack(bidx);
+            //Skip bachelors that cannot pass the DCA cut before any propagation
+            if (fkPreselectDaughterPairs && !IsV0BachelorPairCompatible(&v0, &lBachNegCircles[3*j])) continue;
             
-            if (btrk->GetSign()>0) continue;  // bachelor's charge
+            AliESDtrack *btrk=event->GetTrack(bidx);
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
@@ -846,13 +890,14 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
         
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        for (Int_t j=0; j<nBachPos; j++) {//loop on tracks with the bachelor's charge
+            Int_t bidx=lBachPos[j];
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
             
-            AliESDtrack *btrk=event->GetTrack(bidx);
+            //Skip bachelors that cannot pass the DCA cut before any propagation
+            if (fkPreselectDaughterPairs && !IsV0BachelorPairCompatible(&v0, &lBachPosCircles[3*j])) continue;
             
-            if (btrk->GetSign()<0) continue;  // bachelor's charge
+            AliESDtrack *btrk=event->GetTrack(bidx);
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
@@ -1914,3 +1959,66 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     center[1] =	ypos + ypoint;
     return;
 }
+
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track, Double_t circle[3], Double_t b) const {
+    // Center and radius of the helix projection on the XY plane, in the
+    // parametrization used by Evaluate. Radius set to -1 for straight tracks.
+    Double_t helix[6];
+    track->GetHelixParameters(helix,b);
+    
+    circle[0] = helix[5];
+    circle[1] = helix[0];
+    circle[2] = -1.;
+    if (TMath::Abs(helix[4])<1e-10) return;
+    
+    circle[0] -= TMath::Sin(helix[2])/helix[4];
+    circle[1] += TMath::Cos(helix[2])/helix[4];
+    circle[2]  = TMath::Abs(1./helix[4]);
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsV0DaughterPairCompatible(const AliExternalTrackParam *nt, const Double_t *nCircle,
+                                                                    const AliExternalTrackParam *pt, const Double_t *pCircle) const {
+    // Returns kFALSE only if the pair is certain to fail the DCA V0 daughters cut.
+    // Both GetDCAV0Dau and AliExternalTrackParam::GetDCA return sqrt(dm*sqrt(dy2*dz2)),
+    // with dm = dxy^2/dy2 + dz^2/dz2 evaluated at two points of the helices: the
+    // returned DCA is never smaller than dxy*(dz2/dy2)^(1/4), where dxy is at least
+    // the distance between the two circles in the XY plane.
+    if (nCircle[2]<0 || pCircle[2]<0) return kTRUE;
+    
+    Double_t lDist = TMath::Sqrt( (nCircle[0]-pCircle[0])*(nCircle[0]-pCircle[0]) +
+                                  (nCircle[1]-pCircle[1])*(nCircle[1]-pCircle[1]) );
+    Double_t lDistXY = TMath::Max( lDist - nCircle[2] - pCircle[2], TMath::Abs(nCircle[2]-pCircle[2]) - lDist );
+    lDistXY -= 1e-4; //tolerance for rounding, in cm
+    if (lDistXY <= 0) return kTRUE;
+    
+    Double_t dy2=nt->GetSigmaY2() + pt->GetSigmaY2();
+    Double_t dz2=nt->GetSigmaZ2() + pt->GetSigmaZ2();
+    if (dy2 <= 0 || dz2 <= 0) return kTRUE;
+    
+    return lDistXY*lDistXY*TMath::Sqrt(dz2/dy2) <= fV0VertexerSels[3]*fV0VertexerSels[3];
+}
+
+///________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::IsV0BachelorPairCompatible(const AliESDv0 *v, const Double_t *bCircle) const {
+    // Returns kFALSE only if the pair is certain to fail the DCA cascade daughters cut.
+    // With the improved propagation, the DCA is the distance of a point of the bachelor
+    // helix to the V0 line, never smaller than the distance between the bachelor circle
+    // and the V0 line in the XY plane. The linear propagation is not bounded this way.
+    if (!fkDoImprovedDCACascDauPropagation) return kTRUE;
+    if (bCircle[2]<0) return kTRUE;
+    
+    Double_t x,y,z,px,py,pz;
+    v->GetXYZ(x,y,z);
+    v->GetPxPyPz(px,py,pz);
+    Double_t lPtV0 = TMath::Sqrt(px*px+py*py);
+    if (lPtV0 < 1e-10) return kTRUE;
+    
+    //Distance between the circle center and the V0 line
+    Double_t lDist = TMath::Abs( (bCircle[0]-x)*py - (bCircle[1]-y)*px )/lPtV0;
+    Double_t lDistXY = lDist - bCircle[2];
+    lDistXY -= 1e-4; //tolerance for rounding, in cm
+    
+    return lDistXY <= fCascadeVertexerSels[4];
+}
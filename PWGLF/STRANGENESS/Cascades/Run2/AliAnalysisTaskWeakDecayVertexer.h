@@ -87,6 +87,11 @@ public:
         //WARNING: Requires V0 refit for covariance matrix
         if( lDoCascadeRefit && !fkDoV0Refit ) fkDoV0Refit = kTRUE;
     }
+    void SetPreselectDaughterPairs( Bool_t lOpt = kTRUE ){
+        //Reject pairs that cannot pass the DCA cut from their XY circles
+        //before any propagation (does not change the vertex lists)
+        fkPreselectDaughterPairs = lOpt;
+    }
     void SetMaxIterations (Long_t lMaxIter = 100){
         fMaxIterationsWhenMinimizing = lMaxIter;
     }
@@ -210,6 +215,12 @@ public:
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
     //---------------------------------------------------------------------------------------
+    //Daughter pair preselection in the XY plane
+    void GetHelixCircle(const AliExternalTrackParam *track, Double_t circle[3], Double_t b) const;
+    Bool_t IsV0DaughterPairCompatible(const AliExternalTrackParam *nt, const Double_t *nCircle,
+                                      const AliExternalTrackParam *pt, const Double_t *pCircle) const;
+    Bool_t IsV0BachelorPairCompatible(const AliESDv0 *v, const Double_t *bCircle) const;
+    //---------------------------------------------------------------------------------------
 
 private:
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
@@ -249,6 +260,7 @@ private:
     Bool_t fkDoPureGeometricMinimization;
     Bool_t fkDoCascadeRefit; //WARNING: needs DoV0Refit!
     Long_t fMaxIterationsWhenMinimizing;
+    Bool_t fkPreselectDaughterPairs; //if true, skip pairs whose XY circles are too far apart for the DCA cuts
     
     //Min/Max pT for cascades
     Float_t fMinPtCascade; //minimum pt above which we keep candidates in TTree output
@@ -274,8 +286,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: daughter pair preselection
 };
 
 #endif
@@ -37,6 +37,7 @@
 #include "AliVEventHandler.h"
 #include "AliAODInputHandler.h"
 #include "AliOADBContainer.h"
+#include "AliEMCALOADBCache.h"
 #include "AliAODMCParticle.h"
 #include "AliCentrality.h"
 #include "AliMultSelection.h"
@@ -85,7 +86,7 @@ AliAnalysisTaskEMCALClusterize::AliAnalysisTaskEMCALClusterize(const char *name)
 , fRejectBelowThreshold(kFALSE)
 , fRemoveLEDEvents(kTRUE),fRemoveExoticEvents(kFALSE)
 , fImportGeometryFromFile(kTRUE), fImportGeometryFilePath("")
-, fOADBSet(kFALSE),       fAccessOADB(kTRUE),         fOADBFilePath("")
+, fOADBSet(kFALSE),       fAccessOADB(kTRUE),         fOADBFilePath(""),   fOADBCache(0)
 , fConstantTimeShift(0)
 , fCentralityClass(""),   fUseAliCentrality(0),       fSelectEMCALEvent(0)
 , fEMCALEnergyCut(0.),    fEMCALNcellsCut (0)
@@ -148,7 +149,7 @@ AliAnalysisTaskEMCALClusterize::AliAnalysisTaskEMCALClusterize()
 , fRejectBelowThreshold(kFALSE)
 , fRemoveLEDEvents(kTRUE),  fRemoveExoticEvents(kFALSE)
 , fImportGeometryFromFile(kTRUE), fImportGeometryFilePath("")
-, fOADBSet(kFALSE),         fAccessOADB(kTRUE),        fOADBFilePath("")
+, fOADBSet(kFALSE),         fAccessOADB(kTRUE),        fOADBFilePath(""),   fOADBCache(0)
 , fConstantTimeShift(0)
 , fCentralityClass(""),     fUseAliCentrality(0),      fSelectEMCALEvent(0)
 , fEMCALEnergyCut(0.),      fEMCALNcellsCut (0)
@@ -208,6 +209,7 @@ AliAnalysisTaskEMCALClusterize::~AliAnalysisTaskEMCALClusterize()
   if(fClusterizer) delete fClusterizer;
   if(fUnfolder)    delete fUnfolder;   
   if(fRecoUtils)   delete fRecoUtils;
+  if(fOADBCache)   AliEMCALOADBCache::Release();
 }
 
 //_______________________________________________________
@@ -288,16 +290,19 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
   
   Int_t nSM = fGeom->GetNumberOfSuperModules();
   
+  // Calibration containers shared with the other EMCal tasks
+  if(!fOADBCache) fOADBCache = AliEMCALOADBCache::Acquire();
+  
   // Bad map
   if(fRecoUtils->IsBadChannelsRemovalSwitchedOn())
   {
-    AliOADBContainer *contBC=new AliOADBContainer("");
+    TString fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data();
     if(fOADBFilePath!="")
-      contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fOADBFilePath.Data()),"AliEMCALBadChannels");
-    else
-      contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"AliEMCALBadChannels");
+      fileBC = Form("%s/EMCALBadChannels.root",fOADBFilePath.Data());
+    
+    AliOADBContainer *contBC = fOADBCache->GetContainer(fileBC,"AliEMCALBadChannels");
 
-    TObjArray *arrayBC=(TObjArray*)contBC->GetObject(fRun);
+    TObjArray *arrayBC = contBC ? (TObjArray*)contBC->GetObject(fRun) : 0;
     
     if(arrayBC)
     {
@@ -319,26 +324,24 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
             continue;
           }
           
+          hbm=(TH2I*)hbm->Clone();
           hbm->SetDirectory(0);
           fRecoUtils->SetEMCALChannelStatusMap(i,hbm);
           
         } // loop
     } else AliInfo("Do NOT remove EMCAL bad channels"); // run array
-    
-    delete contBC;
   }  // Remove bad
   
   // Energy Recalibration
   if(fRecoUtils->IsRecalibrationOn())
   {
-    AliOADBContainer *contRF=new AliOADBContainer("");
-    
+    TString fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data();
     if(fOADBFilePath!="")
-      contRF->InitFromFile(Form("%s/EMCALRecalib.root",fOADBFilePath.Data()),"AliEMCALRecalib");
-    else
-      contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"AliEMCALRecalib");
+      fileRF = Form("%s/EMCALRecalib.root",fOADBFilePath.Data());
+    
+    AliOADBContainer *contRF = fOADBCache->GetContainer(fileRF,"AliEMCALRecalib");
 
-    TObjArray *recal=(TObjArray*)contRF->GetObject(fRun); 
+    TObjArray *recal = contRF ? (TObjArray*)contRF->GetObject(fRun) : 0;
     
     if(recal)
     {
@@ -366,6 +369,7 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
               continue;
             }
             
+            h=(TH2F*)h->Clone();
             h->SetDirectory(0);
             
             fRecoUtils->SetEMCALChannelRecalibrationFactors(i,h);
@@ -373,46 +377,19 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
         } else AliInfo("Do NOT recalibrate EMCAL, no params object array"); // array ok
       } else AliInfo("Do NOT recalibrate EMCAL, no params for pass"); // array pass ok
     } else AliInfo("Do NOT recalibrate EMCAL, no params for run");  // run number array ok
-        
-    delete contRF;
   } // Recalibration on
   
   // Energy Recalibration, apply on top of previous calibration factors
   if(fRecoUtils->IsRunDepRecalibrationOn())
   {
-    AliOADBContainer *contRFTD=new AliOADBContainer("");
-    
+    TString fileRFTD = AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data();
     if(fOADBFilePath!="")
-      contRFTD->InitFromFile(Form("%s/EMCALTemperatureCorrCalib.root",fOADBFilePath.Data()),"AliEMCALRunDepTempCalibCorrections");
-    else
-      contRFTD->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"AliEMCALRunDepTempCalibCorrections");
-
-    TH1S *htd=(TH1S*)contRFTD->GetObject(fRun); 
+      fileRFTD = Form("%s/EMCALTemperatureCorrCalib.root",fOADBFilePath.Data());
+    
+    // Correction factors per cell, from the run or the closest one
+    Int_t nbins = 0;
+    const Double_t *htd = fOADBCache->GetTemperatureCorrections(fileRFTD,fRun,nbins);
     
-    //If it did not exist for this run, get closes one
-    if (!htd)
-    {
-      AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",fRun));
-      // let's get the closest fRun instead then..
-      Int_t lower = 0;
-      Int_t ic = 0;
-      Int_t maxEntry = contRFTD->GetNumberOfEntries();
-      
-      while ( (ic < maxEntry) && (contRFTD->UpperLimit(ic) < fRun) ) {
-        lower = ic;
-        ic++;
-      }
-      
-      Int_t closest = lower;
-      if ( (ic<maxEntry) &&
-          (contRFTD->LowerLimit(ic)-fRun) < (fRun - contRFTD->UpperLimit(lower)) ) {
-        closest = ic;
-      }
-      
-      AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", closest, contRFTD->LowerLimit(closest)));
-      htd = (TH1S*) contRFTD->GetObjectByIndex(closest);
-    } 
-
     if(htd)
     {
       AliInfo("Recalibrate (Temperature) EMCAL");
@@ -426,29 +403,26 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
             Float_t factor = fRecoUtils->GetEMCALChannelRecalibrationFactor(ism,icol,irow);
             
             Int_t absID = fGeom->GetAbsCellIdFromCellIndexes(ism, irow, icol); // original calibration factor
-            factor *= htd->GetBinContent(absID) / 10000. ; // correction dependent on T
+            factor *= htd[absID] ; // correction dependent on T
             //printf("\t ism %d, icol %d, irow %d,absID %d, corrA %2.3f, corrB %2.3f, corrAB %2.3f\n",ism, icol, irow, absID, 
-            //      GetEMCALChannelRecalibrationFactor(ism,icol,irow) , htd->GetBinContent(absID) / 10000., factor);
+            //      GetEMCALChannelRecalibrationFactor(ism,icol,irow) , htd[absID], factor);
             fRecoUtils->SetEMCALChannelRecalibrationFactor(ism,icol,irow,factor);
           } // columns
         } // rows
       } // SM loop
     } else AliInfo("Do NOT recalibrate EMCAL with T variations, no params TH1");
-    
-    delete contRFTD;
   } // Run by Run T calibration
   
   // Time Recalibration
   if(fRecoUtils->IsTimeRecalibrationOn())
   {
-    AliOADBContainer *contTRF=new AliOADBContainer("");
-    
+    TString fileTRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data();
     if(fOADBFilePath!="")
-      contTRF->InitFromFile(Form("%s/EMCALTimeCalib.root",fOADBFilePath.Data()),"AliEMCALTimeCalib");
-    else
-      contTRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"AliEMCALTimeCalib");
+      fileTRF = Form("%s/EMCALTimeCalib.root",fOADBFilePath.Data());
+    
+    AliOADBContainer *contTRF = fOADBCache->GetContainer(fileTRF,"AliEMCALTimeCalib");
 
-    TObjArray *trecal=(TObjArray*)contTRF->GetObject(fRun);
+    TObjArray *trecal = contTRF ? (TObjArray*)contTRF->GetObject(fRun) : 0;
     
     if(trecal)
     {
@@ -479,14 +453,13 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
             continue;
           }
           
+          h=(TH1F*)h->Clone();
           h->SetDirectory(0);
           
           fRecoUtils->SetEMCALChannelTimeRecalibrationFactors(ibc,h);
         } // bunch crossing loop
       } else AliInfo("Do NOT recalibrate time EMCAL, no params for pass"); // array pass ok
     } else AliInfo("Do NOT recalibrate time EMCAL, no params for run");  // run number array ok
-    
-    delete contTRF;
   } // Time recalibration on    
     
   // L1 Phase Time Recalibration
@@ -496,27 +469,17 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
     if (!fRecoUtils->GetEMCALL1PhaseInTimeRecalibrationArray())
       fRecoUtils->InitEMCALL1PhaseInTimeRecalibration() ;
     
-    AliOADBContainer *contBC = new AliOADBContainer("");
-        
-    TFile *timeFile;
+    TString fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data();
     if(fOADBFilePath!="")
-      timeFile = new TFile(Form("%s/EMCALTimeL1PhaseCalib.root",fOADBFilePath.Data()),"read");
-    else
-      timeFile = new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"read");
-
-    if (!timeFile || timeFile->IsZombie())
+      fileBC = Form("%s/EMCALTimeL1PhaseCalib.root",fOADBFilePath.Data());
+    
+    AliOADBContainer *contBC = fOADBCache->GetContainer(fileBC,"AliEMCALTimeL1PhaseCalib");
+    if (!contBC)
     {
       AliFatal(Form("EMCALTimeL1PhaseCalib.root was not found in the path provided: %s",fOADBFilePath.Data()));
       return ;
     }
     
-    if (timeFile) delete timeFile;
-    
-    if(fOADBFilePath!="")
-      contBC->InitFromFile(Form("%s/EMCALTimeL1PhaseCalib.root",fOADBFilePath.Data()),"AliEMCALTimeL1PhaseCalib");
-    else
-      contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"AliEMCALTimeL1PhaseCalib");
-
     TObjArray *arrayBC=(TObjArray*)contBC->GetObject(fRun);
     if (!arrayBC)
     {
@@ -554,12 +517,11 @@ void AliAnalysisTaskEMCALClusterize::AccessOADB()
           return;
         }
         
+        h=(TH1C*)h->Clone();
         h->SetDirectory(0);
         fRecoUtils->SetEMCALL1PhaseInTimeRecalibrationForAllSM(h);
       }
     }
-
-    delete contBC;
   }   // L1 Phase Time Recalibration
     
   // Parameters already set once, so do not it again, unless run changes
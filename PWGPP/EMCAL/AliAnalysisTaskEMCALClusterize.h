@@ -31,6 +31,7 @@ class AliAODCaloCluster;
 class AliCentrality;
 class AliMultSelection;
 class AliVCaloCells;
+class AliEMCALOADBCache;
 
 #include "AliEMCALRecParam.h"
 #include "AliEMCALRecoUtils.h"
@@ -391,6 +392,7 @@ private:
   Bool_t                 fOADBSet ;                ///<  AODB parameters already set
   Bool_t                 fAccessOADB ;             ///<  Get calibration from OADB for EMCAL
   TString                fOADBFilePath ;           ///<  Default path $ALICE_PHYSICS/OADB/EMCAL, if needed change
+  AliEMCALOADBCache    * fOADBCache ;              //!<! Shared EMCAL OADB containers
   Float_t                fConstantTimeShift;       ///<  Apply a 600 ns time shift in case of simulation, shift in ns.
 
   // Centrality
@@ -448,7 +450,7 @@ private:
   AliAnalysisTaskEMCALClusterize& operator=(const AliAnalysisTaskEMCALClusterize&) ;
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEMCALClusterize, 42) ;
+  ClassDef(AliAnalysisTaskEMCALClusterize, 43) ;
   /// \endcond
 
 };
@@ -47,6 +47,7 @@ AliQnCorrectionsDetector::AliQnCorrectionsDetector() : TNamed(),
 
   fDetectorId = -1;
   fDataVectorAcceptedConfigurations.SetOwner(kFALSE);
+  fDataVectorAcceptedMask = 0;
   fCorrectionsManager = NULL;
 }
 
@@ -60,6 +61,7 @@ AliQnCorrectionsDetector::AliQnCorrectionsDetector(const char *name, Int_t id) :
 
   fDetectorId = id;
   fDataVectorAcceptedConfigurations.SetOwner(kFALSE);
+  fDataVectorAcceptedMask = 0;
   fCorrectionsManager = NULL;
 }
 
@@ -69,6 +71,30 @@ AliQnCorrectionsDetector::~AliQnCorrectionsDetector() {
 
 }
 
+/// Incorporates to the passed array the ids of the variables
+/// that define the event classes of the detector configurations.
+/// Already present ids are not repeated.
+/// \param ids the array of variable ids
+void AliQnCorrectionsDetector::FillEventClassVariablesIds(TArrayI &ids) const {
+  for (Int_t ixConfiguration = 0; ixConfiguration < fConfigurations.GetEntriesFast(); ixConfiguration++) {
+    AliQnCorrectionsEventClassVariablesSet &variables = fConfigurations.At(ixConfiguration)->GetEventClassVariablesSet();
+    for (Int_t ixVariable = 0; ixVariable < variables.GetEntriesFast(); ixVariable++) {
+      Int_t varId = variables.At(ixVariable)->GetVariableId();
+      Bool_t found = kFALSE;
+      for (Int_t i = 0; i < ids.GetSize(); i++) {
+        if (ids.At(i) == varId) {
+          found = kTRUE;
+          break;
+        }
+      }
+      if (!found) {
+        ids.Set(ids.GetSize() + 1);
+        ids.AddAt(varId, ids.GetSize() - 1);
+      }
+    }
+  }
+}
+
 /// Asks for support data structures creation
 ///
 /// The request is transmitted to the attached detector configurations
@@ -15,6 +15,7 @@
 /// \brief Detector and detector configuration classes for Q vector correction framework
 ///
 
+#include <TArrayI.h>
 #include "AliQnCorrectionsDetectorConfigurationBase.h"
 #include "AliQnCorrectionsDetectorConfigurationsSet.h"
 
@@ -68,6 +69,15 @@ public:
   /// \return the configuration name
   const char *GetAcceptedDataDetectorConfigurationName(Int_t index) const
   { return fDataVectorAcceptedConfigurations.At(index)->GetName(); }
+  /// Gets the mask of detector configurations that accepted last data vector
+  /// \return bit i set if the detector configuration i accepted the data vector
+  UInt_t GetAcceptedDataDetectorConfigurationsMask() const
+  { return fDataVectorAcceptedMask; }
+  /// Gets the number of detector configurations
+  /// \return the number of detector configurations
+  Int_t GetNoOfDetectorConfigurations() const
+  { return fConfigurations.GetEntriesFast(); }
+  void FillEventClassVariablesIds(TArrayI &ids) const;
 
   void AttachCorrectionsManager(AliQnCorrectionsManager *manager);
   void AddDetectorConfiguration(AliQnCorrectionsDetectorConfigurationBase *detectorConfiguration);
@@ -78,6 +88,7 @@ public:
   virtual void ReportOnCorrections(TList *steps, TList *calib, TList *apply) const;
 
   Int_t AddDataVector(const Float_t *variableContainer, Double_t phi, Double_t weight = 1.0, Int_t channelId = -1);
+  Int_t AddAcceptedDataVector(UInt_t configurationsMask, Double_t phi, Double_t weight = 1.0, Int_t channelId = -1);
 
   virtual void ClearDetector();
 
@@ -85,6 +96,7 @@ private:
   Int_t fDetectorId;            ///< detector Id
   AliQnCorrectionsDetectorConfigurationsSet fConfigurations;  ///< the set of configurations defined for this detector
   AliQnCorrectionsDetectorConfigurationsSet fDataVectorAcceptedConfigurations; ///< the set of configurations that accepted a data vector
+  UInt_t fDataVectorAcceptedMask;  //!<! mask of the configurations that accepted a data vector
   AliQnCorrectionsManager *fCorrectionsManager; ///< the framework correction manager
 
 private:
@@ -96,7 +108,7 @@ private:
   AliQnCorrectionsDetector& operator= (const AliQnCorrectionsDetector &);
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsDetector, 2);
+  ClassDef(AliQnCorrectionsDetector, 3);
 /// \endcond
 };
 
@@ -111,15 +123,37 @@ private:
 /// \return the number of detector configurations that accepted and stored the data vector
 inline Int_t AliQnCorrectionsDetector::AddDataVector(const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t channelId) {
   fDataVectorAcceptedConfigurations.Clear();
+  fDataVectorAcceptedMask = 0;
   for (Int_t ixConfiguration = 0; ixConfiguration < fConfigurations.GetEntriesFast(); ixConfiguration++) {
     Bool_t ret = fConfigurations.At(ixConfiguration)->AddDataVector(variableContainer, phi, weight, channelId);
     if (ret) {
       fDataVectorAcceptedConfigurations.Add(fConfigurations.At(ixConfiguration));
+      fDataVectorAcceptedMask |= (1U << ixConfiguration);
     }
   }
   return fDataVectorAcceptedConfigurations.GetEntries();
 }
 
+/// New data vector for the detector with already known acceptance
+/// The data vector is stored, without checking cuts, in the attached detector
+/// configurations flagged in the passed mask, i.e. when replaying a framework
+/// input cache.
+/// \param configurationsMask bit i set if the detector configuration i accepts the data vector
+/// \param phi azimuthal angle
+/// \param weight the weight of the data vector
+/// \param channelId the channel Id that originates the data vector
+/// \return the number of detector configurations that stored the data vector
+inline Int_t AliQnCorrectionsDetector::AddAcceptedDataVector(UInt_t configurationsMask, Double_t phi, Double_t weight, Int_t channelId) {
+  Int_t nStored = 0;
+  for (Int_t ixConfiguration = 0; ixConfiguration < fConfigurations.GetEntriesFast(); ixConfiguration++) {
+    if (configurationsMask & (1U << ixConfiguration)) {
+      fConfigurations.At(ixConfiguration)->StoreDataVector(phi, weight, channelId);
+      nStored++;
+    }
+  }
+  return nStored;
+}
+
 /// Ask for processing corrections for the involved detector
 ///
 /// The request is transmitted to the attached detector configurations
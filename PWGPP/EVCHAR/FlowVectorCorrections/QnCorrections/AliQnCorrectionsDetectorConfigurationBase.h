@@ -255,6 +255,12 @@ public:
   /// \param channelId the channel Id that originates the data vector
   /// \return kTRUE if the data vector was accepted and stored
   virtual Bool_t AddDataVector(const Float_t *variableContainer, Double_t phi, Double_t weight = 1.0, Int_t channelId = -1) = 0;
+  /// Stores a data vector already known to be accepted by the detector configuration
+  /// Pure virtual function
+  /// \param phi azimuthal angle
+  /// \param weight the weight of the data vector
+  /// \param channelId the channel Id that originates the data vector
+  virtual void StoreDataVector(Double_t phi, Double_t weight = 1.0, Int_t channelId = -1) = 0;
 
   virtual Bool_t IsSelected(const Float_t *variableContainer);
   virtual Bool_t IsSelected(const Float_t *variableContainer, Int_t nChannel);
@@ -100,6 +100,7 @@ public:
   virtual void AddCorrectionOnInputData(AliQnCorrectionsCorrectionOnInputData *correctionOnInputData);
 
   virtual Bool_t AddDataVector(const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t channelId);
+  virtual void StoreDataVector(Double_t phi, Double_t weight, Int_t channelId);
 
   virtual void BuildQnVector();
   void BuildRawQnVector();
@@ -173,14 +174,23 @@ private:
 inline Bool_t AliQnCorrectionsDetectorConfigurationChannels::AddDataVector(
     const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t channelId) {
   if (IsSelected(variableContainer, channelId)) {
-    /// add the data vector to the bank
-    new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
-      AliQnCorrectionsDataVectorChannelized(channelId, phi, weight);
+    StoreDataVector(phi, weight, channelId);
     return kTRUE;
   }
   return kFALSE;
 }
 
+/// Stores a data vector already known to belong to an assigned channel
+/// and to pass the associated cuts, i.e. when replaying a framework input cache.
+/// \param phi azimuthal angle
+/// \param weight the weight of the data vector
+/// \param channelId the channel Id that originates the data vector
+inline void AliQnCorrectionsDetectorConfigurationChannels::StoreDataVector(Double_t phi, Double_t weight, Int_t channelId) {
+  /// add the data vector to the bank
+  new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
+    AliQnCorrectionsDataVectorChannelized(channelId, phi, weight);
+}
+
 /// Builds raw Qn vector before Q vector corrections and before input
 /// data corrections but considering the chosen calibration method.
 /// This is a channelized configuration so this Q vector will NOT be
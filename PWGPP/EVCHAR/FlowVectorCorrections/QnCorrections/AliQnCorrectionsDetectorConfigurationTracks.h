@@ -62,6 +62,7 @@ public:
   virtual Bool_t ProcessCorrections(const Float_t *variableContainer);
   virtual Bool_t ProcessDataCollection(const Float_t *variableContainer);
   virtual Bool_t AddDataVector(const Float_t *variableContainer, Double_t phi, Double_t weight = 1.0, Int_t channelId = -1);
+  virtual void StoreDataVector(Double_t phi, Double_t weight = 1.0, Int_t channelId = -1);
 
   virtual void BuildQnVector();
   virtual void IncludeQnVectors(TList *list);
@@ -103,14 +104,23 @@ private:
 inline Bool_t AliQnCorrectionsDetectorConfigurationTracks::AddDataVector(
     const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t id) {
   if (IsSelected(variableContainer)) {
-    /// add the data vector to the bank
-    new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
-        AliQnCorrectionsDataVector(id, phi, weight);
+    StoreDataVector(phi, weight, id);
     return kTRUE;
   }
   return kFALSE;
 }
 
+/// Stores a data vector already known to pass the associated cuts,
+/// i.e. when replaying a framework input cache.
+/// \param phi azimuthal angle
+/// \param weight the weight associated to the data vector. For track detector is usually one.
+/// \param id the Id associated to the data vector. For track detector configurations could represent the track id.
+inline void AliQnCorrectionsDetectorConfigurationTracks::StoreDataVector(Double_t phi, Double_t weight, Int_t id) {
+  /// add the data vector to the bank
+  new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
+      AliQnCorrectionsDataVector(id, phi, weight);
+}
+
 /// Clean the configuration to accept a new event
 ///
 /// Transfers the order to the Q vector correction steps and
@@ -0,0 +1,299 @@
+/**************************************************************************************************
+ *                                                                                                *
+ * Package:       FlowVectorCorrections                                                           *
+ * Authors:       Jaap Onderwaater, GSI, jacobus.onderwaater@cern.ch                              *
+ *                Ilya Selyuzhenkov, GSI, ilya.selyuzhenkov@gmail.com                             *
+ *                Víctor González, UCM, victor.gonzalez@cern.ch                                   *
+ *                Contributors are mentioned in the code where appropriate.                       *
+ * Development:   2012-2016                                                                       *
+ *                                                                                                *
+ * This file is part of FlowVectorCorrections, a software package that corrects Q-vector          *
+ * measurements for effects of nonuniform detector acceptance. The corrections in this package    *
+ * are based on publication:                                                                      *
+ *                                                                                                *
+ *  [1] "Effects of non-uniform acceptance in anisotropic flow measurements"                      *
+ *  Ilya Selyuzhenkov and Sergei Voloshin                                                         *
+ *  Phys. Rev. C 77, 034904 (2008)                                                                *
+ *                                                                                                *
+ * The procedure proposed in [1] is extended with the following steps:                            *
+ * (*) alignment correction between subevents                                                     *
+ * (*) possibility to extract the twist and rescaling corrections                                 *
+ *      for the case of three detector subevents                                                  *
+ *      (currently limited to the case of two “hit-only” and one “tracking” detectors)            *
+ * (*) (optional) channel equalization                                                            *
+ * (*) flow vector width equalization                                                             *
+ *                                                                                                *
+ * FlowVectorCorrections is distributed under the terms of the GNU General Public License (GPL)   *
+ * (https://en.wikipedia.org/wiki/GNU_General_Public_License)                                     *
+ * either version 3 of the License, or (at your option) any later version.                        *
+ *                                                                                                *
+ **************************************************************************************************/
+
+/// \file AliQnCorrectionsInputCache.cxx
+/// \brief Implementation of the framework input data cache class
+
+#include <TFile.h>
+#include <TDirectory.h>
+#include <TTree.h>
+#include <TBranch.h>
+#include "AliQnCorrectionsInputCache.h"
+#include "AliLog.h"
+
+/// \cond CLASSIMP
+ClassImp(AliQnCorrectionsInputCache);
+/// \endcond
+
+const char *AliQnCorrectionsInputCache::szCacheTreeName = "QnInputCache";
+const char *AliQnCorrectionsInputCache::szVariableIdsKeyName = "QnInputCacheVariableIds";
+const Int_t AliQnCorrectionsInputCache::nInitialDataVectorsSize = 4096;
+
+/// Default constructor
+AliQnCorrectionsInputCache::AliQnCorrectionsInputCache() :
+    TObject(), fVariableIds() {
+
+  fFile = NULL;
+  fTree = NULL;
+  fWriting = kFALSE;
+  fVariables = NULL;
+  fRunNumber = -1;
+  fNoOfDataVectors = 0;
+  fDataVectorsSize = 0;
+  fDetectorId = NULL;
+  fChannelId = NULL;
+  fPhi = NULL;
+  fWeight = NULL;
+  fConfigurationsMask = NULL;
+}
+
+/// Default destructor
+/// Closes the cache file if still open and releases the buffers
+AliQnCorrectionsInputCache::~AliQnCorrectionsInputCache() {
+
+  Close();
+  if (fVariables != NULL) delete [] fVariables;
+  if (fDetectorId != NULL) delete [] fDetectorId;
+  if (fChannelId != NULL) delete [] fChannelId;
+  if (fPhi != NULL) delete [] fPhi;
+  if (fWeight != NULL) delete [] fWeight;
+  if (fConfigurationsMask != NULL) delete [] fConfigurationsMask;
+}
+
+/// Grows the data vectors buffers keeping their content
+/// If the tree is already there the branches are pointed to the new buffers
+/// \param size the minimum new capacity
+void AliQnCorrectionsInputCache::ExpandDataVectorsBuffers(Int_t size) {
+  if (size <= fDataVectorsSize) return;
+
+  Int_t newSize = (fDataVectorsSize > 0) ? fDataVectorsSize : nInitialDataVectorsSize;
+  while (newSize < size) newSize *= 2;
+
+  UChar_t *detectorId = new UChar_t[newSize];
+  Int_t *channelId = new Int_t[newSize];
+  Float_t *phi = new Float_t[newSize];
+  Float_t *weight = new Float_t[newSize];
+  UInt_t *configurationsMask = new UInt_t[newSize];
+
+  /* when reading, fNoOfDataVectors could already hold the new event size */
+  Int_t nToKeep = (fNoOfDataVectors < fDataVectorsSize) ? fNoOfDataVectors : fDataVectorsSize;
+  for (Int_t i = 0; i < nToKeep; i++) {
+    detectorId[i] = fDetectorId[i];
+    channelId[i] = fChannelId[i];
+    phi[i] = fPhi[i];
+    weight[i] = fWeight[i];
+    configurationsMask[i] = fConfigurationsMask[i];
+  }
+
+  if (fDetectorId != NULL) delete [] fDetectorId;
+  if (fChannelId != NULL) delete [] fChannelId;
+  if (fPhi != NULL) delete [] fPhi;
+  if (fWeight != NULL) delete [] fWeight;
+  if (fConfigurationsMask != NULL) delete [] fConfigurationsMask;
+
+  fDetectorId = detectorId;
+  fChannelId = channelId;
+  fPhi = phi;
+  fWeight = weight;
+  fConfigurationsMask = configurationsMask;
+  fDataVectorsSize = newSize;
+
+  if (fTree != NULL) SetBranchAddresses();
+}
+
+/// Points the tree branches to the current buffers
+void AliQnCorrectionsInputCache::SetBranchAddresses() {
+  fTree->SetBranchAddress("Variables", fVariables);
+  fTree->SetBranchAddress("RunNumber", &fRunNumber);
+  fTree->SetBranchAddress("nDataVectors", &fNoOfDataVectors);
+  fTree->SetBranchAddress("DetectorId", fDetectorId);
+  fTree->SetBranchAddress("ChannelId", fChannelId);
+  fTree->SetBranchAddress("Phi", fPhi);
+  fTree->SetBranchAddress("Weight", fWeight);
+  fTree->SetBranchAddress("ConfigurationsMask", fConfigurationsMask);
+}
+
+/// Creates the cache file and its tree
+/// \param fileName the name of the cache file
+/// \param variableIds the ids of the variables bank entries to store per event
+/// \return kTRUE if everything went OK
+Bool_t AliQnCorrectionsInputCache::OpenForWriting(const char *fileName, const TArrayI &variableIds) {
+  Close();
+
+  /* keep the current directory untouched */
+  TDirectory *savedDirectory = gDirectory;
+  fFile = TFile::Open(fileName, "RECREATE");
+  savedDirectory->cd();
+  if (fFile == NULL || fFile->IsZombie()) {
+    AliError(Form("Not possible to create the Qn input cache file %s", fileName));
+    fFile = NULL;
+    return kFALSE;
+  }
+
+  fVariableIds = variableIds;
+  if (fVariables != NULL) delete [] fVariables;
+  fVariables = new Float_t[(fVariableIds.GetSize() > 0) ? fVariableIds.GetSize() : 1];
+  fNoOfDataVectors = 0;
+  ExpandDataVectorsBuffers(nInitialDataVectorsSize);
+
+  fTree = new TTree(szCacheTreeName, "Qn correction framework input cache");
+  fTree->SetDirectory(fFile);
+  fTree->Branch("Variables", fVariables, Form("Variables[%d]/F", fVariableIds.GetSize()));
+  fTree->Branch("RunNumber", &fRunNumber, "RunNumber/I");
+  fTree->Branch("nDataVectors", &fNoOfDataVectors, "nDataVectors/I");
+  fTree->Branch("DetectorId", fDetectorId, "DetectorId[nDataVectors]/b");
+  fTree->Branch("ChannelId", fChannelId, "ChannelId[nDataVectors]/I");
+  fTree->Branch("Phi", fPhi, "Phi[nDataVectors]/F");
+  fTree->Branch("Weight", fWeight, "Weight[nDataVectors]/F");
+  fTree->Branch("ConfigurationsMask", fConfigurationsMask, "ConfigurationsMask[nDataVectors]/i");
+  fWriting = kTRUE;
+
+  AliInfo(Form("Writing Qn input cache into %s with %d event class variables", fileName, fVariableIds.GetSize()));
+  return kTRUE;
+}
+
+/// Opens an existing cache file for replaying it
+/// The stored variable ids should match the passed ones
+/// \param fileName the name of the cache file
+/// \param variableIds the ids of the variables bank entries expected per event
+/// \return kTRUE if everything went OK
+Bool_t AliQnCorrectionsInputCache::OpenForReading(const char *fileName, const TArrayI &variableIds) {
+  Close();
+
+  /* keep the current directory untouched */
+  TDirectory *savedDirectory = gDirectory;
+  fFile = TFile::Open(fileName, "READ");
+  savedDirectory->cd();
+  if (fFile == NULL || fFile->IsZombie()) {
+    AliError(Form("Not possible to open the Qn input cache file %s", fileName));
+    fFile = NULL;
+    return kFALSE;
+  }
+
+  TArrayI *storedIds = NULL;
+  fFile->GetObject(szVariableIdsKeyName, storedIds);
+  fTree = (TTree *) fFile->Get(szCacheTreeName);
+  if (storedIds == NULL || fTree == NULL) {
+    AliError(Form("The file %s does not contain a Qn input cache", fileName));
+    Close();
+    return kFALSE;
+  }
+
+  /* the event class variables should be the same ones */
+  Bool_t match = (storedIds->GetSize() == variableIds.GetSize());
+  for (Int_t i = 0; match && i < variableIds.GetSize(); i++) {
+    match = (storedIds->At(i) == variableIds.At(i));
+  }
+  delete storedIds;
+  if (!match) {
+    AliError(Form("The Qn input cache %s was written with a different set of event class variables", fileName));
+    Close();
+    return kFALSE;
+  }
+
+  fVariableIds = variableIds;
+  if (fVariables != NULL) delete [] fVariables;
+  fVariables = new Float_t[(fVariableIds.GetSize() > 0) ? fVariableIds.GetSize() : 1];
+  fNoOfDataVectors = 0;
+  ExpandDataVectorsBuffers(nInitialDataVectorsSize);
+  SetBranchAddresses();
+  fWriting = kFALSE;
+
+  AliInfo(Form("Reading Qn input cache from %s with %lld events", fileName, fTree->GetEntries()));
+  return kTRUE;
+}
+
+/// Closes the cache file
+/// If the cache was opened for writing the tree and the stored variable ids are written
+void AliQnCorrectionsInputCache::Close() {
+  if (fFile == NULL) return;
+
+  if (fWriting) {
+    TDirectory *savedDirectory = gDirectory;
+    fFile->cd();
+    fTree->Write();
+    fFile->WriteObject(&fVariableIds, szVariableIdsKeyName);
+    AliInfo(Form("Stored %lld events in Qn input cache %s", fTree->GetEntries(), fFile->GetName()));
+    savedDirectory->cd();
+  }
+  /* the tree is owned by the file */
+  fFile->Close();
+  delete fFile;
+  fFile = NULL;
+  fTree = NULL;
+  fWriting = kFALSE;
+}
+
+/// Stores a data vector for the current event
+/// \param detectorId id of the detector
+/// \param phi azimuthal angle
+/// \param weight the weight of the data vector
+/// \param channelId the channel Id that originates the data vector
+/// \param configurationsMask bit i set if the detector configuration i accepted the data vector
+void AliQnCorrectionsInputCache::AddDataVector(Int_t detectorId, Double_t phi, Double_t weight, Int_t channelId, UInt_t configurationsMask) {
+  if (fNoOfDataVectors == fDataVectorsSize) ExpandDataVectorsBuffers(fNoOfDataVectors + 1);
+
+  fDetectorId[fNoOfDataVectors] = detectorId;
+  fChannelId[fNoOfDataVectors] = channelId;
+  fPhi[fNoOfDataVectors] = phi;
+  fWeight[fNoOfDataVectors] = weight;
+  fConfigurationsMask[fNoOfDataVectors] = configurationsMask;
+  fNoOfDataVectors++;
+}
+
+/// Stores the current event and prepares for the next one
+/// \param variableContainer pointer to the variable content bank
+/// \param runNumber the run the event belongs to
+void AliQnCorrectionsInputCache::StoreEvent(const Float_t *variableContainer, Int_t runNumber) {
+  if (!fWriting) return;
+
+  fRunNumber = runNumber;
+  for (Int_t i = 0; i < fVariableIds.GetSize(); i++) {
+    fVariables[i] = variableContainer[fVariableIds.At(i)];
+  }
+  fTree->Fill();
+  fNoOfDataVectors = 0;
+}
+
+/// Gets the number of events in the cache
+/// \return the number of stored events
+Long64_t AliQnCorrectionsInputCache::GetNoOfEvents() const {
+  return (fTree != NULL) ? fTree->GetEntries() : 0;
+}
+
+/// Loads a stored event
+/// The stored variables are copied to their place in the variables bank
+/// \param entry the event number within the cache
+/// \param variableContainer pointer to the variable content bank
+/// \return kTRUE if the event was loaded
+Bool_t AliQnCorrectionsInputCache::LoadEvent(Long64_t entry, Float_t *variableContainer) {
+  if (fTree == NULL || fWriting) return kFALSE;
+
+  /* first the number of data vectors to make room for them */
+  fTree->GetBranch("nDataVectors")->GetEntry(entry);
+  ExpandDataVectorsBuffers(fNoOfDataVectors);
+  if (fTree->GetEntry(entry) <= 0) return kFALSE;
+
+  for (Int_t i = 0; i < fVariableIds.GetSize(); i++) {
+    variableContainer[fVariableIds.At(i)] = fVariables[i];
+  }
+  return kTRUE;
+}
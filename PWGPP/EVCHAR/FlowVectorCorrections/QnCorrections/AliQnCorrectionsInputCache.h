@@ -0,0 +1,121 @@
+#ifndef ALIQNCORRECTIONS_INPUTCACHE_H
+#define ALIQNCORRECTIONS_INPUTCACHE_H
+
+/***************************************************************************
+ * Package:       FlowVectorCorrections                                    *
+ * Authors:       Jaap Onderwaater, GSI, jacobus.onderwaater@cern.ch       *
+ *                Ilya Selyuzhenkov, GSI, ilya.selyuzhenkov@gmail.com      *
+ *                Víctor González, UCM, victor.gonzalez@cern.ch            *
+ *                Contributors are mentioned in the code where appropriate.*
+ * Development:   2012-2016                                                *
+ * See cxx source for GPL licence et. al.                                  *
+ ***************************************************************************/
+
+/// \file AliQnCorrectionsInputCache.h
+/// \brief Per event cache of the framework input data for replaying calibration passes
+///
+
+#include <TObject.h>
+#include <TArrayI.h>
+
+class TFile;
+class TTree;
+
+/// \class AliQnCorrectionsInputCache
+/// \brief Compact per event store of the data vectors accepted by the framework
+///
+/// Each stored event keeps the values of the variables which define
+/// the event classes and, for each accepted data vector, the detector id,
+/// the channel id, the azimuthal angle, the weight and the mask of the
+/// detector configurations that accepted it. As the acceptance is
+/// already stored, the detector configuration cuts need not to be
+/// evaluated again when the cache is replayed.
+///
+/// The cache is stored as a TTree within its own file. Together with
+/// the tree the ids of the stored variables are kept to check that the
+/// framework replaying the cache is configured in the same way.
+///
+/// \author Jaap Onderwaater <jacobus.onderwaater@cern.ch>, GSI
+/// \author Ilya Selyuzhenkov <ilya.selyuzhenkov@gmail.com>, GSI
+/// \author Víctor González <victor.gonzalez@cern.ch>, UCM
+class AliQnCorrectionsInputCache : public TObject {
+public:
+  AliQnCorrectionsInputCache();
+  virtual ~AliQnCorrectionsInputCache();
+
+  Bool_t OpenForWriting(const char *fileName, const TArrayI &variableIds);
+  Bool_t OpenForReading(const char *fileName, const TArrayI &variableIds);
+  void Close();
+
+  void AddDataVector(Int_t detectorId, Double_t phi, Double_t weight, Int_t channelId, UInt_t configurationsMask);
+  void StoreEvent(const Float_t *variableContainer, Int_t runNumber);
+  /// Discards the data vectors added for the current event
+  /// without storing it, i.e. when the event is rejected
+  void ClearEvent() { fNoOfDataVectors = 0; }
+
+  Long64_t GetNoOfEvents() const;
+  Bool_t LoadEvent(Long64_t entry, Float_t *variableContainer);
+
+  /// Gets the run number of the current event
+  /// \return the run number
+  Int_t GetRunNumber() const { return fRunNumber; }
+  /// Gets the number of data vectors of the current event
+  /// \return the number of data vectors
+  Int_t GetNoOfDataVectors() const { return fNoOfDataVectors; }
+  /// Gets the detector id of a data vector of the current event
+  /// \param i the data vector index
+  /// \return the detector id
+  Int_t GetDetectorId(Int_t i) const { return fDetectorId[i]; }
+  /// Gets the channel id of a data vector of the current event
+  /// \param i the data vector index
+  /// \return the channel id
+  Int_t GetChannelId(Int_t i) const { return fChannelId[i]; }
+  /// Gets the azimuthal angle of a data vector of the current event
+  /// \param i the data vector index
+  /// \return the azimuthal angle
+  Float_t GetPhi(Int_t i) const { return fPhi[i]; }
+  /// Gets the weight of a data vector of the current event
+  /// \param i the data vector index
+  /// \return the weight
+  Float_t GetWeight(Int_t i) const { return fWeight[i]; }
+  /// Gets the mask of detector configurations that accepted a data vector of the current event
+  /// \param i the data vector index
+  /// \return the detector configurations mask
+  UInt_t GetConfigurationsMask(Int_t i) const { return fConfigurationsMask[i]; }
+
+private:
+  static const char *szCacheTreeName;        ///< the name of the tree in the cache file
+  static const char *szVariableIdsKeyName;   ///< the name of the key under which the stored variable ids are kept
+  static const Int_t nInitialDataVectorsSize; ///< initial capacity for data vectors per event
+
+  void ExpandDataVectorsBuffers(Int_t size);
+  void SetBranchAddresses();
+
+  TFile *fFile;                   //!<! the cache file
+  TTree *fTree;                   //!<! the cache tree
+  Bool_t fWriting;                //!<! kTRUE if the cache has been opened for writing
+  TArrayI fVariableIds;           //!<! ids of the stored variables
+  Float_t *fVariables;            //!<! [fVariableIds.GetSize()] values of the stored variables for the current event
+  Int_t fRunNumber;               //!<! run number of the current event
+  Int_t fNoOfDataVectors;         //!<! number of data vectors for the current event
+  Int_t fDataVectorsSize;         //!<! capacity of the data vectors buffers
+  UChar_t *fDetectorId;           //!<! [fNoOfDataVectors] detector id of the data vectors
+  Int_t *fChannelId;              //!<! [fNoOfDataVectors] channel id of the data vectors
+  Float_t *fPhi;                  //!<! [fNoOfDataVectors] azimuthal angle of the data vectors
+  Float_t *fWeight;               //!<! [fNoOfDataVectors] weight of the data vectors
+  UInt_t *fConfigurationsMask;    //!<! [fNoOfDataVectors] detector configurations that accepted the data vectors
+
+private:
+  /// Copy constructor
+  /// Not allowed. Forced private.
+  AliQnCorrectionsInputCache(const AliQnCorrectionsInputCache &);
+  /// Assignment operator
+  /// Not allowed. Forced private.
+  AliQnCorrectionsInputCache& operator= (const AliQnCorrectionsInputCache &);
+
+/// \cond CLASSIMP
+  ClassDef(AliQnCorrectionsInputCache, 2);
+/// \endcond
+};
+
+#endif // ALIQNCORRECTIONS_INPUTCACHE_H
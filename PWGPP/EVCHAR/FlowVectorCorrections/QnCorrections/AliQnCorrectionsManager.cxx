@@ -76,6 +76,10 @@ AliQnCorrectionsManager::AliQnCorrectionsManager() :
   fFillNveQAHistograms = kFALSE;
   fFillQnVectorTree = kFALSE;
   fProcessesNames = NULL;
+  fInputCacheFileName = "";
+  fInputCache = NULL;
+  fReplayCache = NULL;
+  fCurrentRunNumber = -1;
 }
 
 /// Default destructor
@@ -86,6 +90,8 @@ AliQnCorrectionsManager::~AliQnCorrectionsManager() {
   if (fDataContainer != NULL) delete [] fDataContainer;
   if (fCalibrationHistogramsList != NULL) delete fCalibrationHistogramsList;
   if (fProcessesNames != NULL) delete fProcessesNames;
+  if (fInputCache != NULL) delete fInputCache;
+  if (fReplayCache != NULL) delete fReplayCache;
 }
 
 /// Sets the base list that will own the input calibration histograms
@@ -359,6 +365,99 @@ void AliQnCorrectionsManager::InitializeQnCorrectionsFramework() {
   for (Int_t ixDetector = 0; ixDetector < fDetectorsSet.GetEntries(); ixDetector++) {
     ((AliQnCorrectionsDetector *) fDetectorsSet.At(ixDetector))->IncludeQnVectors(fQnVectorList);
   }
+
+  /* and finally the input cache if requested */
+  if (fInputCacheFileName.Length() != 0) {
+    for (Int_t ixDetector = 0; ixDetector < fDetectorsSet.GetEntries(); ixDetector++) {
+      detector = (AliQnCorrectionsDetector *) fDetectorsSet.At(ixDetector);
+      if (detector->GetNoOfDetectorConfigurations() > 32) {
+        AliFatal(Form("Detector %s has %d configurations while the input cache supports up to 32. FIX IT, PLEASE.",
+            detector->GetName(), detector->GetNoOfDetectorConfigurations()));
+      }
+    }
+    TArrayI ids;
+    FillEventClassVariablesIds(ids);
+    fInputCache = new AliQnCorrectionsInputCache();
+    if (!fInputCache->OpenForWriting(fInputCacheFileName, ids)) {
+      AliFatal(Form("Not possible to create the input cache file %s", fInputCacheFileName.Data()));
+    }
+  }
+}
+
+/// Builds the list of ids of the variables that define the event
+/// classes of the whole set of detector configurations
+/// \param ids the array of variable ids
+void AliQnCorrectionsManager::FillEventClassVariablesIds(TArrayI &ids) const {
+  ids.Set(0);
+  for (Int_t ixDetector = 0; ixDetector < fDetectorsSet.GetEntries(); ixDetector++) {
+    ((AliQnCorrectionsDetector *) fDetectorsSet.At(ixDetector))->FillEventClassVariablesIds(ids);
+  }
+}
+
+/// Opens an input cache stored in a previous pass for replaying it
+///
+/// The framework should be already initialized with the same detector
+/// configurations used when the cache was written and the calibration
+/// histograms of the intended pass. The stored events are then loaded
+/// with LoadInputCacheEvent() and processed with ProcessEvent() and
+/// ClearEvent() as if they were coming from the analysis chain.
+/// \param fileName the name of the input cache file
+/// \return kTRUE if the cache is ready to be replayed
+Bool_t AliQnCorrectionsManager::OpenInputCacheForReplay(const char *fileName) {
+  if (fDataContainer == NULL) {
+    AliFatal("The framework should be initialized before replaying an input cache. FIX IT, PLEASE.");
+    return kFALSE;
+  }
+  if (fInputCache != NULL) {
+    AliError("An input cache is being written. It is not possible to replay another one at the same time.");
+    return kFALSE;
+  }
+
+  TArrayI ids;
+  FillEventClassVariablesIds(ids);
+
+  CloseInputCacheReplay();
+  fReplayCache = new AliQnCorrectionsInputCache();
+  if (!fReplayCache->OpenForReading(fileName, ids)) {
+    CloseInputCacheReplay();
+    return kFALSE;
+  }
+  return kTRUE;
+}
+
+/// Gets the number of events in the input cache being replayed
+/// \return the number of events
+Long64_t AliQnCorrectionsManager::GetNoOfInputCacheEvents() const {
+  return (fReplayCache != NULL) ? fReplayCache->GetNoOfEvents() : 0;
+}
+
+/// Loads an event of the input cache being replayed
+///
+/// The stored variables are placed in the variables bank and the data
+/// vectors are passed to the detector configurations that accepted them.
+/// The event is then ready for ProcessEvent().
+/// \param entry the event number within the cache
+/// \return the run number of the event, -1 if the event could not be loaded
+Int_t AliQnCorrectionsManager::LoadInputCacheEvent(Long64_t entry) {
+  if (fReplayCache == NULL || !fReplayCache->LoadEvent(entry, fDataContainer)) return -1;
+
+  for (Int_t ixDataVector = 0; ixDataVector < fReplayCache->GetNoOfDataVectors(); ixDataVector++) {
+    fDetectorsIdMap[fReplayCache->GetDetectorId(ixDataVector)]->AddAcceptedDataVector(
+        fReplayCache->GetConfigurationsMask(ixDataVector),
+        fReplayCache->GetPhi(ixDataVector),
+        fReplayCache->GetWeight(ixDataVector),
+        fReplayCache->GetChannelId(ixDataVector));
+  }
+  return fReplayCache->GetRunNumber();
+}
+
+/// Closes the input cache being replayed
+void AliQnCorrectionsManager::CloseInputCacheReplay() {
+  if (fReplayCache != NULL) {
+    fReplayCache->Close();
+    delete fReplayCache;
+    fReplayCache = NULL;
+  }
 }
 
 /// Set the name of the list that should be considered as assigned to the current process
@@ -746,6 +845,13 @@ void AliQnCorrectionsManager::PrintFrameworkConfiguration() const {
 /// Produce the all data lists that collect data from all concurrent processes.
 void AliQnCorrectionsManager::FinalizeQnCorrectionsFramework() {
 
+  /* close the input cache if it was being written */
+  if (fInputCache != NULL) {
+    fInputCache->Close();
+    delete fInputCache;
+    fInputCache = NULL;
+  }
+
   TList *processList = (TList *) fSupportHistogramsList->FindObject((const char *)fProcessListName);
   fSupportHistogramsList->Add(processList->Clone(szAllProcessesListName));
 }
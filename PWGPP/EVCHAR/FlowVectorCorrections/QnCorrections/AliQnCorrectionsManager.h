@@ -47,6 +47,16 @@
 /// different running instances. At merging time, only the contributions
 /// from instances of the same process must be merged.
 ///
+/// As the calibration needs several passes over the same data, the
+/// manager is able to store, on a first pass, the accepted data vectors
+/// and the event class variables in an input cache file (see
+/// AliQnCorrectionsInputCache). Further calibration passes can then
+/// replay that cache event by event (OpenInputCacheForReplay(),
+/// LoadInputCacheEvent()) instead of running the whole analysis chain
+/// again, as AliAnalysisTaskFlowVectorCorrections::ReplayInputCache()
+/// does. The detector configurations must be the same in the writing
+/// and the replaying passes.
+///
 /// \author Jaap Onderwaater <jacobus.onderwaater@cern.ch>, GSI
 /// \author Ilya Selyuzhenkov <ilya.selyuzhenkov@gmail.com>, GSI
 /// \author Víctor González <victor.gonzalez@cern.ch>, UCM
@@ -57,6 +67,7 @@
 #include <TList.h>
 #include <TTree.h>
 #include "AliQnCorrectionsDetector.h"
+#include "AliQnCorrectionsInputCache.h"
 
 class AliQnCorrectionsManager : public TObject {
 public:
@@ -80,6 +91,14 @@ public:
   /// Enables disables the output of Qn vector on a TTree structure
   /// \param enable kTRUE for enabling Qn vector output into a TTree
   void SetShouldFillQnVectorTree(Bool_t enable = kTRUE) { fFillQnVectorTree = enable; }
+  /// Enables the storage of the accepted data vectors and event class variables
+  /// into an input cache file for later replay. The file should be kept as
+  /// output of the job.
+  /// \param fileName the name of the input cache file (empty for disabling it)
+  void SetInputCacheFileName(const char *fileName) { fInputCacheFileName = fileName; }
+  /// Sets the run number of the incoming events, stored with them in the input cache
+  /// \param runNumber the current run number
+  void SetCurrentRunNumber(Int_t runNumber) { fCurrentRunNumber = runNumber; }
 
   void AddDetector(AliQnCorrectionsDetector *detector);
 
@@ -142,6 +161,10 @@ public:
   void ProcessEvent();
   void ClearEvent();
   void FinalizeQnCorrectionsFramework();
+  Bool_t OpenInputCacheForReplay(const char *fileName);
+  Long64_t GetNoOfInputCacheEvents() const;
+  Int_t LoadInputCacheEvent(Long64_t entry);
+  void CloseInputCacheReplay();
 
 private:
   static const Int_t nMaxNoOfDetectors;              ///< the highest detector id currently supported by the framework
@@ -166,6 +189,12 @@ private:
   Bool_t fFillQnVectorTree;             ///< kTRUE if Qn vectors must be written in a TTree structure
   TString fProcessListName;             ///< the name of the list associated to the current process
   TObjArray *fProcessesNames;           ///< array with the list of processes names
+  TString fInputCacheFileName;          ///< the name of the input cache file to write (empty if not requested)
+  AliQnCorrectionsInputCache *fInputCache; //!<! the input cache being written
+  AliQnCorrectionsInputCache *fReplayCache; //!<! the input cache being replayed
+  Int_t fCurrentRunNumber;              //!<! the run number of the incoming events
+
+  void FillEventClassVariablesIds(TArrayI &ids) const;
 
 private:
   /// Copy constructor
@@ -176,7 +205,7 @@ private:
   AliQnCorrectionsManager& operator= (const AliQnCorrectionsManager &);
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsManager, 5);
+  ClassDef(AliQnCorrectionsManager, 6);
 /// \endcond
 };
 
@@ -189,7 +218,12 @@ private:
 /// \param channelId the channel Id that originates the data vector
 /// \return the number of detector configurations that accepted and stored the data vector
 inline Int_t AliQnCorrectionsManager::AddDataVector(Int_t detectorId, Double_t phi, Double_t weight, Int_t channelId) {
-  return fDetectorsIdMap[detectorId]->AddDataVector(fDataContainer, phi, weight, channelId);
+  Int_t nAccepted = fDetectorsIdMap[detectorId]->AddDataVector(fDataContainer, phi, weight, channelId);
+  if (fInputCache != NULL && nAccepted > 0) {
+    fInputCache->AddDataVector(detectorId, phi, weight, channelId,
+        fDetectorsIdMap[detectorId]->GetAcceptedDataDetectorConfigurationsMask());
+  }
+  return nAccepted;
 }
 
 /// Gets the name of the detector configuration at index that accepted last data vector
@@ -208,6 +242,9 @@ inline const char *AliQnCorrectionsManager::GetAcceptedDataDetectorConfiguration
 /// Must be called only when the whole data vectors for the event
 /// have been incorporated to the framework.
 inline void AliQnCorrectionsManager::ProcessEvent() {
+  if (fInputCache != NULL) {
+    fInputCache->StoreEvent(fDataContainer, fCurrentRunNumber);
+  }
   for (Int_t ixDetector = 0; ixDetector < fDetectorsSet.GetEntries(); ixDetector++) {
     ((AliQnCorrectionsDetector *) fDetectorsSet.At(ixDetector))->ProcessCorrections(fDataContainer);
   }
@@ -221,7 +258,12 @@ inline void AliQnCorrectionsManager::ProcessEvent() {
 /// The request is transmitted to the different detectors.
 ///
 /// Must be called only at the end of each event to start processing the next one
+/// The data vectors of a rejected event, not processed, are also discarded
+/// from the input cache being written
 inline void AliQnCorrectionsManager::ClearEvent() {
+  if (fInputCache != NULL) {
+    fInputCache->ClearEvent();
+  }
   for (Int_t ixDetector = 0; ixDetector < fDetectorsSet.GetEntries(); ixDetector++) {
     ((AliQnCorrectionsDetector *) fDetectorsSet.At(ixDetector))->ClearDetector();
   }
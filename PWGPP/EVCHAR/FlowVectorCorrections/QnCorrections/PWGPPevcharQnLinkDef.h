@@ -36,6 +36,7 @@
 #pragma link C++ class AliQnCorrectionsHistogramChannelized+;
 #pragma link C++ class AliQnCorrectionsHistogramChannelizedSparse+;
 #pragma link C++ class AliQnCorrectionsHistogramSparse+;
+#pragma link C++ class AliQnCorrectionsInputCache+;
 #pragma link C++ class AliQnCorrectionsInputGainEqualization+;
 #pragma link C++ class AliQnCorrectionsManager+;
 #pragma link C++ class AliQnCorrectionsProfile+;
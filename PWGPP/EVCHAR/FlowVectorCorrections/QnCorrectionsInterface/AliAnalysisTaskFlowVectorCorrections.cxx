@@ -169,13 +169,12 @@ void AliAnalysisTaskFlowVectorCorrections::SetCalibrationHistogramsFile(Calibrat
 }
 
 //_________________________________________________________________________________
-void AliAnalysisTaskFlowVectorCorrections::UserCreateOutputObjects()
+void AliAnalysisTaskFlowVectorCorrections::InitializeFramework()
 {
   //
-  // Add all histogram manager histogram lists to the output TList
+  // Configure the detectors, load the calibration histograms if already
+  // possible and initialize the correction framework
   //
-  AliInfo("");
-
   this->SetDefaultVarNames();
   this->SetDetectors();
 
@@ -223,6 +222,17 @@ void AliAnalysisTaskFlowVectorCorrections::UserCreateOutputObjects()
   }
 
   fAliQnCorrectionsManager->InitializeQnCorrectionsFramework();
+}
+
+//_________________________________________________________________________________
+void AliAnalysisTaskFlowVectorCorrections::UserCreateOutputObjects()
+{
+  //
+  // Add all histogram manager histogram lists to the output TList
+  //
+  AliInfo("");
+
+  InitializeFramework();
 
   if (fAliQnCorrectionsManager->GetShouldFillOutputHistograms())
     PostData(fOutputSlotHistQn, fAliQnCorrectionsManager->GetOutputHistogramsList());
@@ -243,6 +253,8 @@ void AliAnalysisTaskFlowVectorCorrections::NotifyRun() {
 
   AliInfo(TString::Format("New run number: %d", this->fCurrentRunNumber).Data());
 
+  fAliQnCorrectionsManager->SetCurrentRunNumber(this->fCurrentRunNumber);
+
   TFile *calibfile = NULL;
 
   switch (fCalibrationFileSource) {
@@ -319,6 +331,49 @@ void AliAnalysisTaskFlowVectorCorrections::UserExec(Option_t *){
 }  // end loop over events
 
 
+//_________________________________________________________________________________
+Long64_t AliAnalysisTaskFlowVectorCorrections::ReplayInputCache(const char *fileName)
+{
+  //
+  // Run a calibration pass over an input cache written by a previous pass
+  // (see AliQnCorrectionsManager::SetInputCacheFileName) instead of over
+  // the events: the task is configured as for an analysis train but it is
+  // not attached to an analysis manager. The framework is initialized,
+  // the per run calibration is loaded when the run of the stored events
+  // changes and every stored event is processed. The output lists are
+  // afterwards taken from the framework manager. The event QA histograms
+  // are not filled as only the accepted events and their event class
+  // variables are in the cache.
+  //
+  InitializeFramework();
+
+  if (!fAliQnCorrectionsManager->OpenInputCacheForReplay(fileName)) {
+    AliError(Form("Not possible to replay the Qn input cache %s", fileName));
+    return 0;
+  }
+
+  Long64_t nEvents = fAliQnCorrectionsManager->GetNoOfInputCacheEvents();
+  Long64_t nReplayed = 0;
+  for (Long64_t entry = 0; entry < nEvents; entry++) {
+    fAliQnCorrectionsManager->ClearEvent();
+    Int_t runNumber = fAliQnCorrectionsManager->LoadInputCacheEvent(entry);
+    if (runNumber < 0) continue;
+    if (runNumber != this->fCurrentRunNumber) {
+      this->fCurrentRunNumber = runNumber;
+      NotifyRun();
+    }
+    fAliQnCorrectionsManager->ProcessEvent();
+    nReplayed++;
+  }
+  fAliQnCorrectionsManager->ClearEvent();
+  fAliQnCorrectionsManager->CloseInputCacheReplay();
+  fAliQnCorrectionsManager->FinalizeQnCorrectionsFramework();
+
+  AliInfo(Form("Replayed %lld events from Qn input cache %s", nReplayed, fileName));
+  return nReplayed;
+}
+
+//________________________________________________________________________
 void AliAnalysisTaskFlowVectorCorrections::FinishTaskOutput()
 {
   //
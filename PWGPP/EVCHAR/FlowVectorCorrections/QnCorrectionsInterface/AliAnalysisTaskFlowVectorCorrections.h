@@ -58,6 +58,8 @@ public:
   void SetCalibrationHistogramsFile(CalibrationFileSource source, const char *filename);
   void DefineInOutput();
   void SetRunsLabels(TObjArray *runsList) { fAliQnCorrectionsManager->SetListOfProcessesNames(runsList); }
+  void SetInputCacheFileName(const char *fileName) { fAliQnCorrectionsManager->SetInputCacheFileName(fileName); }
+  Long64_t ReplayInputCache(const char *fileName);
 
   AliQnCorrectionsManager *GetAliQnCorrectionsManager() {return fAliQnCorrectionsManager;}
   AliQnCorrectionsHistos* GetEventHistograms() {return fEventHistos;}
@@ -90,6 +92,8 @@ private:
   Int_t fOutputSlotQnVectorsList;
   Int_t fOutputSlotTree;
 
+  void InitializeFramework();
+
   AliAnalysisTaskFlowVectorCorrections(const AliAnalysisTaskFlowVectorCorrections &c);
   AliAnalysisTaskFlowVectorCorrections& operator= (const AliAnalysisTaskFlowVectorCorrections &c);
 
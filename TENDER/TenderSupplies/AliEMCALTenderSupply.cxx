@@ -32,6 +32,7 @@
 #include "AliEMCALClusterizerv2.h"
 #include "AliEMCALDigit.h"
 #include "AliEMCALGeometry.h"
+#include "AliEMCALOADBCache.h"
 #include "AliEMCALRecParam.h"
 #include "AliEMCALRecParam.h"
 #include "AliEMCALRecPoint.h"
@@ -86,6 +87,7 @@ AliEMCALTenderSupply::AliEMCALTenderSupply() :
   ,fPhicut(-1)
   ,fBasePath("")
   ,fCustomBC("")
+  ,fOADBCache(0)
   ,fReClusterize(kFALSE)
   ,fClusterizer(0)
   ,fGeomMatrixSet(kFALSE)
@@ -157,6 +159,7 @@ AliEMCALTenderSupply::AliEMCALTenderSupply(const char *name, const AliTender *te
   ,fPhicut(-1)  
   ,fBasePath("")
   ,fCustomBC("")
+  ,fOADBCache(0)
   ,fReClusterize(kFALSE)
   ,fClusterizer(0)
   ,fGeomMatrixSet(kFALSE)
@@ -228,6 +231,7 @@ AliEMCALTenderSupply::AliEMCALTenderSupply(const char *name, AliAnalysisTaskSE *
   ,fPhicut(-1)  
   ,fBasePath("")
   ,fCustomBC("")
+  ,fOADBCache(0)
   ,fReClusterize(kFALSE)
   ,fClusterizer(0)
   ,fGeomMatrixSet(kFALSE)
@@ -263,6 +267,8 @@ AliEMCALTenderSupply::~AliEMCALTenderSupply()
 {
   //Destructor
 
+  if (fOADBCache) AliEMCALOADBCache::Release();
+
   if (!AliAnalysisManager::GetAnalysisManager())  return;  
 
   if (!AliAnalysisManager::GetAnalysisManager()->IsProofMode()) 
@@ -304,6 +310,16 @@ Bool_t AliEMCALTenderSupply::RunChanged() const
   return (fTender && fTender->RunChanged()) || (fTask && fRun != fTask->InputEvent()->GetRunNumber()); 
 }
 
+//_____________________________________________________
+AliEMCALOADBCache *AliEMCALTenderSupply::GetOADBCache()
+{
+  // Get the OADB containers shared with the other EMCal tasks.
+
+  if (!fOADBCache) fOADBCache = AliEMCALOADBCache::Acquire();
+  
+  return fOADBCache;
+}
+
 //_____________________________________________________
 void AliEMCALTenderSupply::Init()
 {
@@ -917,38 +933,33 @@ Bool_t AliEMCALTenderSupply::InitMisalignMatrix()
 
   if (fMisalignSurvey == kdefault)
   { //take default alignment corresponding to run no
-    AliOADBContainer emcalgeoCont(Form("emcal"));
-    emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-    mobj=(TObjArray*)emcalgeoCont.GetObject(runGM,"EmcalMatrices");
+    AliOADBContainer *emcalgeoCont = GetOADBCache()->GetContainer(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),"AliEMCALgeo");
+    if (emcalgeoCont) mobj=(TObjArray*)emcalgeoCont->GetObject(runGM,"EmcalMatrices");
   }
   
   if (fMisalignSurvey == kSurveybyS)
   { //take alignment at sector level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      AliOADBContainer *emcalgeoCont = GetOADBCache()->GetContainer(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),"AliEMCALgeo");
+      if (emcalgeoCont) mobj=(TObjArray*)emcalgeoCont->GetObject(100,"survey10");
     }
     else if (runGM>140000)
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byS");
+      AliOADBContainer *emcalgeoCont = GetOADBCache()->GetContainer(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),"AliEMCALgeo");
+      if (emcalgeoCont) mobj=(TObjArray*)emcalgeoCont->GetObject(100,"survey11byS");
     }
   }
 
   if (fMisalignSurvey == kSurveybyM)
   { //take alignment at module level
     if (runGM <= 140000) { //2010 data
-      AliOADBContainer emcalgeoCont(Form("emcal2010"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey10");
+      AliOADBContainer *emcalgeoCont = GetOADBCache()->GetContainer(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),"AliEMCALgeo");
+      if (emcalgeoCont) mobj=(TObjArray*)emcalgeoCont->GetObject(100,"survey10");
     }
     else if (runGM>140000)
     { // 2011 LHC11a pass1 data
-      AliOADBContainer emcalgeoCont(Form("emcal2011"));
-      emcalgeoCont.InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),Form("AliEMCALgeo"));
-      mobj=(TObjArray*)emcalgeoCont.GetObject(100,"survey11byM");
+      AliOADBContainer *emcalgeoCont = GetOADBCache()->GetContainer(AliDataFile::GetFileNameOADB("EMCAL/EMCALlocal2master.root").data(),"AliEMCALgeo");
+      if (emcalgeoCont) mobj=(TObjArray*)emcalgeoCont->GetObject(100,"survey11byM");
     }
   }
 
@@ -996,58 +1007,37 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
   
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
     
-    TFile *fbad=new TFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("EMCALBadChannels.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }  
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"AliEMCALBadChannels");
+    fileBC = Form("%s/EMCALBadChannels.root",fBasePath.Data());
   }
   else if (fCustomBC!="")
   { //if fCustomBC specified in the ->SetCustomBC()
     if (fDebugLevel>0) AliInfo(Form("Loading Bad Channels OADB from given path %s",fCustomBC.Data()));
     
-    TFile *fbad=new TFile(Form("%s",fCustomBC.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("Input file was not found in the path provided: %s",fCustomBC.Data()));
-      return 0;
-    }
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s",fCustomBC.Data()),"AliEMCALBadChannels");
+    fileBC = fCustomBC;
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     if (fDebugLevel>0) AliInfo("Loading Bad Channels OADB from /OADB/EMCAL");
     
-    TFile *fbad=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALBadChannels.root was not found");
-      return 0;
-    }
-      
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data(),"AliEMCALBadChannels");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALBadChannels");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external hot channel set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
 
@@ -1064,12 +1054,11 @@ Int_t AliEMCALTenderSupply::InitBadChannels()
       AliError(Form("Can not get EMCALBadChannelMap_Mod%d",i));
       continue;
     }
+    h=(TH2I*)h->Clone();
     h->SetDirectory(0);
     fEMCALRecoUtils->SetEMCALChannelStatusMap(i,h);
   }
   
-  delete contBC;
-  
   return 1;
 }
 
@@ -1092,43 +1081,31 @@ Int_t AliEMCALTenderSupply::InitRecalib()
 
   Int_t runRC = event->GetRunNumber();
       
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  TString fileRF;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
-    if (fDebugLevel>0)  AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
-    
-    TFile *fRecalib= new TFile(Form("%s/EMCALRecalib.root",fBasePath.Data()),"read");
-    if (!fRecalib || fRecalib->IsZombie())
-    {
-      AliFatal(Form("EMCALRecalib.root not found in %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fRecalib) delete fRecalib;
+    if (fDebugLevel>0) AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
     
-    contRF->InitFromFile(Form("%s/EMCALRecalib.root",fBasePath.Data()),"AliEMCALRecalib");
+    fileRF = Form("%s/EMCALRecalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
-    if (fDebugLevel>0)  AliInfo("Loading Recalib OADB from OADB/EMCAL");
+    if (fDebugLevel>0) AliInfo("Loading Recalib OADB from OADB/EMCAL");
     
-    TFile *fRecalib= new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"read");
-    if (!fRecalib || fRecalib->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALRecalib.root was not found");
-      return 0;
-    }
-    
-    if (fRecalib) delete fRecalib;
-      
-    contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data(),"AliEMCALRecalib");
+    fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALRecalib.root").data();
+  }
+  
+  AliOADBContainer *contRF = GetOADBCache()->GetContainer(fileRF,"AliEMCALRecalib");
+  if (!contRF)
+  {
+    AliFatal(Form("%s was not found",fileRF.Data()));
+    return 0;
   }
 
   TObjArray *recal=(TObjArray*)contRF->GetObject(runRC);
   if (!recal)
   {
     AliError(Form("No Objects for run: %d",runRC));
-    delete contRF;
     return 2;
   } 
 
@@ -1136,7 +1113,6 @@ Int_t AliEMCALTenderSupply::InitRecalib()
   if (!recalpass)
   {
     AliError(Form("No Objects for run: %d - %s",runRC,fFilepass.Data()));
-    delete contRF;
     return 2;
   }
 
@@ -1144,7 +1120,6 @@ Int_t AliEMCALTenderSupply::InitRecalib()
   if (!recalib)
   {
     AliError(Form("No Recalib histos found for  %d - %s",runRC,fFilepass.Data())); 
-    delete contRF;
     return 2;
   }
 
@@ -1162,12 +1137,11 @@ Int_t AliEMCALTenderSupply::InitRecalib()
       AliError(Form("Could not load EMCALRecalFactors_SM%d",i));
       continue;
     }
+    h=(TH2F*)h->Clone();
     h->SetDirectory(0);
     fEMCALRecoUtils->SetEMCALChannelRecalibrationFactors(i,h);
   }
   
-  delete contRF;
-  
   return 1;
 }
 
@@ -1205,78 +1179,45 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
   
   Int_t runRC = event->GetRunNumber();
   
-  AliOADBContainer *contRF=new AliOADBContainer("");
+  TString fileRF;
   if (fBasePath!="") 
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0)  AliInfo(Form("Loading Recalib OADB from given path %s",fBasePath.Data()));
     
-    TFile *fRunDepRecalib= new TFile(Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data()),"read");
-    if (!fRunDepRecalib || fRunDepRecalib->IsZombie()) 
-    {
-      AliFatal(Form("EMCALTemperatureCorrCalib.root not found in %s",fBasePath.Data()));
-      return 0;
-    }
-    
-    if (fRunDepRecalib) delete fRunDepRecalib;
-    
-    contRF->InitFromFile(Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data()),"AliEMCALRunDepTempCalibCorrections");
+    fileRF = Form("%s/EMCALTemperatureCorrCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     if (fDebugLevel>0)  AliInfo("Loading Recalib OADB from OADB/EMCAL");
     
-    TFile *fRunDepRecalib= new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"read");
-    if (!fRunDepRecalib || fRunDepRecalib->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTemperatureCorrCalib.root was not found");
-      return 0;
-    }
-    
-    if (fRunDepRecalib) delete fRunDepRecalib;
-    
-    contRF->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data(),"AliEMCALRunDepTempCalibCorrections");
+    fileRF = AliDataFile::GetFileNameOADB("EMCAL/EMCALTemperatureCorrCalib.root").data();
   }
   
-  TH1S *rundeprecal=(TH1S*)contRF->GetObject(runRC);
-    
+  if (!GetOADBCache()->GetContainer(fileRF,"AliEMCALRunDepTempCalibCorrections"))
+  {
+    AliFatal(Form("%s was not found",fileRF.Data()));
+    return 0;
+  }
+  
+  // Correction factors per cell, from the run or the closest one
+  Int_t nbins = 0;
+  const Double_t *rundeprecal = GetOADBCache()->GetTemperatureCorrections(fileRF,runRC,nbins);
   if (!rundeprecal)
   {
-    AliWarning(Form("No TemperatureCorrCalib Objects for run: %d",runRC));
-    // let's get the closest runnumber instead then..
-    Int_t lower = 0;
-    Int_t ic = 0;
-    Int_t maxEntry = contRF->GetNumberOfEntries();
-
-    while ((ic < maxEntry) && (contRF->UpperLimit(ic) < runRC)) {
-      lower = ic;
-      ic++; 
-    }
-
-    Int_t closest = lower;
-    if ((ic<maxEntry) && 
-	 (contRF->LowerLimit(ic)-runRC) < (runRC - contRF->UpperLimit(lower))) {
-	 closest = ic;
-    }
-
-    AliWarning(Form("TemperatureCorrCalib Objects found closest id %d from run: %d", closest, contRF->LowerLimit(closest)));
-    rundeprecal = (TH1S*) contRF->GetObjectByIndex(closest);  
-  } 
+    AliError(Form("No TemperatureCorrCalib Objects for run: %d",runRC));
+    return 2;
+  }
   
   Int_t nSM = fEMCALGeo->GetEMCGeometry()->GetNumberOfSuperModules();
-  Int_t nbins = rundeprecal->GetNbinsX();
   
   // Avoid use of Run1 param for Run2
   if(nSM > 12 && nbins < 12288)
   {
     AliError(Form("Total SM is %d but T corrections available for %d channels, skip Init of T recalibration factors",nSM,nbins));
     
-    delete contRF;
-    
     return 2;
   }
   
-  if (fDebugLevel>0) rundeprecal->Print();
-
   for (Int_t ism=0; ism<nSM; ++ism) 
   {        
     for (Int_t icol=0; icol<48; ++icol) 
@@ -1286,15 +1227,13 @@ Int_t AliEMCALTenderSupply::InitRunDepRecalib()
         Float_t factor = fEMCALRecoUtils->GetEMCALChannelRecalibrationFactor(ism,icol,irow);
         
         Int_t absID = fEMCALGeo->GetAbsCellIdFromCellIndexes(ism, irow, icol); // original calibration factor
-        factor *= rundeprecal->GetBinContent(absID) / 10000. ; // correction dependent on T
+        factor *= rundeprecal[absID] ; // correction dependent on T
 
         fEMCALRecoUtils->SetEMCALChannelRecalibrationFactor(ism,icol,irow,factor);
       } // columns
     } // rows 
   } // SM loop
   
-  delete contRF;
-  
   return 1;
 }
 
@@ -1317,43 +1256,31 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
 
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     if (fDebugLevel>0) AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
     
-    TFile *fbad=new TFile(Form("%s/EMCALTimeCalib.root",fBasePath.Data()),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal(Form("EMCALTimeCalib.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }  
-    
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(Form("%s/EMCALTimeCalib.root",fBasePath.Data()),"AliEMCALTimeCalib");    
-  } 
-  else 
+    fileBC = Form("%s/EMCALTimeCalib.root",fBasePath.Data());
+  }
+  else
   { // Else choose the one in the $ALICE_PHYSICS directory
     if (fDebugLevel>0) AliInfo("Loading time calibration OADB from OADB/EMCAL");
     
-    TFile *fbad=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"read");
-    if (!fbad || fbad->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTimeCalib.root was not found");
-      return 0;
-    }  
-      
-    if (fbad) delete fbad;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data(),"AliEMCALTimeCalib");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeCalib.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALTimeCalib");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2; 
   }
   
@@ -1364,7 +1291,6 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
   if (!arrayBCpass)
   {
     AliError(Form("No external time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
     return 2; 
   }
 
@@ -1383,12 +1309,11 @@ Int_t AliEMCALTenderSupply::InitTimeCalibration()
       AliError(Form("Can not get hAllTimeAvBC%d",i));
       continue;
     }
+    h=(TH1F*)h->Clone();
     h->SetDirectory(0);
     fEMCALRecoUtils->SetEMCALChannelTimeRecalibrationFactors(i,h);
   }
   
-  delete contBC;
-  
   return 1;  
 }
 
@@ -1410,43 +1335,31 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
 
   Int_t runBC = event->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  TString fileBC;
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
-    if (fDebugLevel>0) AliInfo(Form("Loading time calibration OADB from given path %s",fBasePath.Data()));
-    
-    TFile *timeFile=new TFile(Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data()),"read");
-    if (!timeFile || timeFile->IsZombie())
-    {
-      AliFatal(Form("EMCALTimeL1PhaseCalib.root was not found in the path provided: %s",fBasePath.Data()));
-      return 0;
-    }  
-    
-    if (timeFile) delete timeFile;
+    if (fDebugLevel>0) AliInfo(Form("Loading L1 phase in time calibration OADB from given path %s",fBasePath.Data()));
     
-    contBC->InitFromFile(Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data()),"AliEMCALTimeL1PhaseCalib");
+    fileBC = Form("%s/EMCALTimeL1PhaseCalib.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
     if (fDebugLevel>0) AliInfo("Loading L1 phase in time calibration OADB from OADB/EMCAL");
     
-    TFile *timeFile=new TFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"read");
-    if (!timeFile || timeFile->IsZombie())
-    {
-      AliFatal("OADB/EMCAL/EMCALTimeL1PhaseCalib.root was not found");
-      return 0;
-    }
-      
-    if (timeFile) delete timeFile;
-    
-    contBC->InitFromFile(AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data(),"AliEMCALTimeL1PhaseCalib");
+    fileBC = AliDataFile::GetFileNameOADB("EMCAL/EMCALTimeL1PhaseCalib.root").data();
+  }
+  
+  AliOADBContainer *contBC = GetOADBCache()->GetContainer(fileBC,"AliEMCALTimeL1PhaseCalib");
+  if (!contBC)
+  {
+    AliFatal(Form("%s was not found",fileBC.Data()));
+    return 0;
   }
   
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external L1 phase in time calibration set for run number: %d", runBC));
-    delete contBC;
     return 2; 
   }
   
@@ -1460,7 +1373,6 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
   if (!arrayBCpass)
   {
     AliError(Form("No external L1 phase in time calibration set for: %d -%s", runBC,pass.Data()));
-    delete contBC;
     return 2; 
   }
 
@@ -1475,11 +1387,10 @@ Int_t AliEMCALTenderSupply::InitTimeCalibrationL1Phase()
   if (!h) {
     AliFatal(Form("There is no calibration histogram h%d for this run",runBC));
   }
+  h=(TH1C*)h->Clone();
   h->SetDirectory(0);
   fEMCALRecoUtils->SetEMCALL1PhaseInTimeRecalibrationForAllSM(h);
   
-  delete contBC;
-  
   return 1;  
 }
 
@@ -25,6 +25,7 @@ class TClonesArray;
 
 class AliVCluster;
 class AliEMCALRecoUtils;
+class AliEMCALOADBCache;
 class AliEMCALGeometry;
 class TGeoHMatrix;
 class TTree;
@@ -201,6 +202,7 @@ private:
   AliMCEvent* GetMCEvent();
   TString    GetBeamType();
   Bool_t     RunChanged() const;
+  AliEMCALOADBCache *GetOADBCache();
   Int_t      InitBadChannels();
   Bool_t     InitClusterization();
   Int_t      InitRecParam();
@@ -256,6 +258,7 @@ private:
   Float_t                fPhicut;                 // phi cut for track matching  
   TString                fBasePath;               // base folder path to get root files 
   TString                fCustomBC;               // custom BC map file
+  AliEMCALOADBCache     *fOADBCache;              //!shared EMCal OADB containers
   Bool_t                 fReClusterize;           // switch for reclustering
   AliEMCALClusterizer   *fClusterizer;            //!clusterizer 
   Bool_t                 fGeomMatrixSet;          // set geometry matrices only once, for the first event.         
@@ -296,6 +299,6 @@ private:
   AliEMCALTenderSupply(            const AliEMCALTenderSupply&c);
   AliEMCALTenderSupply& operator= (const AliEMCALTenderSupply&c);
   
-  ClassDef(AliEMCALTenderSupply, 20); // EMCAL tender task
+  ClassDef(AliEMCALTenderSupply, 21); // EMCAL tender task
 };
 #endif